@@ -0,0 +1,216 @@
+/*
+ * Basis.hpp
+ *
+ *  Created on: 17 paź 2026
+ *      Author: tomasz
+ */
+
+#ifndef BASIS_HPP_
+#define BASIS_HPP_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#include "DimensionTable.hpp"
+#include "exp/ModelExeptions.hpp"
+
+/** @brief Simplex basis of solved model stored per group of variables and group of rows.
+ *
+ * @details Status of every column and row is kept together with name and sizes of dimensions of its group,
+ * not with its index, so basis can be applied to the same model after groups were added or deleted,
+ * to a model whose groups were created in different order or to a model with bigger or smaller groups
+ * (@see remap()). Elements that have no status in basis are nonbasic at lower bound (columns)
+ * or basic (rows) - which is the natural basis of every new column and row.
+ *
+ * Basis is captured by Solver after every solve (@see Solver::solve(), Solver::getBasis())
+ * and can be saved into binary file (every number is little-endian):
+ * @code
+ * 	size			field
+ * 	8				magic "SPPBASIS"
+ * 	4 (uint32)		version (1)
+ * 	4 (uint32)		number of groups of columns
+ * 	4 (uint32)		number of groups of rows
+ * 	...				groups of columns followed by groups of rows, each group:
+ * 					4 (uint32) length of name l, l bytes of name, 4 (uint32) number of dimensions n,
+ * 					4 * n (uint32) sizes of dimensions, one byte of status (@see Status) per element
+ * @endcode
+ *
+ */
+class Basis {
+
+	friend class Solver;
+
+public:
+
+	/** @brief Status of column or row in basis (the same values as CoinWarmStartBasis::Status).
+	 *
+	 */
+	enum Status {
+		FREE = 0,          //!< nonbasic free column
+		BASIC = 1,         //!< basic column or row
+		AT_UPPER_BOUND = 2, //!< nonbasic at upper bound
+		AT_LOWER_BOUND = 3 //!< nonbasic at lower bound
+	};
+
+private:
+
+	//************************************ PRIVATE CONSTANT FIELDS *************************************//
+
+	/** @brief Magic bytes at the beginning of every basis file.
+	 *
+	 */
+	static const char MAGIC[8];
+
+	/** @brief Version of format written by save().
+	 *
+	 */
+	const static uint32_t VERSION { 1 };
+
+	//****************************************** CLASS TYPES *******************************************//
+
+	/** @brief Statuses of elements of single group in row-major order.
+	 *
+	 */
+	struct Group {
+		std::string name;
+		std::vector<uint32_t> extents;
+		std::vector<char> status;
+	};
+
+	//***************************************** CLASS FIELDS *******************************************//
+
+	/** @brief Statuses of columns of every group of variables.
+	 *
+	 */
+	std::vector<Group> columnGroups;
+
+	/** @brief Statuses of rows of every group of rows.
+	 *
+	 */
+	std::vector<Group> rowGroups;
+
+	//*************************************** PRIVATE FUNCTIONS ****************************************//
+
+	/** @brief Stores statuses of group with given name and dimensions.
+	 *
+	 * @param groups
+	 * @param name
+	 * @param dimensions
+	 * @param status statuses of dimensions.getNumberOfElements() elements of group
+	 */
+	template<typename Idx, typename DimIdx>
+	static void add(std::vector<Group>& groups, const std::string& name,
+			const DimensionTable<Idx, DimIdx>& dimensions, const char* status) {
+		groups.push_back(Group { name, std::vector<uint32_t>(
+				dimensions.getExtents().begin(), dimensions.getExtents().end()),
+				std::vector<char>(status,
+						status + dimensions.getNumberOfElements()) });
+	}
+
+	/** @brief Copies stored statuses of group with given name into given array of statuses of current group.
+	 *
+	 * @details Element of current group gets status of element with the same indexes in stored group.
+	 * Elements that do not exist in stored group (or whole group if it was not stored or it has different
+	 * number of dimensions) keep their statuses.
+	 *
+	 * @param groups
+	 * @param name
+	 * @param dimensions dimensions of current group
+	 * @param status statuses of dimensions.getNumberOfElements() elements of current group
+	 * @return number of elements that got stored status
+	 */
+	template<typename Idx, typename DimIdx>
+	static size_t remap(const std::vector<Group>& groups,
+			const std::string& name,
+			const DimensionTable<Idx, DimIdx>& dimensions, char* status) {
+		const DimIdx numberOfDimensions { dimensions.getNumberOfDimensions() };
+		const Group* group { find(groups, name) };
+		std::vector<uint32_t> indexes(numberOfDimensions, 0);
+		size_t stride { }, storedIdx { }, numberOfRemapped { 0 };
+		bool inside { };
+
+		if (group == nullptr || group->extents.size() != numberOfDimensions) {
+			return 0;
+		}
+		for (Idx idx = 0; idx < dimensions.getNumberOfElements(); idx += 1) {
+			inside = true;
+			storedIdx = 0;
+			stride = 1;
+			for (DimIdx d = numberOfDimensions; d-- > 0;) {
+				inside = inside && indexes[d] < group->extents[d];
+				storedIdx += indexes[d] * stride;
+				stride *= group->extents[d];
+			}
+			if (inside) {
+				status[idx] = group->status[storedIdx];
+				numberOfRemapped += 1;
+			}
+			for (DimIdx d = numberOfDimensions; d-- > 0;) {
+				if ((indexes[d] += 1) < dimensions.getExtent(d)) {
+					break;
+				}
+				indexes[d] = 0;
+			}
+		}
+		return numberOfRemapped;
+	}
+
+	/** @brief Returns stored group with given name or nullptr if there is no such a group.
+	 *
+	 * @param groups
+	 * @param name
+	 * @return
+	 */
+	static const Group* find(const std::vector<Group>& groups,
+			const std::string& name);
+
+public:
+
+	//************************************* PUBLIC CONSTANT FIELDS *************************************//
+
+	//************************************ CONSTRUCTOR & DESTRUCTOR ************************************//
+
+	Basis();
+
+	virtual ~Basis();
+
+	//*************************************** PUBLIC FUNCTIONS *****************************************//
+
+	/** @brief Removes every stored status.
+	 *
+	 */
+	void clear();
+
+	/** @brief Saves this basis into given file.
+	 *
+	 * @param fileName
+	 *
+	 * @throw ModelExceptions::BasisFileException will be thrown in case file cannot be written
+	 * or any size of basis (number of groups, length of name or number of dimensions) does not fit in 32 bits.
+	 */
+	void save(const std::string& fileName) const
+			throw (ModelExceptions::BasisFileException);
+
+	/** @brief Replaces this basis by basis stored in given file.
+	 *
+	 * @param fileName
+	 *
+	 * @throw ModelExceptions::BasisFileException will be thrown in case file cannot be read
+	 * or it is not a valid basis file, e.g. it holds unknown status (this basis is then left unchanged).
+	 */
+	void load(const std::string& fileName)
+			throw (ModelExceptions::BasisFileException);
+
+	//*************************************** GETTERS & SETTERS ****************************************//
+
+	bool isEmpty() const;
+
+	size_t getNumberOfColumns() const;
+
+	size_t getNumberOfRows() const;
+
+};
+
+#endif /* BASIS_HPP_ */
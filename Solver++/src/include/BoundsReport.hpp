@@ -0,0 +1,100 @@
+/*
+ * BoundsReport.hpp
+ *
+ *  Created on: 17 paź 2026
+ *      Author: tomasz
+ */
+
+#ifndef BOUNDSREPORT_HPP_
+#define BOUNDSREPORT_HPP_
+
+#include <stddef.h>
+#include <vector>
+
+#include "Typedefs.hpp"
+
+/** @brief Variable rejected by batch change of bounds or fixed values (@see BoundsReport).
+ *
+ */
+struct BoundsFailure {
+
+	enum Reason {
+		INVALID_BOUNDS, //!< lower bound is greater than upper bound (or any of them is NaN)
+		VALUE_OUT_OF_BOUNDS, //!< fixed value is out of bounds of variable
+		FIXED_VALUE_OUT_OF_BOUNDS //!< current fixed value of variable is out of new bounds
+	};
+
+	Reason reason;
+
+	/** @brief Index of column of rejected variable (@see VarGroup::getColumnIdx()).
+	 *
+	 */
+	VarIdx columnIdx;
+
+	/** @brief Lower bound that has been checked (new or current one).
+	 *
+	 */
+	VarValue lowerBound;
+
+	/** @brief Upper bound that has been checked (new or current one).
+	 *
+	 */
+	VarValue upperBound;
+
+	/** @brief Fixed value that has been checked (new or current one, 0 for Reason::INVALID_BOUNDS).
+	 *
+	 */
+	VarValue value;
+
+};
+
+/** @brief Result of batch change of bounds or fixed values of variables (@see VarGroup::fix(), VarGroup::setBounds()).
+ *
+ * @details Every variable of batch is checked before any of them is changed, so batch is applied
+ * either to all of its variables or (if any of them is rejected) to none of them. Report counts
+ * every rejected variable but describes only the first #MAX_NUMBER_OF_FAILURES of them.
+ *
+ * Example:
+ * @code
+ * 	BoundsReport report = y.fix({ y.getRange(0), range(3, 3) }, 0);	// y[*][3] = 0
+ * 	if (!report.isApplied()) {
+ * 		for (const BoundsFailure& failure : report.failures) {
+ * 			...
+ * 		}
+ * 	}
+ * @endcode
+ *
+ */
+struct BoundsReport {
+
+	/** @brief Maximal number of described failures.
+	 *
+	 */
+	const static size_t MAX_NUMBER_OF_FAILURES { 16 };
+
+	/** @brief Number of variables of batch.
+	 *
+	 */
+	size_t numberOfVariables;
+
+	/** @brief Number of rejected variables of batch.
+	 *
+	 */
+	size_t numberOfFailures;
+
+	/** @brief The first (at most #MAX_NUMBER_OF_FAILURES) rejected variables in order of columns.
+	 *
+	 */
+	std::vector<BoundsFailure> failures;
+
+	/** @brief Returns true if batch has been applied (no variable has been rejected).
+	 *
+	 * @return
+	 */
+	bool isApplied() const {
+		return this->numberOfFailures == 0;
+	}
+
+};
+
+#endif /* BOUNDSREPORT_HPP_ */
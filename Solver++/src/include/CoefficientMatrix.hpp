@@ -0,0 +1,403 @@
+/*
+ * CoefficientMatrix.hpp
+ *
+ *  Created on: 17 paź 2026
+ *      Author: tomasz
+ */
+
+#ifndef COEFFICIENTMATRIX_HPP_
+#define COEFFICIENTMATRIX_HPP_
+
+#include <stddef.h>
+#include <algorithm>
+#include <vector>
+
+#include "Typedefs.hpp"
+
+/** @brief Read-only view of non-zero coefficients of one column (or one row) of compressed matrix.
+ *
+ * @details View points into arrays owned by CoefficientMatrix and stays valid
+ * until next coefficient is added to that matrix.
+ *
+ * @tparam Idx type of indexes of coefficients (RowIdx for columns, VarIdx for rows)
+ */
+template<typename Idx>
+struct CoefficientView {
+
+	/** @brief Indexes of rows (for column view) or columns (for row view) of coefficients.
+	 *
+	 */
+	const Idx* index;
+
+	/** @brief Values of coefficients.
+	 *
+	 */
+	const VarValue* value;
+
+	/** @brief Number of coefficients.
+	 *
+	 */
+	size_t size;
+
+};
+
+typedef CoefficientView<RowIdx> ColumnView;
+typedef CoefficientView<VarIdx> RowView;
+
+/** @brief Model-wide store of coefficients of variables in rows of LP problem.
+ *
+ * @details Coefficients are appended as (row, column, value) triplets to fixed-size chunks of #CHUNK_SIZE triplets
+ * so adding coefficients never moves those that are already stored and memory overhead
+ * is bounded by a single, partially filled chunk (every non-zero costs exactly
+ * sizeof(RowIdx) + sizeof(VarIdx) + sizeof(VarValue) bytes).
+ *
+ * Triplets are kept in order in which they have been added and they are compressed on demand
+ * into column-major (CSC) or row-major (CSR) form where duplicated coefficients are summed up (@see compress()).
+ * Compressed forms used by views (@see getColumn(), getRow()) are cached until next coefficient is added.
+ *
+ * Example (matrix from OsiProblemInstance class example):
+ * @code
+ * 	CoefficientMatrix m { };
+ * 	m.add(0, 0, 1);
+ * 	m.add(0, 1, 2);
+ * 	m.add(1, 0, 2);
+ * 	m.add(1, 1, 1);
+ *
+ * 	ColumnView x1 = m.getColumn(1, 2, 2);	// x1.index = {0, 1}, x1.value = {2, 1}
+ * @endcode
+ *
+ */
+class CoefficientMatrix {
+private:
+
+	//************************************ PRIVATE CONSTANT FIELDS *************************************//
+
+	/** @brief Number of triplets stored in each chunk (16 bytes per triplet, so 1MB per chunk).
+	 *
+	 */
+	const static size_t CHUNK_SIZE { 1 << 16 };
+
+	//****************************************** CLASS TYPES *******************************************//
+
+	/** @brief Fixed-size block of triplets.
+	 *
+	 */
+	struct Chunk {
+		RowIdx row[CHUNK_SIZE];
+		VarIdx column[CHUNK_SIZE];
+		VarValue value[CHUNK_SIZE];
+	};
+
+	/** @brief Cached compressed form of this matrix (@see compress()).
+	 *
+	 */
+	template<typename Idx>
+	struct Compressed {
+
+		/** @brief Number of triplets that were compressed (compressed form is valid as long as it is equal to #numberOfElements).
+		 *
+		 */
+		size_t numberOfElements;
+
+		/** @brief Number of columns (for CSC) or rows (for CSR) that were compressed.
+		 *
+		 */
+		size_t majorSize;
+
+		std::vector<size_t> start;
+
+		std::vector<Idx> index;
+
+		std::vector<VarValue> value;
+
+	};
+
+	//***************************************** CLASS FIELDS *******************************************//
+
+	/** @brief Chunks of triplets in order in which they have been allocated.
+	 *
+	 * Every chunk except the last one is full.
+	 *
+	 */
+	std::vector<Chunk*> chunks;
+
+	/** @brief Number of stored triplets.
+	 *
+	 */
+	size_t numberOfElements;
+
+	/** @brief Cached column-major form of this matrix.
+	 *
+	 */
+	mutable Compressed<RowIdx> columnMajor;
+
+	/** @brief Cached row-major form of this matrix.
+	 *
+	 */
+	mutable Compressed<VarIdx> rowMajor;
+
+	//*************************************** PRIVATE FUNCTIONS ****************************************//
+
+	/** @brief Allocates new chunks until there is space for at least given number of triplets.
+	 *
+	 * @param numberOfElements
+	 */
+	void reserveChunks(const size_t numberOfElements);
+
+	/** @brief Calls function f(major, minor, value) for every triplet in order in which they have been added.
+	 *
+	 * @param columnMajor if true column is passed as major index, otherwise row is
+	 * @param f
+	 */
+	template<typename Function>
+	void forEach(const bool columnMajor, Function f) const {
+		if (columnMajor) {
+			forEachFrom(0,
+					[&f](const RowIdx rowIdx, const VarIdx columnIdx, const VarValue value) {
+						f(columnIdx, rowIdx, value);
+					});
+		} else {
+			forEachFrom(0, f);
+		}
+	}
+
+	/** @brief Refreshes given cached compressed form if triplets were added since it was built.
+	 *
+	 */
+	template<typename Idx>
+	void refresh(Compressed<Idx>& compressed, const bool columnMajor,
+			const size_t majorSize, const size_t minorSize) const {
+		size_t numberOfCompressed { };
+		if (compressed.numberOfElements != this->numberOfElements
+				|| compressed.majorSize != majorSize) {
+			compressed.start.resize(majorSize + 1);
+			compressed.index.resize(this->numberOfElements);
+			compressed.value.resize(this->numberOfElements);
+			numberOfCompressed = compress(columnMajor, majorSize, minorSize,
+					compressed.start.data(), compressed.index.data(),
+					compressed.value.data());
+			compressed.index.resize(numberOfCompressed);
+			compressed.value.resize(numberOfCompressed);
+			compressed.numberOfElements = this->numberOfElements;
+			compressed.majorSize = majorSize;
+		}
+	}
+
+public:
+
+	//************************************* PUBLIC CONSTANT FIELDS *************************************//
+
+	//************************************ CONSTRUCTOR & DESTRUCTOR ************************************//
+
+	CoefficientMatrix();
+
+	virtual ~CoefficientMatrix();
+
+	//*************************************** PUBLIC FUNCTIONS *****************************************//
+
+	/** @brief Makes sure that given number of triplets (in total) can be stored without allocating new chunks.
+	 *
+	 * @param numberOfElements
+	 */
+	void reserve(const size_t numberOfElements);
+
+	/** @brief Appends coefficient of given column in given row.
+	 *
+	 * @param rowIdx
+	 * @param columnIdx
+	 * @param value
+	 */
+	void add(const RowIdx rowIdx, const VarIdx columnIdx, const VarValue value) {
+		if (this->numberOfElements == this->chunks.size() * CHUNK_SIZE) {
+			reserveChunks(this->numberOfElements + 1);
+		}
+		Chunk* chunk = this->chunks[this->numberOfElements / CHUNK_SIZE];
+		const size_t i { this->numberOfElements % CHUNK_SIZE };
+		chunk->row[i] = rowIdx;
+		chunk->column[i] = columnIdx;
+		chunk->value[i] = value;
+		this->numberOfElements += 1;
+	}
+
+	/** @brief Appends coefficients of given columns in given row.
+	 *
+	 * @param rowIdx
+	 * @param columnIdx array of count columns
+	 * @param value array of count coefficients
+	 * @param count
+	 */
+	void add(const RowIdx rowIdx, const VarIdx* columnIdx,
+			const VarValue* value, const size_t count);
+
+	/** @brief Calls function f(row, column, value) for every triplet starting from given position.
+	 *
+	 * @details Triplets are visited in order in which they have been added
+	 * so e.g. coefficients added after some point can be found cheaply (@see OsiProblemInstance::updateProblem()).
+	 *
+	 * @param position position of the first visited triplet
+	 * @param f
+	 */
+	template<typename Function>
+	void forEachFrom(const size_t position, Function f) const {
+		const Chunk* chunk { };
+		size_t chunkEnd { };
+		for (size_t c = position / CHUNK_SIZE;
+				c * CHUNK_SIZE < this->numberOfElements; c += 1) {
+			chunk = this->chunks[c];
+			chunkEnd = std::min(CHUNK_SIZE,
+					this->numberOfElements - c * CHUNK_SIZE);
+			for (size_t i = c == position / CHUNK_SIZE ? position % CHUNK_SIZE : 0;
+					i < chunkEnd; i += 1) {
+				f(chunk->row[i], chunk->column[i], chunk->value[i]);
+			}
+		}
+	}
+
+	/** @brief Appends given number of uninitialized triplets.
+	 *
+	 * @details Triplets have to be filled afterwards by assign(). Distinct ranges of them
+	 * can be filled concurrently, which lets many threads move their coefficients into this matrix at once
+	 * (@see Solver::generateRows()).
+	 *
+	 * @param count number of triplets to be appended
+	 * @return position of the first appended triplet
+	 */
+	size_t extend(const size_t count);
+
+	/** @brief Overwrites count triplets starting from given position.
+	 *
+	 * @param position position of the first triplet to be overwritten (@see extend())
+	 * @param rowIdx array of count rows
+	 * @param columnIdx array of count columns
+	 * @param value array of count coefficients
+	 * @param count
+	 */
+	void assign(const size_t position, const RowIdx* rowIdx,
+			const VarIdx* columnIdx, const VarValue* value, const size_t count);
+
+	/** @brief Removes triplets of count consecutive columns (or rows) starting from given one.
+	 *
+	 * @details Remaining triplets are moved down in place and keep their order, indexes of columns (rows)
+	 * that follow removed ones are decreased by count. Chunks that are no longer needed are released
+	 * together with cached compressed forms.
+	 *
+	 * @param columnMajor if true columns are removed, otherwise rows are
+	 * @param firstIdx
+	 * @param count
+	 * @param position position of triplet, e.g. the first one that is not known to the solver
+	 * (@see OsiProblemInstance::updateProblem())
+	 * @return number of removed triplets that were stored before given position
+	 */
+	size_t remove(const bool columnMajor, const size_t firstIdx,
+			const size_t count, const size_t position);
+
+	/** @brief Removes every triplet and releases every chunk.
+	 *
+	 */
+	void clear();
+
+	/** @brief Compresses triplets into column-major (CSC) or row-major (CSR) arrays given by the caller.
+	 *
+	 * @details Triplets are sorted by major index with counting sort (so it takes O(majorSize + minorSize + number of triplets) time
+	 * and keeps minor indexes in order in which they have been added) and duplicated coefficients are summed up.
+	 * Types of output arrays are template parameters so matrix can be compressed directly
+	 * into arrays expected by the solver (e.g. CoinBigIndex and int for CoinPackedMatrix).
+	 *
+	 * @param columnMajor if true matrix is compressed into CSC form, otherwise into CSR form
+	 * @param majorSize number of columns (CSC) or rows (CSR)
+	 * @param minorSize number of rows (CSC) or columns (CSR)
+	 * @param start array of majorSize + 1 elements; coefficients of j-th major index are stored in [start[j], start[j + 1])
+	 * @param index array of getNumberOfElements() elements that receives minor indexes
+	 * @param value array of getNumberOfElements() elements that receives values of coefficients
+	 * @return number of coefficients after duplicates were summed up (equal to start[majorSize])
+	 */
+	template<typename Start, typename Idx, typename Value>
+	size_t compress(const bool columnMajor, const size_t majorSize,
+			const size_t minorSize, Start* start, Idx* index,
+			Value* value) const {
+		size_t* position = new size_t[majorSize] { };
+		Start* lastPosition = new Start[minorSize];
+		Start k { }, majorBegin { }, majorEnd { };
+
+		std::fill_n(start, majorSize + 1, 0);
+		forEach(columnMajor,
+				[start](const size_t major, const size_t, const VarValue) {
+					start[major + 1] += 1;
+				});
+		for (size_t j = 0; j < majorSize; j += 1) {
+			start[j + 1] += start[j];
+			position[j] = start[j];
+		}
+		forEach(columnMajor,
+				[position, index, value](const size_t major,
+						const size_t minor, const VarValue v) {
+					index[position[major]] = (Idx) minor;
+					value[position[major]] = v;
+					position[major] += 1;
+				});
+
+		// summing up duplicated coefficients (major vectors are compacted in place)
+		std::fill_n(lastPosition, minorSize, (Start) -1);
+		for (size_t j = 0; j < majorSize; j += 1) {
+			majorBegin = start[j];
+			majorEnd = start[j + 1];
+			start[j] = k;
+			for (Start i = majorBegin; i < majorEnd; i += 1) {
+				if (lastPosition[index[i]] != (Start) -1
+						&& lastPosition[index[i]] >= start[j]) {
+					value[lastPosition[index[i]]] += value[i];
+				} else {
+					lastPosition[index[i]] = k;
+					index[k] = index[i];
+					value[k] = value[i];
+					k += 1;
+				}
+			}
+		}
+		start[majorSize] = k;
+
+		delete[] position;
+		delete[] lastPosition;
+		return k;
+	}
+
+	/** @brief Returns view of coefficients of given column.
+	 *
+	 * @details Cached CSC form of this matrix is rebuilt first if any coefficient was added since it was built.
+	 *
+	 * @param columnIdx
+	 * @param numberOfColumns number of columns of LP problem
+	 * @param numberOfRows number of rows of LP problem
+	 * @return
+	 */
+	ColumnView getColumn(const VarIdx columnIdx, const VarIdx numberOfColumns,
+			const RowIdx numberOfRows) const;
+
+	/** @brief Returns view of coefficients of given row.
+	 *
+	 * @details Cached CSR form of this matrix is rebuilt first if any coefficient was added since it was built.
+	 *
+	 * @param rowIdx
+	 * @param numberOfColumns number of columns of LP problem
+	 * @param numberOfRows number of rows of LP problem
+	 * @return
+	 */
+	RowView getRow(const RowIdx rowIdx, const VarIdx numberOfColumns,
+			const RowIdx numberOfRows) const;
+
+	/** @brief Releases cached compressed forms of this matrix.
+	 *
+	 */
+	void releaseCache();
+
+	//*************************************** GETTERS & SETTERS ****************************************//
+
+	/** @brief Returns number of stored triplets (including duplicated ones).
+	 *
+	 * @return
+	 */
+	size_t getNumberOfElements() const;
+
+};
+
+#endif /* COEFFICIENTMATRIX_HPP_ */
@@ -0,0 +1,441 @@
+/*
+ * DimensionTable.hpp
+ *
+ *  Created on: 17 paź 2026
+ *      Author: tomasz
+ */
+
+#ifndef DIMENSIONTABLE_HPP_
+#define DIMENSIONTABLE_HPP_
+
+#include <stddef.h>
+#include <cmath>
+#include <initializer_list>
+
+#include "Typedefs.hpp"
+
+/** @brief Maximal number of dimensions of any group of variables, parameters or rows.
+ *
+ * @details Both IndexTuple and DimensionTable store their data in arrays of this size
+ * so they never allocate memory.
+ *
+ */
+const static unsigned int MAX_NUMBER_OF_DIMENSIONS { 8 };
+
+/** @brief Fixed-capacity, allocation-free list of indexes.
+ *
+ * @details It is used both as list of sizes of dimensions of given group
+ * (e.g. {3, 4} for group "x[3][4]") and as list of indexes of one particular element of that group
+ * (e.g. {2, 3} for element "x[2][3]"). It can hold up to #MAX_NUMBER_OF_DIMENSIONS indexes.
+ *
+ * Example:
+ * @code
+ * 	IndexTuple<VarDimIdx> indexes { 2, 3 };
+ * 	indexes.push_back(4);	// {2, 3, 4}
+ * 	indexes[0];				// 2
+ * @endcode
+ *
+ */
+template<typename DimIdx>
+class IndexTuple {
+private:
+
+	//***************************************** CLASS FIELDS *******************************************//
+
+	/** @brief Stored indexes, only first #numberOfIndexes of them are valid.
+	 *
+	 */
+	DimIdx indexes[MAX_NUMBER_OF_DIMENSIONS];
+
+	/** @brief Number of valid indexes in #indexes array.
+	 *
+	 */
+	DimIdx numberOfIndexes;
+
+public:
+
+	//************************************ CONSTRUCTOR & DESTRUCTOR ************************************//
+
+	/** @brief Creates empty list of indexes (it describes 0-dimensional element).
+	 *
+	 */
+	IndexTuple() :
+			numberOfIndexes(0) {
+	}
+
+	/** @brief Creates list of given indexes.
+	 *
+	 * @details Indexes above #MAX_NUMBER_OF_DIMENSIONS are ignored.
+	 *
+	 * @param indexes
+	 */
+	IndexTuple(std::initializer_list<DimIdx> indexes) :
+			numberOfIndexes(0) {
+		for (DimIdx index : indexes) {
+			this->push_back(index);
+		}
+	}
+
+	//*************************************** PUBLIC FUNCTIONS *****************************************//
+
+	/** @brief Appends given index at the end of the list.
+	 *
+	 * @param index
+	 * @return false if list is already full (it has #MAX_NUMBER_OF_DIMENSIONS indexes), true otherwise.
+	 */
+	bool push_back(const DimIdx index) {
+		if (this->numberOfIndexes == MAX_NUMBER_OF_DIMENSIONS) {
+			return false;
+		}
+		this->indexes[this->numberOfIndexes] = index;
+		this->numberOfIndexes += 1;
+		return true;
+	}
+
+	/** @brief Removes every index from this list.
+	 *
+	 */
+	void clear() {
+		this->numberOfIndexes = 0;
+	}
+
+	DimIdx& operator[](const DimIdx position) {
+		return this->indexes[position];
+	}
+
+	const DimIdx& operator[](const DimIdx position) const {
+		return this->indexes[position];
+	}
+
+	bool operator==(const IndexTuple<DimIdx>& other) const {
+		if (this->numberOfIndexes != other.numberOfIndexes) {
+			return false;
+		}
+		for (DimIdx i = 0; i < this->numberOfIndexes; i += 1) {
+			if (this->indexes[i] != other.indexes[i]) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	bool operator!=(const IndexTuple<DimIdx>& other) const {
+		return !(*this == other);
+	}
+
+	const DimIdx* begin() const {
+		return this->indexes;
+	}
+
+	const DimIdx* end() const {
+		return this->indexes + this->numberOfIndexes;
+	}
+
+	//*************************************** GETTERS & SETTERS ****************************************//
+
+	DimIdx size() const {
+		return this->numberOfIndexes;
+	}
+
+	bool empty() const {
+		return this->numberOfIndexes == 0;
+	}
+
+};
+
+/** @brief Inclusive range [first, last] of (1-based) indexes of single dimension of group of rows or variables.
+ *
+ * @details Range with last < first is empty.
+ *
+ * @see range(), Solver::forall(), VarGroup::fix()
+ *
+ */
+struct IndexRange {
+
+	/** @brief The first index of range.
+	 *
+	 */
+	RowDimIdx first;
+
+	/** @brief The last index of range (inclusive).
+	 *
+	 */
+	RowDimIdx last;
+
+	/** @brief Returns number of indexes in this range.
+	 *
+	 * @return
+	 */
+	RowDimIdx size() const {
+		return this->last < this->first ? 0 : this->last - this->first + 1;
+	}
+
+};
+
+/** @brief Returns range of indexes [first, last].
+ *
+ * @param first
+ * @param last
+ * @return
+ */
+inline IndexRange range(const RowDimIdx first, const RowDimIdx last) {
+	return IndexRange { first, last };
+}
+
+/** @brief Returns range of indexes [1, size].
+ *
+ * @param size
+ * @return
+ */
+inline IndexRange range(const RowDimIdx size) {
+	return IndexRange { 1, size };
+}
+
+/** @brief Describes dimensions of group of variables, parameters or rows.
+ *
+ * @details Beside sizes of every dimension (extents) table stores precomputed strides
+ * (row-major order, the last dimension changes the fastest) so linearizing list of indexes of some element
+ * is a short multiply-add loop over contiguous array.
+ *
+ * Example for group 'x[5][3][7]':
+ * @code
+ * 	extents	-	{5, 3, 7}
+ * 	strides	-	{21, 7, 1}
+ *
+ * 	linearize({2, 3, 4})	->	(2-1)*21 + (3-1)*7 + (4-1)*1 = 38
+ * @endcode
+ *
+ * Every structure has its own types so table should be used with proper template parameters:
+ * - DimensionTable<VarIdx,VarDimIdx> - for VariableIdxMapper,
+ * - DimensionTable<ParamIdx,ParamDimIdx> - for ParamIdxMapper,
+ * - DimensionTable<RowIdx,RowDimIdx> - for RowIdxMapper.
+ *
+ */
+template<typename Idx, typename DimIdx>
+class DimensionTable {
+private:
+
+	//***************************************** CLASS FIELDS *******************************************//
+
+	/** @brief Size of every dimension.
+	 *
+	 * @details Empty for 0-dimensional groups (single element).
+	 *
+	 */
+	IndexTuple<DimIdx> extents;
+
+	/** @brief Distance (in elements) between two consecutive indexes of given dimension.
+	 *
+	 */
+	Idx strides[MAX_NUMBER_OF_DIMENSIONS];
+
+	/** @brief Reciprocals of #strides.
+	 *
+	 * @details Used by batched unlinearize() which replaces integer division
+	 * (that has no vector counterpart) with floating point multiplication.
+	 *
+	 */
+	double inverseStrides[MAX_NUMBER_OF_DIMENSIONS];
+
+	/** @brief Number of all elements in group (product of all extents, 1 for 0-dimensional groups).
+	 *
+	 */
+	Idx numberOfElements;
+
+	/** @brief Number of linear indexes decoded at once by batched unlinearize().
+	 *
+	 */
+	const static size_t UNLINEARIZE_BLOCK_SIZE { 256 };
+
+public:
+
+	//************************************ CONSTRUCTOR & DESTRUCTOR ************************************//
+
+	/** @brief Creates table of 0-dimensional group (single element).
+	 *
+	 */
+	DimensionTable() :
+			numberOfElements(1) {
+	}
+
+	/** @brief Creates table with given sizes of dimensions and computes its strides.
+	 *
+	 * @param extents sizes of dimensions
+	 */
+	explicit DimensionTable(const IndexTuple<DimIdx>& extents) :
+			extents(extents), numberOfElements(1) {
+		for (DimIdx i = extents.size(); i > 0; i -= 1) {
+			this->strides[i - 1] = this->numberOfElements;
+			this->inverseStrides[i - 1] = 1.0 / (double) this->numberOfElements;
+			this->numberOfElements *= extents[i - 1];
+		}
+	}
+
+	//*************************************** PUBLIC FUNCTIONS *****************************************//
+
+	/** @brief Checks if group with given sizes of dimensions has more elements than given limit.
+	 *
+	 * @details Product of sizes is compared with limit one dimension at a time, so it never overflows
+	 * (unlike #numberOfElements of table created from such sizes).
+	 *
+	 * @param extents sizes of dimensions
+	 * @param limit maximal number of elements
+	 * @return
+	 */
+	static bool exceedsLimit(const IndexTuple<DimIdx>& extents, const Idx limit) {
+		Idx numberOfElements { 1 };
+		for (DimIdx i = 0; i < extents.size(); i += 1) {
+			if (extents[i] == 0) {
+				return false;
+			}
+		}
+		for (DimIdx i = 0; i < extents.size(); i += 1) {
+			if (numberOfElements > limit / extents[i]) {
+				return true;
+			}
+			numberOfElements *= extents[i];
+		}
+		return numberOfElements > limit;
+	}
+
+	/** @brief Returns linearized (0-based) index of element with given (1-based) indexes.
+	 *
+	 * @details Function will not check if indexes are valid (@see isOutOfBounds()).
+	 *
+	 * @param indexes
+	 * @return
+	 */
+	Idx linearize(const IndexTuple<DimIdx>& indexes) const {
+		Idx idx { 0 };
+		for (DimIdx i = 0; i < this->extents.size(); i += 1) {
+			idx += (Idx) (indexes[i] - 1) * this->strides[i];
+		}
+		return idx;
+	}
+
+	/** @brief Reconstructs (1-based) indexes of element with given linearized (0-based) index.
+	 *
+	 * @details Every index is computed with one division and one modulo by stride of its dimension
+	 * so cost of this function depends only on number of dimensions.
+	 *
+	 * Example for group 'x[12][6][8]' (strides - {48, 8, 1}):
+	 * @code
+	 * 	unlinearize(73, indexes);	// indexes = {2, 4, 2} (1*48 + 3*8 + 1)
+	 * @endcode
+	 *
+	 * @param idx linearized index of element
+	 * @param indexes list that will be filled with indexes of element
+	 */
+	void unlinearize(Idx idx, IndexTuple<DimIdx>& indexes) const {
+		indexes.clear();
+		for (DimIdx i = 0; i < this->extents.size(); i += 1) {
+			indexes.push_back((DimIdx) (idx / this->strides[i] + 1));
+			idx %= this->strides[i];
+		}
+	}
+
+	/** @brief Reconstructs indexes of many elements at once.
+	 *
+	 * @details Given linearized indexes are decoded into flat, row-major buffer of indexes:
+	 * indexes of element idx[k] are stored in indexes[k * d], ..., indexes[k * d + d - 1]
+	 * where d is a number of dimensions of this table (buffer has to hold count * d elements).
+	 *
+	 * Elements are decoded in blocks dimension by dimension. Division is replaced by multiplication
+	 * with reciprocal of stride followed by exact correction, so inner loops consist only of floating point
+	 * operations which compiler can vectorize. Result is exact for every index that fits in Idx type
+	 * (as long as it is not wider than 32 bits).
+	 *
+	 * Example for group 'x[4][5]':
+	 * @code
+	 * 	VarIdx idx[] = { 0, 7, 19 };
+	 * 	VarDimIdx indexes[3 * 2];
+	 * 	table.unlinearize(idx, 3, indexes);	// indexes = {1, 1, 2, 3, 4, 5}
+	 * @endcode
+	 *
+	 * @param idx array of linearized indexes
+	 * @param count number of linearized indexes in idx array
+	 * @param indexes output buffer for count * getNumberOfDimensions() indexes
+	 */
+	void unlinearize(const Idx* idx, const size_t count,
+			DimIdx* indexes) const {
+		double remainders[UNLINEARIZE_BLOCK_SIZE];
+		const DimIdx numberOfDimensions { this->extents.size() };
+		size_t blockSize { };
+		double stride { }, inverseStride { }, quotient { }, remainder { };
+
+		for (size_t blockBegin = 0; blockBegin < count; blockBegin +=
+				UNLINEARIZE_BLOCK_SIZE) {
+			blockSize = (
+					count - blockBegin < UNLINEARIZE_BLOCK_SIZE ?
+							count - blockBegin : UNLINEARIZE_BLOCK_SIZE);
+			for (size_t k = 0; k < blockSize; k += 1) {
+				remainders[k] = (double) idx[blockBegin + k];
+			}
+			for (DimIdx i = 0; i < numberOfDimensions; i += 1) {
+				stride = (double) this->strides[i];
+				inverseStride = this->inverseStrides[i];
+				DimIdx* blockIndexes = indexes + blockBegin * numberOfDimensions
+						+ i;
+				for (size_t k = 0; k < blockSize; k += 1) {
+					quotient = std::floor(remainders[k] * inverseStride);
+					remainder = remainders[k] - quotient * stride;
+					quotient += (remainder >= stride) - (remainder < 0.0);
+					remainders[k] -= quotient * stride;
+					blockIndexes[k * numberOfDimensions] = (DimIdx) quotient + 1;
+				}
+			}
+		}
+	}
+
+	/** @brief Checks if given list of indexes refers to an element of this group.
+	 *
+	 * @param indexes
+	 * @return true if number of indexes differs from number of dimensions
+	 * or some index is equal to 0 or exceeds size of its dimension.
+	 */
+	bool isOutOfBounds(const IndexTuple<DimIdx>& indexes) const {
+		if (indexes.size() != this->extents.size()) {
+			return true;
+		}
+		for (DimIdx i = 0; i < this->extents.size(); i += 1) {
+			if (indexes[i] == 0 || indexes[i] > this->extents[i]) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	//*************************************** GETTERS & SETTERS ****************************************//
+
+	const IndexTuple<DimIdx>& getExtents() const {
+		return this->extents;
+	}
+
+	DimIdx getExtent(const DimIdx dimension) const {
+		return this->extents[dimension];
+	}
+
+	Idx getStride(const DimIdx dimension) const {
+		return this->strides[dimension];
+	}
+
+	DimIdx getNumberOfDimensions() const {
+		return this->extents.size();
+	}
+
+	Idx getNumberOfElements() const {
+		return this->numberOfElements;
+	}
+
+};
+
+typedef IndexTuple<VarDimIdx> VarIndexTuple;
+typedef DimensionTable<VarIdx, VarDimIdx> VarDimensionTable;
+
+typedef IndexTuple<ParamDimIdx> ParamIndexTuple;
+typedef DimensionTable<ParamIdx, ParamDimIdx> ParamDimensionTable;
+
+typedef IndexTuple<RowDimIdx> RowIndexTuple;
+typedef DimensionTable<RowIdx, RowDimIdx> RowDimensionTable;
+
+#endif /* DIMENSIONTABLE_HPP_ */
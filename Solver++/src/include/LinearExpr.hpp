@@ -0,0 +1,493 @@
+/*
+ * LinearExpr.hpp
+ *
+ *  Created on: 17 paź 2026
+ *      Author: tomasz
+ */
+
+#ifndef LINEAREXPR_HPP_
+#define LINEAREXPR_HPP_
+
+#include <stddef.h>
+#include <type_traits>
+#include <vector>
+
+#include "Typedefs.hpp"
+#include "utils/Utils.hpp"
+#include "Variable.hpp"
+
+/** @brief Reusable buffer that receives terms of linear expression.
+ *
+ * @details Expressions (@see LinearExpr) write their terms into this buffer in a single pass
+ * - without building any intermediate structure. Every thread has its own buffer (@see getThreadLocal())
+ * whose memory is kept between expressions, so after the first few rows building an expression allocates nothing.
+ *
+ */
+class LinearExprBuffer {
+private:
+
+	//************************************ PRIVATE CONSTANT FIELDS *************************************//
+
+	//****************************************** CLASS TYPES *******************************************//
+
+	/** @brief Single term of expression.
+	 *
+	 */
+	struct Term {
+		VarIdx columnIdx;
+		VarValue value;
+	};
+
+	//***************************************** CLASS FIELDS *******************************************//
+
+	/** @brief Terms in order in which they have been written.
+	 *
+	 */
+	std::vector<Term> terms;
+
+	/** @brief Columns of merged terms (@see mergeDuplicates()).
+	 *
+	 */
+	std::vector<VarIdx> columnIdx;
+
+	/** @brief Coefficients of merged terms (@see mergeDuplicates()).
+	 *
+	 */
+	std::vector<VarValue> value;
+
+	/** @brief Sum of constant terms.
+	 *
+	 */
+	VarValue constant;
+
+	//*************************************** PRIVATE FUNCTIONS ****************************************//
+
+public:
+
+	//************************************* PUBLIC CONSTANT FIELDS *************************************//
+
+	//************************************ CONSTRUCTOR & DESTRUCTOR ************************************//
+
+	LinearExprBuffer();
+
+	virtual ~LinearExprBuffer();
+
+	//*************************************** PUBLIC FUNCTIONS *****************************************//
+
+	/** @brief Returns buffer of calling thread, already cleared.
+	 *
+	 * @return
+	 */
+	static LinearExprBuffer& getThreadLocal();
+
+	/** @brief Removes every term and constant.
+	 *
+	 */
+	void clear();
+
+	void addTerm(const VarIdx columnIdx, const VarValue coefficient) {
+		this->terms.push_back(Term { columnIdx, coefficient });
+	}
+
+	void addConstant(const VarValue constant) {
+		this->constant += constant;
+	}
+
+	/** @brief Sorts terms by column and sums up coefficients of the same column.
+	 *
+	 * @details Sorting is done in place and merged terms are written into arrays
+	 * that are kept between expressions so no memory is allocated.
+	 *
+	 */
+	void mergeDuplicates();
+
+	//*************************************** GETTERS & SETTERS ****************************************//
+
+	/** @brief Returns columns of merged terms (@see mergeDuplicates()).
+	 *
+	 * @return
+	 */
+	const VarIdx* getColumnIdx() const;
+
+	/** @brief Returns coefficients of merged terms (@see mergeDuplicates()).
+	 *
+	 * @return
+	 */
+	const VarValue* getValues() const;
+
+	/** @brief Returns number of merged terms (@see mergeDuplicates()).
+	 *
+	 * @return
+	 */
+	size_t getNumberOfTerms() const;
+
+	VarValue getConstant() const;
+
+	/** @brief Returns bound of row after constant terms of expression are moved to the right-hand side.
+	 *
+	 * @details Unbounded values (@see Utils::getUnbounded()) are left as they are.
+	 *
+	 * @param bound bound of the whole expression (with constant terms)
+	 * @return bound - getConstant()
+	 */
+	VarValue getRowBound(const VarValue bound) const;
+
+};
+
+/** @brief Base of every node of linear expression.
+ *
+ * @details Linear expressions are built with expression templates: every operator returns lightweight node
+ * that keeps its operands by value and knows its type at compile time. Nothing is computed until expression
+ * is written into a row (@see Row::setConstraint(), RowBuffer::addConstraint()) - then the whole expression
+ * is evaluated by single call of emit() that writes its terms directly into LinearExprBuffer.
+ *
+ * Example (sum_j c[i][j] * x[i][j] <= cap[i]):
+ * @code
+ * 	VarGroup<2> x = s.group<2>("x");
+ * 	RowGroup<1> capacity = s.rowGroup<1>("capacity");
+ * 	for (VarDimIdx i = 1; i <= n; i += 1) {
+ * 		capacity(i).setConstraint(
+ * 				sum(1, m, [&](const VarDimIdx j) { return c[i - 1][j - 1] * x(i, j); }) <= cap[i - 1]);
+ * 	}
+ * @endcode
+ *
+ * @tparam E type of expression node (CRTP)
+ */
+template<typename E>
+struct LinearExpr {
+
+	const E& self() const {
+		return static_cast<const E&>(*this);
+	}
+
+	/** @brief Writes terms of this expression multiplied by given factor into given buffer.
+	 *
+	 * @param buffer
+	 * @param factor
+	 */
+	void emit(LinearExprBuffer& buffer, const VarValue factor) const {
+		self().emit(buffer, factor);
+	}
+
+};
+
+/** @brief Single term: coefficient * variable.
+ *
+ */
+struct TermExpr: public LinearExpr<TermExpr> {
+
+	VarIdx columnIdx;
+
+	VarValue coefficient;
+
+	TermExpr(const VarIdx columnIdx, const VarValue coefficient) :
+			columnIdx(columnIdx), coefficient(coefficient) {
+	}
+
+	void emit(LinearExprBuffer& buffer, const VarValue factor) const {
+		buffer.addTerm(this->columnIdx, this->coefficient * factor);
+	}
+
+};
+
+/** @brief Constant term (it is moved to bounds of row when expression is written).
+ *
+ */
+struct ConstantExpr: public LinearExpr<ConstantExpr> {
+
+	VarValue value;
+
+	explicit ConstantExpr(const VarValue value) :
+			value(value) {
+	}
+
+	void emit(LinearExprBuffer& buffer, const VarValue factor) const {
+		buffer.addConstant(this->value * factor);
+	}
+
+};
+
+/** @brief Sum of two expressions (difference if right one is scaled by -1).
+ *
+ */
+template<typename L, typename R>
+struct SumExpr: public LinearExpr<SumExpr<L, R>> {
+
+	L left;
+
+	R right;
+
+	VarValue rightFactor;
+
+	SumExpr(const L& left, const R& right, const VarValue rightFactor) :
+			left(left), right(right), rightFactor(rightFactor) {
+	}
+
+	void emit(LinearExprBuffer& buffer, const VarValue factor) const {
+		this->left.emit(buffer, factor);
+		this->right.emit(buffer, factor * this->rightFactor);
+	}
+
+};
+
+/** @brief Expression multiplied by scalar.
+ *
+ */
+template<typename E>
+struct ScaledExpr: public LinearExpr<ScaledExpr<E>> {
+
+	E expression;
+
+	VarValue scalar;
+
+	ScaledExpr(const E& expression, const VarValue scalar) :
+			expression(expression), scalar(scalar) {
+	}
+
+	void emit(LinearExprBuffer& buffer, const VarValue factor) const {
+		this->expression.emit(buffer, factor * this->scalar);
+	}
+
+};
+
+/** @brief Sum of expressions f(i) for i = first, ..., last (@see sum()).
+ *
+ */
+template<typename Idx, typename F>
+struct SumOverExpr: public LinearExpr<SumOverExpr<Idx, F>> {
+
+	Idx first;
+
+	Idx last;
+
+	F f;
+
+	SumOverExpr(const Idx first, const Idx last, const F& f) :
+			first(first), last(last), f(f) {
+	}
+
+	void emit(LinearExprBuffer& buffer, const VarValue factor) const {
+		for (Idx i = this->first; i <= this->last; i += 1) {
+			toExpr(this->f(i)).emit(buffer, factor);
+		}
+	}
+
+};
+
+/** @brief Linear constraint: lower <= expression <= upper.
+ *
+ * @details Created by comparison operators (<=, >=, ==) applied to expression and number.
+ *
+ */
+template<typename E>
+struct Constraint {
+
+	E expression;
+
+	VarValue lowerBound;
+
+	VarValue upperBound;
+
+	/** @brief Writes terms of constraint into given buffer (duplicated columns are merged).
+	 *
+	 * @param buffer
+	 */
+	void emit(LinearExprBuffer& buffer) const {
+		this->expression.emit(buffer, 1);
+		buffer.mergeDuplicates();
+	}
+
+};
+
+namespace LinearExprImpl {
+
+/** @brief Checks if T can be an operand of linear expression (expression node or Variable).
+ *
+ */
+template<typename T>
+struct IsOperand {
+	const static bool value = std::is_base_of<LinearExpr<T>, T>::value
+			|| std::is_same<T, Variable>::value;
+};
+
+}
+
+//*************************************** OPERANDS *****************************************//
+
+inline TermExpr toExpr(const Variable& variable) {
+	return TermExpr { variable.getColumnIdx(), 1 };
+}
+
+template<typename E>
+inline const E& toExpr(const LinearExpr<E>& expression) {
+	return expression.self();
+}
+
+template<typename T>
+using ExprType = typename std::decay<decltype(toExpr(std::declval<T>()))>::type;
+
+//*************************************** OPERATORS *****************************************//
+
+template<typename L, typename R, typename = typename std::enable_if<
+		LinearExprImpl::IsOperand<L>::value
+				&& LinearExprImpl::IsOperand<R>::value>::type>
+inline SumExpr<ExprType<L>, ExprType<R>> operator+(const L& left,
+		const R& right) {
+	return SumExpr<ExprType<L>, ExprType<R>> { toExpr(left), toExpr(right), 1 };
+}
+
+template<typename L, typename R, typename = typename std::enable_if<
+		LinearExprImpl::IsOperand<L>::value
+				&& LinearExprImpl::IsOperand<R>::value>::type>
+inline SumExpr<ExprType<L>, ExprType<R>> operator-(const L& left,
+		const R& right) {
+	return SumExpr<ExprType<L>, ExprType<R>> { toExpr(left), toExpr(right), -1 };
+}
+
+template<typename E, typename = typename std::enable_if<
+		LinearExprImpl::IsOperand<E>::value>::type>
+inline SumExpr<ExprType<E>, ConstantExpr> operator+(const E& expression,
+		const VarValue constant) {
+	return SumExpr<ExprType<E>, ConstantExpr> { toExpr(expression),
+			ConstantExpr { constant }, 1 };
+}
+
+template<typename E, typename = typename std::enable_if<
+		LinearExprImpl::IsOperand<E>::value>::type>
+inline SumExpr<ExprType<E>, ConstantExpr> operator+(const VarValue constant,
+		const E& expression) {
+	return expression + constant;
+}
+
+template<typename E, typename = typename std::enable_if<
+		LinearExprImpl::IsOperand<E>::value>::type>
+inline SumExpr<ExprType<E>, ConstantExpr> operator-(const E& expression,
+		const VarValue constant) {
+	return SumExpr<ExprType<E>, ConstantExpr> { toExpr(expression),
+			ConstantExpr { constant }, -1 };
+}
+
+template<typename E, typename = typename std::enable_if<
+		LinearExprImpl::IsOperand<E>::value>::type>
+inline SumExpr<ConstantExpr, ExprType<E>> operator-(const VarValue constant,
+		const E& expression) {
+	return SumExpr<ConstantExpr, ExprType<E>> { ConstantExpr { constant },
+			toExpr(expression), -1 };
+}
+
+template<typename E, typename = typename std::enable_if<
+		LinearExprImpl::IsOperand<E>::value>::type>
+inline ScaledExpr<ExprType<E>> operator-(const E& expression) {
+	return ScaledExpr<ExprType<E>> { toExpr(expression), -1 };
+}
+
+inline TermExpr operator*(const VarValue coefficient,
+		const Variable& variable) {
+	return TermExpr { variable.getColumnIdx(), coefficient };
+}
+
+inline TermExpr operator*(const Variable& variable,
+		const VarValue coefficient) {
+	return TermExpr { variable.getColumnIdx(), coefficient };
+}
+
+template<typename E>
+inline ScaledExpr<E> operator*(const VarValue scalar,
+		const LinearExpr<E>& expression) {
+	return ScaledExpr<E> { expression.self(), scalar };
+}
+
+template<typename E>
+inline ScaledExpr<E> operator*(const LinearExpr<E>& expression,
+		const VarValue scalar) {
+	return ScaledExpr<E> { expression.self(), scalar };
+}
+
+/** @brief Returns expression f(first) + f(first + 1) + ... + f(last).
+ *
+ * @details Bounds are inclusive, so sum over 1-based index of group of variables
+ * looks like its mathematical notation: sum(1, n, [&](const VarDimIdx j) { return c[j - 1] * x(j); }).
+ * Function f is called while expression is written into a row, not when sum() is called,
+ * so it has to capture by value everything that may not outlive the expression (e.g. indexes passed by Solver::forall()).
+ *
+ * @param first
+ * @param last
+ * @param f function that returns expression (or Variable) for given index
+ * @return
+ */
+template<typename Idx, typename F>
+inline SumOverExpr<Idx, F> sum(const Idx first, const Idx last, const F& f) {
+	return SumOverExpr<Idx, F> { first, last, f };
+}
+
+//*************************************** CONSTRAINTS *****************************************//
+
+template<typename E, typename = typename std::enable_if<
+		LinearExprImpl::IsOperand<E>::value>::type>
+inline Constraint<ExprType<E>> operator<=(const E& expression,
+		const VarValue upperBound) {
+	return Constraint<ExprType<E>> { toExpr(expression),
+			Utils::getUnbounded(Bounds::LOWER), upperBound };
+}
+
+template<typename E, typename = typename std::enable_if<
+		LinearExprImpl::IsOperand<E>::value>::type>
+inline Constraint<ExprType<E>> operator>=(const E& expression,
+		const VarValue lowerBound) {
+	return Constraint<ExprType<E>> { toExpr(expression), lowerBound,
+			Utils::getUnbounded(Bounds::UPPER) };
+}
+
+template<typename E, typename = typename std::enable_if<
+		LinearExprImpl::IsOperand<E>::value>::type>
+inline Constraint<ExprType<E>> operator==(const E& expression,
+		const VarValue value) {
+	return Constraint<ExprType<E>> { toExpr(expression), value, value };
+}
+
+template<typename E, typename = typename std::enable_if<
+		LinearExprImpl::IsOperand<E>::value>::type>
+inline Constraint<ExprType<E>> operator<=(const VarValue lowerBound,
+		const E& expression) {
+	return expression >= lowerBound;
+}
+
+template<typename E, typename = typename std::enable_if<
+		LinearExprImpl::IsOperand<E>::value>::type>
+inline Constraint<ExprType<E>> operator>=(const VarValue upperBound,
+		const E& expression) {
+	return expression <= upperBound;
+}
+
+template<typename E, typename = typename std::enable_if<
+		LinearExprImpl::IsOperand<E>::value>::type>
+inline Constraint<ExprType<E>> operator==(const VarValue value,
+		const E& expression) {
+	return expression == value;
+}
+
+template<typename L, typename R, typename = typename std::enable_if<
+		LinearExprImpl::IsOperand<L>::value
+				&& LinearExprImpl::IsOperand<R>::value>::type>
+inline Constraint<SumExpr<ExprType<L>, ExprType<R>>> operator<=(const L& left,
+		const R& right) {
+	return (left - right) <= 0;
+}
+
+template<typename L, typename R, typename = typename std::enable_if<
+		LinearExprImpl::IsOperand<L>::value
+				&& LinearExprImpl::IsOperand<R>::value>::type>
+inline Constraint<SumExpr<ExprType<L>, ExprType<R>>> operator>=(const L& left,
+		const R& right) {
+	return (left - right) >= 0;
+}
+
+template<typename L, typename R, typename = typename std::enable_if<
+		LinearExprImpl::IsOperand<L>::value
+				&& LinearExprImpl::IsOperand<R>::value>::type>
+inline Constraint<SumExpr<ExprType<L>, ExprType<R>>> operator==(const L& left,
+		const R& right) {
+	return (left - right) == 0;
+}
+
+#endif /* LINEAREXPR_HPP_ */
@@ -0,0 +1,582 @@
+/*
+ * ModelReader.hpp
+ *
+ *  Created on: 17 paź 2026
+ *      Author: tomasz
+ */
+
+#ifndef MODELREADER_HPP_
+#define MODELREADER_HPP_
+
+#include <stddef.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "DimensionTable.hpp"
+#include "exp/ModelExeptions.hpp"
+#include "Typedefs.hpp"
+#include "utils/StringUtils.hpp"
+#include "utils/TensorFileUtils.hpp"
+
+class OsiProblemInstance;
+
+/** @brief Parallel reader of free MPS or CPLEX LP file (@see Solver::readModel()).
+ *
+ * @details File is mapped into memory (gzip files are inflated into memory first) and never copied line by line.
+ * Headers of sections are found by all threads at once, then the biggest section (COLUMNS of MPS,
+ * Subject To of LP) is split into pieces at line boundaries which are parsed in parallel. Every piece
+ * collects its coefficients in its own arrays, so they are loaded into the model in bulk
+ * (@see OsiProblemInstance::extendElements(), OsiProblemInstance::assignElements()).
+ *
+ * Names of columns and rows are folded back into groups: names "x[1][1]", ..., "x[3][4]" (or "x(1)(1)", ... in LP)
+ * become a single group "x" with extents inferred from the greatest index found in every dimension
+ * (@see StringUtils::parseDefinition()). Elements of group that do not appear in file are created as
+ * columns bounded by [0, inf) or free rows. Any other name (e.g. "c.1") becomes group without dimensions.
+ *
+ */
+class ModelReader {
+
+	friend class Solver;
+
+private:
+
+	//************************************ PRIVATE CONSTANT FIELDS *************************************//
+
+	/** @brief Minimal size of piece of section that is parsed by separate thread.
+	 *
+	 */
+	const static size_t MIN_PIECE_SIZE { 1 << 16 };
+
+	/** @brief Ratio of number of elements of folded group to number of names of group found in file
+	 * above which folding is reported (most of elements of such group are missing in file).
+	 *
+	 */
+	const static VarIdx MAX_GROUP_SPARSITY { 16 };
+
+	/** @brief Number of elements of folded group that is never reported, regardless of #MAX_GROUP_SPARSITY.
+	 *
+	 */
+	const static VarIdx MIN_SPARSE_GROUP { 1024 };
+
+	/** @brief Name of group of unnamed constraints of LP file (they are named "c[1]", "c[2]", ...).
+	 *
+	 */
+	static const char* const UNNAMED_ROWS;
+
+	//****************************************** CLASS TYPES *******************************************//
+
+	/** @brief Part of mapped file (e.g. token or name).
+	 *
+	 */
+	struct Token {
+
+		const char* begin;
+
+		size_t length;
+
+	};
+
+	/** @brief Sections of model files (the ones that are not supported are rejected).
+	 *
+	 */
+	enum SectionType {
+		NAME,
+		OBJSENSE,
+		ROWS,
+		COLUMNS,
+		RHS,
+		RANGES,
+		BOUNDS,
+		MINIMIZE,
+		MAXIMIZE,
+		CONSTRAINTS,
+		GENERAL,
+		BINARY,
+		END,
+		UNSUPPORTED
+	};
+
+	/** @brief Section of file - its content begins just after header keyword and ends at the next header.
+	 *
+	 */
+	struct Section {
+
+		SectionType type;
+
+		/** @brief First character of header line (used to report errors).
+		 *
+		 */
+		const char* header;
+
+		const char* begin;
+
+		const char* end;
+
+	};
+
+	/** @brief Group of columns (or rows) folded from names found in file.
+	 *
+	 */
+	struct Group {
+
+		std::string name;
+
+		/** @brief The greatest index found in every dimension.
+		 *
+		 */
+		VarIndexTuple extents;
+
+		/** @brief Number of names of group found in file (repetitions included).
+		 *
+		 */
+		size_t numberOfNames;
+
+		/** @brief Index of the first element of group (set when folding is finished).
+		 *
+		 */
+		VarIdx beginIdx;
+
+		/** @brief Dimensions of group (set when folding is finished).
+		 *
+		 */
+		VarDimensionTable dimensions;
+
+		/** @brief Type of columns of group (@see finishColumns()).
+		 *
+		 */
+		ValueType type;
+
+	};
+
+	/** @brief Names of columns (or rows) folded into groups.
+	 *
+	 */
+	struct Folder {
+
+		/** @brief Groups in order of the first appearance of their names.
+		 *
+		 */
+		std::vector<Group> groups;
+
+		/** @brief Position of every group in #groups.
+		 *
+		 */
+		std::unordered_map<std::string, size_t> positions;
+
+		/** @brief Number of elements of all groups (set when folding is finished).
+		 *
+		 */
+		VarIdx numberOfElements;
+
+		/** @brief Position of group of the last added name.
+		 *
+		 */
+		size_t hint;
+
+	};
+
+	/** @brief Piece of section parsed by single thread.
+	 *
+	 * @details Columns (and rows of LP) are referenced by their ordinal numbers within piece until
+	 * all names are folded - then they are translated in place into indexes of model.
+	 *
+	 */
+	struct Piece {
+
+		const char* begin;
+
+		const char* end;
+
+		/** @brief Names of columns in order of appearance (MPS: runs of lines of the same column).
+		 *
+		 */
+		std::vector<Token> columnNames;
+
+		/** @brief State of 'MARKER' section of every run of column (MPS: -1 if it is known only to previous pieces).
+		 *
+		 */
+		std::vector<signed char> columnMarkers;
+
+		/** @brief State of 'MARKER' section at the end of piece (MPS: -1 if piece does not contain any marker).
+		 *
+		 */
+		signed char marker;
+
+		/** @brief Ordinal number of every name of column (LP).
+		 *
+		 */
+		std::unordered_map<std::string, VarIdx> columnOrdinals;
+
+		/** @brief Index of column of every entry of #columnNames (set when names are folded).
+		 *
+		 */
+		std::vector<VarIdx> columnIdx;
+
+		/** @brief Names of constraints (LP: empty names for unnamed constraints).
+		 *
+		 */
+		std::vector<Token> rowNames;
+
+		/** @brief Bounds of constraints (LP).
+		 *
+		 */
+		std::vector<VarValue> rowLowerBounds;
+
+		std::vector<VarValue> rowUpperBounds;
+
+		/** @brief Index of row of every entry of #rowNames (set when names are folded).
+		 *
+		 */
+		std::vector<RowIdx> rowIdx;
+
+		/** @brief Coefficients of objective function (ordinal number of column, coefficient).
+		 *
+		 */
+		std::vector<std::pair<VarIdx, VarValue>> objective;
+
+		/** @brief Coefficients of constraints (rows are indexes for MPS and ordinal numbers for LP).
+		 *
+		 */
+		std::vector<RowIdx> elementRowIdx;
+
+		std::vector<VarIdx> elementColumnIdx;
+
+		std::vector<VarValue> elementValue;
+
+	};
+
+	//***************************************** CLASS FIELDS *******************************************//
+
+	/** @brief Format of read file.
+	 *
+	 */
+	ModelFormat format;
+
+	/** @brief Number of threads that parse file.
+	 *
+	 */
+	unsigned int numberOfThreads;
+
+	/** @brief Name of read file (for logging).
+	 *
+	 */
+	std::string fileName;
+
+	/** @brief Mapping of read file (nothing is mapped if file is compressed).
+	 *
+	 */
+	TensorFileUtils::Mapping mapping;
+
+	/** @brief Inflated content of compressed file.
+	 *
+	 */
+	std::vector<char> content;
+
+	/** @brief First character of file content.
+	 *
+	 */
+	const char* begin;
+
+	/** @brief Character following the last character of file content.
+	 *
+	 */
+	const char* end;
+
+	/** @brief Infinity of the solver - bounds not lower than it (not greater than its negation) are infinite.
+	 *
+	 */
+	VarValue infinity;
+
+	/** @brief Set when objective function is maximized (coefficients are negated).
+	 *
+	 */
+	bool maximize;
+
+	/** @brief Name of objective function (MPS: the first row of type N).
+	 *
+	 */
+	Token objectiveName;
+
+	Folder columns;
+
+	Folder rows;
+
+	/** @brief Pieces of the main section of file (COLUMNS of MPS, Subject To of LP).
+	 *
+	 */
+	std::vector<Piece> pieces;
+
+	/** @brief Coefficients of objective function of LP file.
+	 *
+	 */
+	Piece objectivePiece;
+
+	/** @brief Bounds, objective coefficients and types (-1 if column was not found in file) of folded columns.
+	 *
+	 */
+	std::vector<VarValue> columnLowerBounds;
+
+	std::vector<VarValue> columnUpperBounds;
+
+	std::vector<VarValue> columnObjective;
+
+	std::vector<signed char> columnTypes;
+
+	/** @brief Bounds of folded rows.
+	 *
+	 */
+	std::vector<VarValue> rowLowerBounds;
+
+	std::vector<VarValue> rowUpperBounds;
+
+	/** @brief Types of rows of MPS file ('N' for rows that are not found in file).
+	 *
+	 */
+	std::vector<char> rowTypes;
+
+	/** @brief Right-hand sides and ranges of rows of MPS file (ranges are NaN for rows without range).
+	 *
+	 */
+	std::vector<VarValue> rowRhs;
+
+	std::vector<VarValue> rowRanges;
+
+	//*************************************** PRIVATE FUNCTIONS ****************************************//
+
+	/** @brief Logs line of file that contains given position and throws ModelFileException.
+	 *
+	 * @param position
+	 *
+	 * @throw ModelExceptions::ModelFileException always.
+	 */
+	void fail(const char* position) const throw (ModelExceptions::ModelFileException);
+
+	/** @brief Splits given line into tokens separated by blanks.
+	 *
+	 * @param position first character of line
+	 * @param end character following the last character of line
+	 * @param tokens
+	 * @param maxNumberOfTokens
+	 * @return number of tokens (maxNumberOfTokens + 1 if line contains more tokens)
+	 */
+	static size_t tokenize(const char* position, const char* end, Token* tokens,
+			const size_t maxNumberOfTokens);
+
+	/** @brief Maps (or inflates) given file into memory.
+	 *
+	 * @param fileName
+	 *
+	 * @throw ModelExceptions::ModelFileException if file cannot be read.
+	 */
+	void open(const std::string& fileName) throw (ModelExceptions::ModelFileException);
+
+	/** @brief Unmaps file and releases its content.
+	 *
+	 */
+	void close();
+
+	/** @brief Returns type of section whose header line begins at given position
+	 * (nullptr if line is not a header), content of section begins at returned position.
+	 *
+	 * @param line first character of line
+	 * @param type
+	 * @return
+	 */
+	const char* parseHeader(const char* line, SectionType& type) const;
+
+	/** @brief Finds headers of all sections of file in parallel.
+	 *
+	 * @return sections in order of their appearance
+	 */
+	std::vector<Section> findSections() const;
+
+	/** @brief Splits given part of file into one piece for every thread (some of them may be empty).
+	 *
+	 * @details Pieces begin at lines for which given predicate is true.
+	 *
+	 * @param begin
+	 * @param end
+	 * @param isPieceBegin
+	 */
+	template<typename Predicate>
+	void split(const char* begin, const char* end, Predicate isPieceBegin);
+
+	/** @brief Runs worker(piece, p) for every piece of #pieces in parallel.
+	 *
+	 * @param worker
+	 *
+	 * @throw any exception thrown by worker (the first one).
+	 */
+	template<typename Worker>
+	void forEachPiece(Worker worker);
+
+	/** @brief Parses given name of column (row) into name of group and indexes.
+	 *
+	 * @param name
+	 * @param definition
+	 */
+	void parseName(const Token& name, StringUtils::Definition<VarDimIdx>& definition) const;
+
+	/** @brief Folds given name into group of given folder.
+	 *
+	 * @param folder
+	 * @param name
+	 *
+	 * @throw ModelExceptions::ModelFileException if name has different number of indexes than other names of group.
+	 */
+	void addName(Folder& folder, const StringUtils::Definition<VarDimIdx>& definition)
+			throw (ModelExceptions::ModelFileException);
+
+	void addName(Folder& folder, const Token& name)
+			throw (ModelExceptions::ModelFileException);
+
+	/** @brief Assigns indexes to all groups of given folder.
+	 *
+	 * @param folder
+	 *
+	 * @throw ModelExceptions::ModelFileException if groups have more elements than VarIdx can index.
+	 */
+	void fold(Folder& folder) throw (ModelExceptions::ModelFileException);
+
+	/** @brief Finds index of column (row) with given name in folded groups (thread-safe).
+	 *
+	 * @param folder
+	 * @param name
+	 * @param idx
+	 * @param hint position of group of previous name (updated)
+	 * @return false if there is no such name
+	 */
+	bool findName(const Folder& folder, const Token& name, VarIdx& idx,
+			size_t& hint) const;
+
+	/** @brief Creates arrays of bounds, objective coefficients and types of folded columns.
+	 *
+	 */
+	void initializeColumns();
+
+	/** @brief Sets types of groups of columns from types of their columns.
+	 *
+	 */
+	void finishColumns();
+
+	/** @brief Translates ordinal numbers of columns of pieces into indexes of folded columns in parallel.
+	 *
+	 */
+	void resolveColumns();
+
+	/** @brief Parses ROWS section of MPS file.
+	 *
+	 * @param section
+	 */
+	void parseMpsRows(const Section& section);
+
+	/** @brief Parses piece of COLUMNS section of MPS file (called in parallel).
+	 *
+	 * @param piece
+	 */
+	void parseMpsColumns(Piece& piece) const;
+
+	/** @brief Parses RHS or RANGES section of MPS file.
+	 *
+	 * @param section
+	 * @param values right-hand sides or ranges of rows
+	 */
+	void parseMpsValues(const Section& section, std::vector<VarValue>& values) const;
+
+	/** @brief Parses BOUNDS section of MPS file.
+	 *
+	 * @param section
+	 */
+	void parseMpsBounds(const Section& section);
+
+	/** @brief Reads the whole MPS file.
+	 *
+	 * @param sections
+	 */
+	void readMps(const std::vector<Section>& sections);
+
+	/** @brief Parses linear expression of LP file until comparison operator or end of given part of file.
+	 *
+	 * @param position first character of expression (updated)
+	 * @param end
+	 * @param piece piece that collects names of columns
+	 * @param coefficients terms of expression (ordinal number of column, coefficient)
+	 * @return false if expression is not valid
+	 */
+	bool parseLpExpression(const char*& position, const char* end, Piece& piece,
+			std::vector<std::pair<VarIdx, VarValue>>& coefficients) const;
+
+	/** @brief Parses piece of Subject To section of LP file (called in parallel).
+	 *
+	 * @param piece
+	 */
+	void parseLpConstraints(Piece& piece) const;
+
+	/** @brief Parses Bounds section of LP file.
+	 *
+	 * @details Section is parsed twice: names are folded at first, bounds are set when all names are folded.
+	 *
+	 * @param section
+	 * @param assign if false only names are folded
+	 */
+	void parseLpBounds(const Section& section, const bool assign);
+
+	/** @brief Parses General or Binary section of LP file (@see parseLpBounds()).
+	 *
+	 * @param section
+	 * @param assign if false only names are folded
+	 */
+	void parseLpTypes(const Section& section, const bool assign);
+
+	/** @brief Reads the whole LP file.
+	 *
+	 * @param sections
+	 */
+	void readLp(const std::vector<Section>& sections);
+
+	/** @brief Reads given file.
+	 *
+	 * @param fileName
+	 *
+	 * @throw ModelExceptions::ModelFileException if file cannot be read or it is not a valid model file.
+	 */
+	void read(const std::string& fileName)
+			throw (ModelExceptions::ModelFileException);
+
+	/** @brief Assigns bounds, objective coefficients and coefficients of read model to columns and rows
+	 * of given problem instance (groups of read model have to be already added to it).
+	 *
+	 * @param problemInstance
+	 * @param firstColumnIdx index of the first column of read model in problem instance
+	 * @param firstRowIdx index of the first row of read model in problem instance
+	 */
+	void load(OsiProblemInstance* problemInstance, const VarIdx firstColumnIdx,
+			const RowIdx firstRowIdx);
+
+	//************************************ CONSTRUCTOR & DESTRUCTOR ************************************//
+
+	/** @brief Creates reader of given format.
+	 *
+	 * @param format
+	 * @param numberOfThreads
+	 * @param infinity infinity of the solver
+	 */
+	ModelReader(const ModelFormat format, const unsigned int numberOfThreads,
+			const VarValue infinity);
+
+public:
+
+	//************************************* PUBLIC CONSTANT FIELDS *************************************//
+
+	//************************************ CONSTRUCTOR & DESTRUCTOR ************************************//
+
+	virtual ~ModelReader();
+
+	//*************************************** PUBLIC FUNCTIONS *****************************************//
+
+	//*************************************** GETTERS & SETTERS ****************************************//
+
+};
+
+#endif /* MODELREADER_HPP_ */
@@ -0,0 +1,359 @@
+/*
+ * ModelSnapshot.hpp
+ *
+ *  Created on: 17 paź 2026
+ *      Author: tomasz
+ */
+
+#ifndef MODELSNAPSHOT_HPP_
+#define MODELSNAPSHOT_HPP_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#include "DimensionTable.hpp"
+#include "exp/ModelExeptions.hpp"
+#include "Typedefs.hpp"
+#include "utils/TensorFileUtils.hpp"
+
+class OsiProblemInstance;
+
+/** @brief Versioned binary snapshot of the whole model (@see Solver::saveSnapshot(), Solver::loadSnapshot()).
+ *
+ * @details Snapshot holds groups of variables, rows and parameters (names, dimensions and indexes of their
+ * first elements), bounds, types, values and objective coefficients of columns, bounds of rows, values
+ * of parameters and coefficients of rows in compressed column-major (CSC) form. File is written as:
+ * @code
+ * 	offset	size			field
+ * 	0		8				magic "SPPSNAP\0"
+ * 	8		4 (uint32)		version (1)
+ * 	12		4 (uint32)		byte order mark (0x01020304)
+ * 	16		8 (uint64)		number of columns
+ * 	24		8 (uint64)		number of rows
+ * 	32		8 (uint64)		number of coefficients
+ * 	40		8 (uint64)		number of groups
+ * 	48		8 (uint64)		number of parameters
+ * 	56		8 (uint64)		size of file
+ * 	64		16 * 12			offset and size (in bytes) of every array (@see Array)
+ * @endcode
+ * Every array starts at multiple of #ALIGNMENT bytes. Numbers are kept in native byte order of the machine
+ * that has written snapshot (file written on machine with other byte order is rejected by byte order mark),
+ * so snapshot is never parsed - file is mapped into memory, arrays are found by their offsets and copied
+ * straight into the model. Coefficients are expanded back into triplets of CoefficientMatrix by all threads.
+ *
+ * Array Array::GROUPS holds records of groups (@see GroupRecord), each of them followed by extents
+ * of group (uint32), its name and zero padding to 8 bytes.
+ *
+ */
+class ModelSnapshot {
+
+	friend class Solver;
+
+private:
+
+	//************************************ PRIVATE CONSTANT FIELDS *************************************//
+
+	/** @brief First bytes of every snapshot file.
+	 *
+	 */
+	static const char MAGIC[8];
+
+	/** @brief Version of format of snapshot file.
+	 *
+	 */
+	const static uint32_t VERSION { 1 };
+
+	/** @brief Number written in native byte order - it is read back as the same number only on machine
+	 * with the same byte order.
+	 *
+	 */
+	const static uint32_t BYTE_ORDER_MARK { 0x01020304 };
+
+	/** @brief Alignment (in bytes) of every array in file.
+	 *
+	 */
+	const static uint64_t ALIGNMENT { 64 };
+
+	//****************************************** CLASS TYPES *******************************************//
+
+	/** @brief Arrays of snapshot in order in which they are written.
+	 *
+	 */
+	enum Array {
+		GROUPS, //!< records of groups (@see GroupRecord)
+		OBJECTIVE, //!< objective coefficients of columns (double)
+		COLUMN_LOWER_BOUNDS, //!< lower bounds of columns (double)
+		COLUMN_UPPER_BOUNDS, //!< upper bounds of columns (double)
+		COLUMN_FIXED, //!< flags of fixed columns (1 byte each)
+		COLUMN_VALUES, //!< values of columns (double)
+		ROW_LOWER_BOUNDS, //!< lower bounds of rows (double)
+		ROW_UPPER_BOUNDS, //!< upper bounds of rows (double)
+		COLUMN_STARTS, //!< positions of the first coefficient of every column and number of coefficients (uint64)
+		ROW_INDEXES, //!< rows of coefficients (uint32)
+		ELEMENT_VALUES, //!< values of coefficients (double)
+		PARAMETER_VALUES, //!< values of parameters of all groups (double)
+		NUMBER_OF_ARRAYS
+	};
+
+	/** @brief Kind of group of snapshot.
+	 *
+	 */
+	enum GroupKind {
+		VARIABLES = 1, ROWS = 2, PARAMETERS = 3
+	};
+
+	/** @brief Position and size (in bytes) of array in file.
+	 *
+	 */
+	struct ArrayEntry {
+
+		uint64_t offset;
+
+		uint64_t size;
+
+	};
+
+	/** @brief Header of snapshot file.
+	 *
+	 */
+	struct Header {
+
+		char magic[8];
+
+		uint32_t version;
+
+		uint32_t byteOrderMark;
+
+		uint64_t numberOfColumns;
+
+		uint64_t numberOfRows;
+
+		uint64_t numberOfElements;
+
+		uint64_t numberOfGroups;
+
+		uint64_t numberOfParameters;
+
+		uint64_t fileSize;
+
+		ArrayEntry arrays[NUMBER_OF_ARRAYS];
+
+	};
+
+	/** @brief Record of group in array Array::GROUPS.
+	 *
+	 */
+	struct GroupRecord {
+
+		/** @brief Kind of group (@see GroupKind).
+		 *
+		 */
+		uint32_t kind;
+
+		/** @brief Type of variables or parameters (@see ValueType).
+		 *
+		 */
+		uint32_t type;
+
+		uint32_t numberOfDimensions;
+
+		uint32_t nameLength;
+
+		/** @brief Index of the first column (row) of group or position of the first value of group
+		 * in array Array::PARAMETER_VALUES.
+		 *
+		 */
+		uint64_t beginIdx;
+
+		/** @brief Lower bound of parameters (unused by other groups).
+		 *
+		 */
+		double lowerBound;
+
+		/** @brief Upper bound of parameters (unused by other groups).
+		 *
+		 */
+		double upperBound;
+
+	};
+
+	/** @brief Group of snapshot.
+	 *
+	 */
+	struct Group {
+
+		GroupKind kind;
+
+		std::string name;
+
+		VarIndexTuple extents;
+
+		/** @brief Index of the first column (row) of group or position of the first value of group
+		 * in array Array::PARAMETER_VALUES.
+		 *
+		 */
+		uint64_t beginIdx;
+
+		ValueType type;
+
+		ParamValue lowerBound;
+
+		ParamValue upperBound;
+
+		/** @brief Values of parameters of group (nullptr for other groups).
+		 *
+		 */
+		const ParamValue* values;
+
+	};
+
+	//***************************************** CLASS FIELDS *******************************************//
+
+	/** @brief Groups of snapshot.
+	 *
+	 */
+	std::vector<Group> groups;
+
+	/** @brief Number of values of parameters of all groups.
+	 *
+	 */
+	uint64_t numberOfParameters;
+
+	/** @brief Mapping of read snapshot file (@see read()).
+	 *
+	 */
+	TensorFileUtils::Mapping mapping;
+
+	/** @brief Header of read snapshot file (points into #mapping).
+	 *
+	 */
+	const Header* header;
+
+	/** @brief Number of threads that validate and load coefficients.
+	 *
+	 */
+	unsigned int numberOfThreads;
+
+	//*************************************** PRIVATE FUNCTIONS ****************************************//
+
+	/** @brief Returns given array of read snapshot file.
+	 *
+	 * @param array
+	 * @return
+	 */
+	template<typename T>
+	const T* getArray(const Array array) const {
+		return reinterpret_cast<const T*>(static_cast<const char*>(this->mapping.address)
+				+ this->header->arrays[array].offset);
+	}
+
+	/** @brief Checks header of read snapshot file and positions and sizes of its arrays.
+	 *
+	 * @return
+	 */
+	bool validateHeader() const;
+
+	/** @brief Reads groups of read snapshot file and checks that they fit into the model.
+	 *
+	 * @return
+	 */
+	bool readGroups();
+
+	/** @brief Checks that compressed coefficients of read snapshot file are well formed.
+	 *
+	 * @return
+	 */
+	bool validateCoefficients() const;
+
+	/** @brief Adds group of variables to saved snapshot.
+	 *
+	 * @param name
+	 * @param dimensions
+	 * @param beginIdx
+	 * @param type
+	 */
+	void addVariableGroup(const std::string& name,
+			const VarDimensionTable& dimensions, const VarIdx beginIdx,
+			const ValueType type);
+
+	/** @brief Adds group of rows to saved snapshot.
+	 *
+	 * @param name
+	 * @param dimensions
+	 * @param beginIdx
+	 */
+	void addRowGroup(const std::string& name,
+			const RowDimensionTable& dimensions, const RowIdx beginIdx);
+
+	/** @brief Adds group of parameters to saved snapshot.
+	 *
+	 * @param name
+	 * @param dimensions
+	 * @param lowerBound
+	 * @param upperBound
+	 * @param type
+	 * @param values values of parameters (have to exist as long as snapshot)
+	 */
+	void addParamGroup(const std::string& name,
+			const ParamDimensionTable& dimensions, const ParamValue lowerBound,
+			const ParamValue upperBound, const ValueType type,
+			const ParamValue* values);
+
+	/** @brief Writes added groups and model of given problem instance into given file.
+	 *
+	 * @details Snapshot is written into temporary file which replaces given file when it is complete,
+	 * so existing snapshot is never left partially overwritten.
+	 *
+	 * @param fileName
+	 * @param problemInstance
+	 *
+	 * @throw ModelExceptions::SnapshotFileException if file cannot be written.
+	 */
+	void write(const std::string& fileName,
+			const OsiProblemInstance* problemInstance) const
+					throw (ModelExceptions::SnapshotFileException);
+
+	/** @brief Maps given snapshot file and reads its groups.
+	 *
+	 * @param fileName
+	 *
+	 * @throw ModelExceptions::SnapshotFileException if file cannot be read or it is not a valid snapshot file.
+	 */
+	void read(const std::string& fileName)
+			throw (ModelExceptions::SnapshotFileException);
+
+	/** @brief Copies columns, rows and coefficients of read snapshot into given (empty) problem instance.
+	 *
+	 * @param problemInstance
+	 */
+	void load(OsiProblemInstance* problemInstance) const;
+
+	//************************************ CONSTRUCTOR & DESTRUCTOR ************************************//
+
+	/** @brief Creates empty snapshot.
+	 *
+	 * @param numberOfThreads
+	 */
+	explicit ModelSnapshot(const unsigned int numberOfThreads);
+
+public:
+
+	//************************************* PUBLIC CONSTANT FIELDS *************************************//
+
+	//************************************ CONSTRUCTOR & DESTRUCTOR ************************************//
+
+	virtual ~ModelSnapshot();
+
+	//*************************************** PUBLIC FUNCTIONS *****************************************//
+
+	//*************************************** GETTERS & SETTERS ****************************************//
+
+	size_t getNumberOfGroups() const {
+		return this->groups.size();
+	}
+
+};
+
+#endif /* MODELSNAPSHOT_HPP_ */
@@ -0,0 +1,367 @@
+/*
+ * ModelWriter.hpp
+ *
+ *  Created on: 17 paź 2026
+ *      Author: tomasz
+ */
+
+#ifndef MODELWRITER_HPP_
+#define MODELWRITER_HPP_
+
+#include <stddef.h>
+#include <stdio.h>
+#include <zlib.h>
+#include <string>
+#include <vector>
+
+#include "DimensionTable.hpp"
+#include "exp/ModelExeptions.hpp"
+#include "Typedefs.hpp"
+
+class OsiProblemInstance;
+
+/** @brief Streaming writer of model into free MPS or CPLEX LP file (@see Solver::writeModel()).
+ *
+ * @details Model is written straight from arrays of OsiProblemInstance - it does not have to be loaded
+ * into the solver. Text is formatted into single buffer of #BUFFER_SIZE bytes which is passed to the file
+ * (or to gzip stream) whenever it is full, so memory used by writer does not depend on size of model.
+ * Coefficients are read through compressed views of CoefficientMatrix: column-major for MPS
+ * and row-major for LP (@see OsiProblemInstance::getColumnCoefficients(), OsiProblemInstance::getRowCoefficients()).
+ *
+ * Names of columns and rows are never requested from groups (@see VariableIdxMapper::getVariableName()) -
+ * writer formats them in place from name and dimensions of group, e.g. "x[2][3]" (MPS) or "x(2)(3)" (LP).
+ * Objective function is written as row #OBJECTIVE_NAME.
+ *
+ */
+class ModelWriter {
+
+	friend class Solver;
+
+private:
+
+	//************************************ PRIVATE CONSTANT FIELDS *************************************//
+
+	/** @brief Size of buffer of formatted text.
+	 *
+	 */
+	const static size_t BUFFER_SIZE { 1 << 20 };
+
+	/** @brief Length of line of LP file after which the next term is written in a new line
+	 * (CPLEX LP format does not allow lines longer than 510 characters).
+	 *
+	 */
+	const static size_t LINE_LENGTH { 200 };
+
+	/** @brief Maximal number of decimal digits of numbers that are formatted without printf (@see putNumber()).
+	 *
+	 */
+	const static size_t MAX_DECIMAL_DIGITS { 6 };
+
+	/** @brief Name of objective function.
+	 *
+	 */
+	static const char* const OBJECTIVE_NAME;
+
+	//****************************************** CLASS TYPES *******************************************//
+
+	/** @brief Group of columns (or rows) whose names are generated by writer.
+	 *
+	 */
+	struct NameGroup {
+
+		/** @brief Index of the first column (row) of group.
+		 *
+		 */
+		VarIdx beginIdx;
+
+		/** @brief Index following the last column (row) of group.
+		 *
+		 */
+		VarIdx endIdx;
+
+		/** @brief Base name of group.
+		 *
+		 */
+		const std::string* name;
+
+		/** @brief Dimensions of group.
+		 *
+		 */
+		const VarDimensionTable* dimensions;
+
+		/** @brief Type of columns of group (ValueType::DOUBLE for rows).
+		 *
+		 */
+		ValueType type;
+
+	};
+
+	//***************************************** CLASS FIELDS *******************************************//
+
+	/** @brief Problem instance that is written.
+	 *
+	 */
+	const OsiProblemInstance* problemInstance;
+
+	/** @brief Format of written file.
+	 *
+	 */
+	ModelFormat format;
+
+	/** @brief Groups of columns sorted by index of their first column.
+	 *
+	 */
+	std::vector<NameGroup> columnGroups;
+
+	/** @brief Groups of rows sorted by index of their first row.
+	 *
+	 */
+	std::vector<NameGroup> rowGroups;
+
+	/** @brief Name formatted by putName() (kept so formatting does not allocate memory).
+	 *
+	 */
+	std::string name;
+
+	/** @brief Written file (nullptr if file is compressed or closed).
+	 *
+	 */
+	FILE* file;
+
+	/** @brief Written gzip stream (nullptr if file is not compressed or closed).
+	 *
+	 */
+	gzFile compressedFile;
+
+	/** @brief Buffer of formatted text.
+	 *
+	 */
+	char* buffer;
+
+	/** @brief Number of characters in #buffer.
+	 *
+	 */
+	size_t position;
+
+	/** @brief Number of characters written since the last new line.
+	 *
+	 */
+	size_t lineLength;
+
+	/** @brief Number of characters written so far (before compression).
+	 *
+	 */
+	size_t numberOfBytes;
+
+	/** @brief Set when any write to file has failed.
+	 *
+	 */
+	bool failed;
+
+	/** @brief Infinity of the solver - bounds not lower than it (not greater than its negation) are infinite.
+	 *
+	 */
+	VarValue infinity;
+
+	/** @brief Index of group of the last written name of column (@see putName()).
+	 *
+	 */
+	size_t columnHint;
+
+	/** @brief Index of group of the last written name of row (@see putName()).
+	 *
+	 */
+	size_t rowHint;
+
+	//*************************************** PRIVATE FUNCTIONS ****************************************//
+
+	/** @brief Passes content of #buffer to the file.
+	 *
+	 */
+	void flush();
+
+	/** @brief Appends given characters.
+	 *
+	 * @param text
+	 * @param length
+	 */
+	void put(const char* text, const size_t length);
+
+	/** @brief Appends given null-terminated text.
+	 *
+	 * @param text
+	 */
+	void put(const char* text);
+
+	/** @brief Appends single character.
+	 *
+	 * @param c
+	 */
+	void put(const char c) {
+		if (this->position == BUFFER_SIZE) {
+			flush();
+		}
+		this->buffer[this->position++] = c;
+		this->lineLength += 1;
+	}
+
+	/** @brief Ends current line.
+	 *
+	 */
+	void newLine() {
+		put('\n');
+		this->lineLength = 0;
+	}
+
+	/** @brief Appends given unsigned integer.
+	 *
+	 * @param value
+	 */
+	void putUnsigned(unsigned long long value);
+
+	/** @brief Appends given number in the shortest form that is read back as exactly the same value.
+	 *
+	 * @param value
+	 */
+	void putNumber(const VarValue value);
+
+	/** @brief Finds group of column (or row) with given index.
+	 *
+	 * @details Group is searched for only when it is not the group of previous element.
+	 *
+	 * @param groups
+	 * @param idx
+	 * @param hint index of group of previous element (updated)
+	 * @return false if element does not belong to any group
+	 */
+	bool findGroup(const std::vector<NameGroup>& groups, const VarIdx idx,
+			size_t& hint) const;
+
+	/** @brief Formats name of column (or row) with given index.
+	 *
+	 * @details Element that does not belong to any group is named by its prefix followed by its index.
+	 *
+	 * @param groups
+	 * @param idx
+	 * @param hint index of group of previous element (updated)
+	 * @param prefix prefix of names of elements without group
+	 * @param name output name
+	 */
+	void formatName(const std::vector<NameGroup>& groups, const VarIdx idx,
+			size_t& hint, const char prefix, std::string& name) const;
+
+	/** @brief Appends name of column (or row) with given index (@see formatName()).
+	 *
+	 * @param groups
+	 * @param idx
+	 * @param hint index of group of previous element (updated)
+	 * @param prefix prefix of names of elements without group
+	 */
+	void putName(const std::vector<NameGroup>& groups, const VarIdx idx,
+			size_t& hint, const char prefix);
+
+	void putColumnName(const VarIdx columnIdx) {
+		putName(this->columnGroups, columnIdx, this->columnHint, 'C');
+	}
+
+	void putRowName(const RowIdx rowIdx) {
+		putName(this->rowGroups, rowIdx, this->rowHint, 'R');
+	}
+
+	/** @brief Appends signed term of LP expression (e.g. " - 2 x(1)"), starting a new line if current one is too long.
+	 *
+	 * @param coefficient
+	 * @param columnIdx
+	 */
+	void putTerm(const VarValue coefficient, const VarIdx columnIdx);
+
+	/** @brief Returns type of given column.
+	 *
+	 * @param columnIdx
+	 * @return
+	 */
+	ValueType getColumnType(const VarIdx columnIdx);
+
+	/** @brief Returns bounds of given column as they are passed to the solver (fixed columns are bounded by their values).
+	 *
+	 * @param columnIdx
+	 * @param lowerBound
+	 * @param upperBound
+	 */
+	void getColumnBounds(const VarIdx columnIdx, VarValue& lowerBound,
+			VarValue& upperBound) const;
+
+	bool isFinite(const VarValue value) const {
+		return value > -this->infinity && value < this->infinity;
+	}
+
+	/** @brief Writes the whole model in free MPS format.
+	 *
+	 */
+	void writeMps();
+
+	/** @brief Writes the whole model in CPLEX LP format.
+	 *
+	 */
+	void writeLp();
+
+	/** @brief Closes file.
+	 *
+	 */
+	void close();
+
+	/** @brief Adds group of columns whose names are generated from its name and dimensions.
+	 *
+	 * @param name base name of group (has to exist as long as writer)
+	 * @param dimensions dimensions of group (have to exist as long as writer)
+	 * @param beginIdx index of the first column of group
+	 * @param type type of columns of group
+	 */
+	void addColumnGroup(const std::string& name,
+			const VarDimensionTable& dimensions, const VarIdx beginIdx,
+			const ValueType type);
+
+	/** @brief Adds group of rows whose names are generated from its name and dimensions.
+	 *
+	 * @param name base name of group (has to exist as long as writer)
+	 * @param dimensions dimensions of group (have to exist as long as writer)
+	 * @param beginIdx index of the first row of group
+	 */
+	void addRowGroup(const std::string& name,
+			const RowDimensionTable& dimensions, const RowIdx beginIdx);
+
+	/** @brief Writes model into given file.
+	 *
+	 * @param fileName
+	 * @param compressed if true file is compressed by gzip
+	 *
+	 * @throw ModelExceptions::ModelFileException if file cannot be written.
+	 */
+	void write(const std::string& fileName, const bool compressed)
+			throw (ModelExceptions::ModelFileException);
+
+	//************************************ CONSTRUCTOR & DESTRUCTOR ************************************//
+
+	/** @brief Creates writer of given problem instance.
+	 *
+	 * @param problemInstance
+	 * @param format
+	 */
+	ModelWriter(const OsiProblemInstance* problemInstance,
+			const ModelFormat format);
+
+public:
+
+	//************************************* PUBLIC CONSTANT FIELDS *************************************//
+
+	//************************************ CONSTRUCTOR & DESTRUCTOR ************************************//
+
+	virtual ~ModelWriter();
+
+	//*************************************** PUBLIC FUNCTIONS *****************************************//
+
+	//*************************************** GETTERS & SETTERS ****************************************//
+
+};
+
+#endif /* MODELWRITER_HPP_ */
@@ -8,9 +8,19 @@
 #ifndef OSIPROBLEMINSTANCE_HPP_
 #define OSIPROBLEMINSTANCE_HPP_
 
+#include <stddef.h>
+#include <atomic>
+#include <vector>
+
+#include "BoundsReport.hpp"
+#include "CoefficientMatrix.hpp"
+#include "Scenario.hpp"
+#include "Solution.hpp"
+#include "SolveHandle.hpp"
 #include "Typedefs.hpp"
 
 class OsiSolverInterface;
+class Presolve;
 
 /** Instance of LP/MIP optimization problem.
  *
@@ -43,13 +53,22 @@ class OsiSolverInterface;
  * numberOfRows		-	2			// 2 linear equations/inequalities
  * row_lb			-	{-∞,-∞}		// Lower bounds for left-hand side expressions in 1st and 2nd row
  * row_ub			-	{ 3, 3}		// Upper bounds for left-hand side expressions in 1st and 2nd row
+ * coefficients		-	{(0,0,1), (0,1,2), (1,0,2), (1,1,1)}	// (row, column, value) triplets (@see CoefficientMatrix)
 
  */
 class OsiProblemInstance {
+
+	friend class ModelSnapshot;
+
 private:
 
 	//************************************ PRIVATE CONSTANT FIELDS *************************************//
 
+	/** Names of solver engines in order of SolverInterface enumeration (used for logging).
+	 *
+	 */
+	static const char* const SOLVER_INTERFACE_NAMES[];
+
 	//***************************************** CLASS FIELDS *******************************************//
 
 	/** Open Solver Interface
@@ -59,6 +78,11 @@ private:
 	 */
 	OsiSolverInterface *si;
 
+	/** Solver engine behind #si.
+	 *
+	 */
+	SolverInterface solverInterface;
+
 	/** Number of columns.
 	 *
 	 * Number of unique variables with their coefficients
@@ -67,15 +91,23 @@ private:
 	 */
 	VarIdx numberOfColumns;
 
+	/** Number of columns that column arrays can hold without being reallocated.
+	 *
+	 * Column arrays (#objective, #col_lb, #col_ub, #col_fixed, #col_integer, #col_value, #col_dirty) grow geometrically
+	 * so creating new group of variables costs a few bulk allocations
+	 * (or none at all if there is enough space left) regardless of the size of that group.
+	 *
+	 */
+	VarIdx columnsCapacity;
+
 	/** Array of objective function coefficients.
 	 *
 	 * Each variable must have it's own coefficients
 	 * in objective function (in case the variable has no influence
 	 * on objective function's value then coefficient would be 0).
 	 *
-	 * After calling s->solve(LP) or s->solve(MIP) (@see Solver) each pair
-	 * of variable and it's coefficient will be mapped into this array
-	 * letting chosen solver to solve instance of a given problem.
+	 * Array is indexed by column index of variable (@see VariableIdxMapper::beginIdx)
+	 * and it is a primary storage of objective coefficients - Variable class is only a view into it.
 	 *
 	 */
 	VarValue* objective;
@@ -85,8 +117,7 @@ private:
 	 * Each variable has to have it's own lower bound
 	 * and it cannot take lower value than it's LB.
 	 *
-	 * After calling s->solve(LP) or s->solve(MIP) (@see Solver) each variable's lower bound
-	 * will be mapped into this array letting chosen solver to solve instance of a given problem.
+	 * Array is indexed by column index of variable (@see VariableIdxMapper::beginIdx).
 	 *
 	 */
 	VarValue* col_lb;
@@ -96,18 +127,55 @@ private:
 	 * Each variable has to have it's own upper bound
 	 * and it cannot take greater value than it's UB.
 	 *
-	 * After calling s->solve(LP) or s->solve(MIP) (@see Solver) each variable's upper bound
-	 * will be mapped into this array letting chosen solver to solve instance of a given problem.
+	 * Array is indexed by column index of variable (@see VariableIdxMapper::beginIdx).
 	 *
 	 */
 	VarValue* col_ub;
 
+	/** Array of flags that are set for every variable which value has been fixed.
+	 *
+	 * @see Variable::fixValue()
+	 *
+	 */
+	bool* col_fixed;
+
+	/** Array of flags that are set for every variable of integer or binary type.
+	 *
+	 * Integer columns are marked in the solver whenever they are passed to it, so problem with any of them
+	 * is solved by branch and bound (@see VariableIdxMapper::getType()).
+	 *
+	 */
+	bool* col_integer;
+
+	/** Array of variables' values.
+	 *
+	 * For fixed variables (@see #col_fixed) it holds a value given by the user,
+	 * for the others it will be filled during solving LP/MIP problem.
+	 *
+	 */
+	VarValue* col_value;
+
+	/** Array of flags that are set for every loaded column which bounds, objective coefficient
+	 * or fixed value has been changed since problem was passed to the solver.
+	 *
+	 * Indexes of such columns are listed in #dirtyColumns.
+	 *
+	 */
+	bool* col_dirty;
+
 	/** Number of rows.
 	 *
 	 * Number of linear equations/inequalities in LP problem and their bounds.
 	 *
 	 */
-	VarIdx numberOfRows;
+	RowIdx numberOfRows;
+
+	/** Number of rows that row arrays can hold without being reallocated.
+	 *
+	 * Row arrays (#row_lb, #row_ub, #row_dirty) grow geometrically in the same way as column arrays (@see #columnsCapacity).
+	 *
+	 */
+	RowIdx rowsCapacity;
 
 	/** Lower bound of equation/inequality in given row.
 	 *
@@ -127,6 +195,94 @@ private:
 	 */
 	VarValue* row_ub;
 
+	/** Array of flags that are set for every loaded row which bounds has been changed
+	 * since problem was passed to the solver.
+	 *
+	 * Indexes of such rows are listed in #dirtyRows.
+	 *
+	 */
+	bool* row_dirty;
+
+	/** Coefficients of variables in rows of LP problem.
+	 *
+	 * Model-wide, append-only store of (row, column, value) triplets. Triplets are compressed
+	 * only when the whole problem is passed to the solver (@see loadProblem())
+	 * or when someone asks for coefficients of particular column or row.
+	 *
+	 */
+	CoefficientMatrix* coefficients;
+
+	/** Set once the whole problem has been passed to the solver (@see loadProblem()).
+	 *
+	 * From that moment only changes are pushed to the solver (@see updateProblem())
+	 * so its internal state (e.g. basis of the last solution) is kept.
+	 *
+	 */
+	bool problemLoaded;
+
+	/** Number of columns that are known to the solver.
+	 *
+	 * Columns with greater indexes were added after problem has been loaded.
+	 *
+	 */
+	VarIdx loadedColumns;
+
+	/** Number of rows that are known to the solver.
+	 *
+	 * Rows with greater indexes were added after problem has been loaded.
+	 *
+	 */
+	RowIdx loadedRows;
+
+	/** Number of coefficients that are known to the solver.
+	 *
+	 * Coefficients stored at greater positions (@see CoefficientMatrix) were added after problem has been loaded.
+	 *
+	 */
+	size_t loadedElements;
+
+	/** Set when the solver holds basis that the next solve can start from (@see solve()).
+	 *
+	 * Basis is left in the solver by every solve and by setBasis(), it is lost when the whole
+	 * problem is loaded again (@see loadProblem()).
+	 *
+	 */
+	bool basisAvailable;
+
+	/** Decides if problem is reduced by presolve before it is loaded into the solver (@see setPresolveEnabled()).
+	 *
+	 */
+	bool presolveEnabled;
+
+	/** Reductions of problem loaded into the solver (nullptr if loaded problem has not been reduced).
+	 *
+	 */
+	Presolve* presolve;
+
+	/** Indexes of loaded columns that have been changed since last push to the solver (@see #col_dirty).
+	 *
+	 */
+	std::vector<VarIdx> dirtyColumns;
+
+	/** Indexes of loaded rows that have been changed since last push to the solver (@see #row_dirty).
+	 *
+	 */
+	std::vector<RowIdx> dirtyRows;
+
+	/** Indexes (in the solver) of loaded columns that have been deleted since last push to the solver, in increasing order.
+	 *
+	 * Deleted columns are removed from column arrays at once, but the solver keeps them until updateProblem().
+	 *
+	 */
+	std::vector<int> deletedColumns;
+
+	/** Indexes (in the solver) of loaded rows that have been deleted since last push to the solver, in increasing order.
+	 *
+	 * @see #deletedColumns
+	 *
+	 */
+	std::vector<int> deletedRows;
+
 	//*************************************** PRIVATE FUNCTIONS ****************************************//
 
 	/** Returns new instance of a given solver.
@@ -136,10 +292,143 @@ private:
 	 */
 	OsiSolverInterface* getNewSolverInterface(SolverInterface solverInterface);
 
+	/** Makes sure that column arrays can hold at least given number of columns.
+	 *
+	 * If current #columnsCapacity is not sufficient every column array will be reallocated
+	 * to at least twice of it's current capacity (so adding columns takes amortized constant time).
+	 *
+	 * @param numberOfColumns number of columns that column arrays have to be able to store
+	 */
+	void reserveColumns(const VarIdx numberOfColumns);
+
+	/** Makes sure that row arrays can hold at least given number of rows.
+	 *
+	 * @see reserveColumns()
+	 *
+	 * @param numberOfRows number of rows that row arrays have to be able to store
+	 */
+	void reserveRows(const RowIdx numberOfRows);
+
+	/** Marks given column as changed if it is already known to the solver.
+	 *
+	 * @param columnIdx
+	 */
+	void markColumnDirty(const VarIdx columnIdx);
+
+	/** Marks given row as changed if it is already known to the solver.
+	 *
+	 * @param rowIdx
+	 */
+	void markRowDirty(const RowIdx rowIdx);
+
+	/** Copies bounds of count columns starting from firstIdx into given arrays.
+	 *
+	 * Bounds of fixed columns are replaced by their values.
+	 *
+	 * @param firstIdx
+	 * @param count
+	 * @param collb
+	 * @param colub
+	 */
+	void getSolverColumnBounds(const VarIdx firstIdx, const VarIdx count,
+			double* collb, double* colub) const;
+
+	/** Passes deleted columns and rows to the solver (OsiSolverInterface::deleteCols(), OsiSolverInterface::deleteRows()).
+	 *
+	 * Afterwards loaded columns and rows have the same indexes in the solver as in this problem instance.
+	 *
+	 */
+	void pushDeletions();
+
+	/** Passes bounds and objective coefficients of changed columns to the solver.
+	 *
+	 */
+	void pushDirtyColumns();
+
+	/** Passes bounds of changed rows to the solver.
+	 *
+	 */
+	void pushDirtyRows();
+
+	/** Passes columns added after problem has been loaded to the solver.
+	 *
+	 * @param newColumns coefficients of new columns in loaded rows (column indexes are relative to #loadedColumns)
+	 */
+	void pushNewColumns(const CoefficientMatrix& newColumns);
+
+	/** Passes rows added after problem has been loaded to the solver.
+	 *
+	 * @param newRows coefficients of new rows (row indexes are relative to #loadedRows)
+	 */
+	void pushNewRows(const CoefficientMatrix& newRows);
+
+	/** Marks integer columns of given range as integer in the solver.
+	 *
+	 * @param firstIdx index of the first column (both in this problem instance and in the solver)
+	 * @param count number of columns
+	 */
+	void pushIntegerColumns(const VarIdx firstIdx, const VarIdx count);
+
+	/** Marks current state of this problem instance as the one known to the solver.
+	 *
+	 */
+	void clearChanges();
+
+	/** Passes changes of given scenario to given solver (clone of #si).
+	 *
+	 * @param si
+	 * @param scenario
+	 */
+	void applyScenario(OsiSolverInterface* si, const Scenario& scenario) const;
+
+	/** Restores values of this problem instance in every column and row changed by given scenario.
+	 *
+	 * Solver is then back to the loaded model but keeps its basis, so the next scenario starts from it.
+	 *
+	 * @param si
+	 * @param scenario
+	 */
+	void revertScenario(OsiSolverInterface* si,
+			const Scenario& scenario) const;
+
+	/** Solves problem loaded into given solver.
+	 *
+	 * Problems with integer columns are solved by branch and bound, LP problems by simplex -
+	 * from scratch or warm-started from basis that is held by the solver.
+	 *
+	 * @param si
+	 * @param warmStart
+	 * @return
+	 */
+	static SolveStatus solve(OsiSolverInterface* si, const bool warmStart);
+
+	/** Reduces the whole problem by presolve (@see Presolve) and passes reduced problem to the solver.
+	 *
+	 * @return false if presolve has found that problem is infeasible (nothing is passed to the solver then)
+	 */
+	bool loadPresolvedProblem();
+
+	/** Returns dual objective of current iterate of the solver, i.e. value of Lagrangian relaxation
+	 * of loaded problem for current row prices (OsiSolverInterface::getRowPrice()).
+	 *
+	 * It is a valid bound of optimal objective value even if the iterate is not optimal (lower bound
+	 * for minimization, upper bound for maximization). Reduced costs smaller than dual tolerance are treated as 0.
+	 *
+	 * @return NAN if the solver does not provide dual values, infinity if a column or row with nonzero
+	 * dual value is not bounded in the required direction
+	 */
+	VarValue getDualBound() const;
+
 public:
 
 	//************************************* PUBLIC CONSTANT FIELDS *************************************//
 
+	/** Maximal number of simplex iterations between two checks of time limit, cancellation
+	 * and progress (@see solve()).
+	 *
+	 */
+	const static int ITERATIONS_PER_SLICE { 1000 };
+
 	//************************************ CONSTRUCTOR & DESTRUCTOR ************************************//
 
 	OsiProblemInstance(SolverInterface solverInterface);
@@ -149,17 +438,371 @@ public:
 	//*************************************** PUBLIC FUNCTIONS *****************************************//
 
 	/** Add given number of columns (new variables) to this problem instance.
+	 *
+	 * Every new column will be initialized with given bounds, objective coefficient equal to 0
+	 * and without fixed value.
 	 *
 	 * @param numberOfNewVariables number of new variables to be added
+	 * @param lowerBound lower bound of every new variable
+	 * @param upperBound upper bound of every new variable
+	 * @param integer true if new variables are of integer or binary type
+	 * @return index of the first added column
+	 */
+	VarIdx addNumberOfVariables(const VarIdx numberOfNewVariables,
+			const VarValue lowerBound, const VarValue upperBound,
+			const bool integer);
+
+	/** Add given number of rows (new linear equations/inequalities) to this problem instance.
+	 *
+	 * Every new row will be initialized with given bounds and without any coefficient.
+	 *
+	 * @param numberOfNewRows number of new rows to be added
+	 * @param lowerBound lower bound of every new row
+	 * @param upperBound upper bound of every new row
+	 * @return index of the first added row
+	 */
+	RowIdx addNumberOfRows(const RowIdx numberOfNewRows,
+			const VarValue lowerBound, const VarValue upperBound);
+
+	/** Adds coefficient of given column in given row.
+	 *
+	 * Coefficient is appended to coefficient matrix in constant time.
+	 * If given column has already a coefficient in given row both of them will be summed up.
+	 *
+	 * @param rowIdx
+	 * @param columnIdx
+	 * @param value
+	 */
+	void addElement(const RowIdx rowIdx, const VarIdx columnIdx,
+			const VarValue value);
+
+	/** Adds coefficients of given columns in given row.
+	 *
+	 * @param rowIdx
+	 * @param columnIdx array of count columns
+	 * @param value array of count coefficients
+	 * @param count
+	 */
+	void addElements(const RowIdx rowIdx, const VarIdx* columnIdx,
+			const VarValue* value, const size_t count);
+
+	/** Makes sure that given number of coefficients (in total) can be added without allocating memory.
+	 *
+	 * @param numberOfElements
+	 */
+	void reserveElements(const size_t numberOfElements);
+
+	/** Appends given number of coefficients that will be filled afterwards by assignElements().
+	 *
+	 * @see CoefficientMatrix::extend()
+	 *
+	 * @param count
+	 * @return position of the first appended coefficient
+	 */
+	size_t extendElements(const size_t count);
+
+	/** Overwrites count coefficients starting from given position.
+	 *
+	 * Distinct ranges of coefficients can be assigned concurrently (@see CoefficientMatrix::assign()).
+	 *
+	 * @param position
+	 * @param rowIdx array of count rows
+	 * @param columnIdx array of count columns
+	 * @param value array of count coefficients
+	 * @param count
+	 */
+	void assignElements(const size_t position, const RowIdx* rowIdx,
+			const VarIdx* columnIdx, const VarValue* value, const size_t count);
+
+	/** Removes count consecutive columns starting from given column together with their coefficients.
+	 *
+	 * Columns that follow removed ones are moved down by count, so columns still occupy contiguous range of indexes.
+	 * Removed columns that are known to the solver are deleted from it by the next updateProblem().
+	 *
+	 * @param firstIdx
+	 * @param count
+	 */
+	void deleteColumns(const VarIdx firstIdx, const VarIdx count);
+
+	/** Removes count consecutive rows starting from given row together with their coefficients.
+	 *
+	 * @see deleteColumns()
+	 *
+	 * @param firstIdx
+	 * @param count
+	 */
+	void deleteRows(const RowIdx firstIdx, const RowIdx count);
+
+	/** Passes the whole problem to the solver at once.
+	 *
+	 * Triplets are compressed (@see CoefficientMatrix::compress()) directly into column-major (CSC) arrays
+	 * of CoinPackedMatrix where duplicated coefficients are summed up. Matrix together with copies of
+	 * column and row arrays is handed over to the solver by single OsiSolverInterface::assignProblem() call
+	 * (solver takes ownership of them so nothing is copied once again). Bounds of fixed columns are replaced by their values.
+	 *
+	 * Previous problem of the solver (together with its basis) is discarded, @see updateProblem().
+	 *
+	 * If presolve is enabled (@see setPresolveEnabled()) reduced problem is passed to the solver instead.
+	 *
+	 */
+	void loadProblem();
+
+	/** Passes changes of this problem instance to the solver.
+	 *
+	 * If problem has not been loaded yet it is loaded as a whole (@see loadProblem()).
+	 * Otherwise only changes made since the last push are passed:
+	 * - deleted columns and rows (OsiSolverInterface::deleteCols(), OsiSolverInterface::deleteRows()),
+	 * - bounds, objective coefficients and fixed values of changed columns (OsiSolverInterface::setColSetBounds(),
+	 * OsiSolverInterface::setObjCoeffSet()),
+	 * - bounds of changed rows (OsiSolverInterface::setRowSetBounds()),
+	 * - new columns together with their coefficients in loaded rows (OsiSolverInterface::addCols()),
+	 * - new rows together with their coefficients (OsiSolverInterface::addRows()),
+	 *
+	 * so solver keeps its internal state (e.g. basis) between solves. Coefficients added to rows
+	 * that were already loaded at columns that were already loaded cannot be passed as a change
+	 * - in that case the whole problem is loaded once again.
+	 *
+	 * Reduced problem (@see setPresolveEnabled()) cannot be changed - it is always presolved and loaded once again.
+	 *
+	 */
+	void updateProblem();
+
+	/** Releases compressed (column-major and row-major) copies of coefficients built by
+	 * getColumnCoefficients() and getRowCoefficients() - they are built again on the next request.
+	 *
+	 */
+	void releaseCoefficientsCache();
+
+	/** Solves loaded problem (@see updateProblem()).
+	 *
+	 * Simplex is warm-started from basis of the previous solve or from basis given by setBasis().
+	 *
+	 * If given options limit time or ask for progress or solve can be cancelled, LP problem is solved
+	 * in slices of at most #ITERATIONS_PER_SLICE iterations - each slice continues from basis of the previous one
+	 * (the solver's own iteration limit is still respected). Limits, cancellation and progress are checked
+	 * between slices.
+	 *
+	 * Problem with integer columns is solved by branch and bound in one piece. Only CBC engine is given the time limit
+	 * (CbcModel::setMaximumSeconds()) - other engines ignore it with a warning. Cancellation of branch and bound
+	 * that is already running is not possible (a warning is logged if it has been requested).
+	 *
+	 * Solution of reduced problem is mapped back onto the whole problem (@see Presolve::postsolve()).
+	 *
+	 * @param options
+	 * @param cancelled flag that stops solve when it is set (nullptr if solve cannot be cancelled)
+	 * @return SolveStatus::LIMIT_REACHED if time limit has been reached, SolveStatus::CANCELLED if solve has been cancelled
+	 * before branch and bound or between slices
+	 */
+	SolveStatus solve(const SolveOptions& options,
+			const std::atomic<bool>* cancelled);
+
+	/** Copies basis of the last solution into given arrays.
+	 *
+	 * @param columnStatus output array of getNumberOfColumns() statuses of columns (@see Basis::Status)
+	 * @param rowStatus output array of getNumberOfRows() statuses of rows
+	 * @return false if the solver has no basis (e.g. problem has not been solved yet), loaded problem has been reduced
+	 * or deleted columns or rows have not been passed to the solver yet
+	 */
+	bool getBasis(std::vector<char>& columnStatus,
+			std::vector<char>& rowStatus) const;
+
+	/** Passes given basis to the solver - the next solve starts from it.
+	 *
+	 * Problem has to be loaded (@see updateProblem()). Basis is ignored if loaded problem has been reduced.
+	 *
+	 * @param columnStatus getNumberOfColumns() statuses of columns (@see Basis::Status)
+	 * @param rowStatus getNumberOfRows() statuses of rows
 	 */
-	void addNumberOfVariables(const VarIdx numberOfNewVariables);
+	void setBasis(const std::vector<char>& columnStatus,
+			const std::vector<char>& rowStatus);
+
+	/** Returns given array of the last solution directly from the solver.
+	 *
+	 * Array is owned by the solver - it is valid until problem is changed or solved again.
+	 * If loaded problem has been reduced, array of postsolved solution is returned.
+	 *
+	 * @param part
+	 * @return nullptr if the solver does not provide that array or it does not match current problem
+	 * (e.g. columns or rows have been added or deleted since the last solve)
+	 */
+	const VarValue* getSolution(const Solution::Part part) const;
+
+	/** Copies every available array of the last solution and value of objective function into given snapshot.
+	 *
+	 * @param solution
+	 */
+	void copySolution(Solution& solution) const;
+
+	/** Solves every given scenario of loaded problem by given number of worker threads.
+	 *
+	 * Every worker solves its own clone of #si: it takes next unsolved scenario, applies its changes,
+	 * solves problem (warm-started from basis of previous scenario of the same worker),
+	 * stores result under index of scenario and reverts changes. Problem is loaded into every clone
+	 * only once - scenarios cost only their own changes and reoptimization.
+	 *
+	 * Problem has to be loaded (@see updateProblem()) and every scenario has to be valid (@see Scenario::isValid()).
+	 *
+	 * If any worker throws (e.g. CoinError of the solver), no more scenarios are handed out, every clone is deleted
+	 * and exception (the one thrown by worker with the lowest number) is rethrown after all workers finish.
+	 *
+	 * @param scenarios
+	 * @param results output array of scenarios.size() results in order of scenarios
+	 * @param numberOfThreads number of workers (0 means number of hardware threads)
+	 */
+	void solveScenarios(const std::vector<Scenario>& scenarios,
+			std::vector<ScenarioResult>& results,
+			const unsigned int numberOfThreads) const;
+
+	/** Checks new bounds of count consecutive columns starting from given column.
+	 *
+	 * Bounds are rejected if lower bound is greater than upper bound or if fixed value of column is out of them.
+	 * Rejected columns are counted in given report and described in it as long as it is not full
+	 * (@see BoundsReport::MAX_NUMBER_OF_FAILURES).
+	 *
+	 * @param firstIdx
+	 * @param count
+	 * @param lowerBounds new lower bounds
+	 * @param upperBounds new upper bounds
+	 * @param stride distance between bounds of consecutive columns (0 if all columns get the same bounds)
+	 * @param report
+	 * @return number of rejected columns
+	 */
+	size_t checkColumnBounds(const VarIdx firstIdx, const VarIdx count,
+			const VarValue* lowerBounds, const VarValue* upperBounds,
+			const size_t stride, BoundsReport& report) const;
+
+	/** Sets bounds of count consecutive columns starting from given column.
+	 *
+	 * @param firstIdx
+	 * @param count
+	 * @param lowerBounds
+	 * @param upperBounds
+	 * @param stride distance between bounds of consecutive columns (0 if all columns get the same bounds)
+	 */
+	void setColumnBounds(const VarIdx firstIdx, const VarIdx count,
+			const VarValue* lowerBounds, const VarValue* upperBounds,
+			const size_t stride);
+
+	/** Checks fixed values of count consecutive columns starting from given column.
+	 *
+	 * Values out of bounds of their columns are rejected (@see checkColumnBounds()).
+	 *
+	 * @param firstIdx
+	 * @param count
+	 * @param values
+	 * @param stride distance between values of consecutive columns (0 if all columns get the same value)
+	 * @param report
+	 * @return number of rejected columns
+	 */
+	size_t checkColumnValues(const VarIdx firstIdx, const VarIdx count,
+			const VarValue* values, const size_t stride,
+			BoundsReport& report) const;
+
+	/** Sets values of count consecutive columns starting from given column and marks them as fixed.
+	 *
+	 * @param firstIdx
+	 * @param count
+	 * @param values
+	 * @param stride distance between values of consecutive columns (0 if all columns get the same value)
+	 */
+	void fixColumnValues(const VarIdx firstIdx, const VarIdx count,
+			const VarValue* values, const size_t stride);
+
+	/** Releases fixed values of count consecutive columns starting from given column,
+	 * so their own bounds are passed to the solver again.
+	 *
+	 * @param firstIdx
+	 * @param count
+	 */
+	void unfixColumns(const VarIdx firstIdx, const VarIdx count);
 
 	//*************************************** GETTERS & SETTERS ****************************************//
 
 	VarIdx getNumberOfColumns() const;
 
+	VarValue getColumnLowerBound(const VarIdx columnIdx) const;
+
+	void setColumnLowerBound(const VarIdx columnIdx, const VarValue lowerBound);
+
+	VarValue getColumnUpperBound(const VarIdx columnIdx) const;
+
+	void setColumnUpperBound(const VarIdx columnIdx, const VarValue upperBound);
+
+	VarValue getColumnObjective(const VarIdx columnIdx) const;
+
+	void setColumnObjective(const VarIdx columnIdx, const VarValue coefficient);
+
+	bool isColumnFixed(const VarIdx columnIdx) const;
+
+	VarValue getColumnValue(const VarIdx columnIdx) const;
+
+	/** Sets value of given column and marks it as fixed.
+	 *
+	 * @param columnIdx
+	 * @param value
+	 */
+	void fixColumnValue(const VarIdx columnIdx, const VarValue value);
+
+	/** Returns view of coefficients of given column in rows of LP problem.
+	 *
+	 * @see CoefficientMatrix::getColumn()
+	 *
+	 * @param columnIdx
+	 * @return
+	 */
+	ColumnView getColumnCoefficients(const VarIdx columnIdx) const;
+
+	RowIdx getNumberOfRows() const;
+
+	VarValue getRowLowerBound(const RowIdx rowIdx) const;
+
+	void setRowLowerBound(const RowIdx rowIdx, const VarValue lowerBound);
+
+	VarValue getRowUpperBound(const RowIdx rowIdx) const;
+
+	void setRowUpperBound(const RowIdx rowIdx, const VarValue upperBound);
+
+	/** Returns view of coefficients of variables in given row.
+	 *
+	 * @see CoefficientMatrix::getRow()
+	 *
+	 * @param rowIdx
+	 * @return
+	 */
+	RowView getRowCoefficients(const RowIdx rowIdx) const;
+
+	size_t getNumberOfElements() const;
+
 	OsiSolverInterface* getOsiSolverInterface() const;
 
+	SolverInterface getSolverInterface() const;
+
+	/** Returns value of objective function of the last solution (including constant term of columns removed by presolve).
+	 *
+	 * @return
+	 */
+	VarValue getObjectiveValue() const;
+
+	/** Enables or disables presolve of problem before it is loaded into the solver.
+	 *
+	 * Fixed columns, empty, singleton, redundant and duplicate rows are removed and bounds of columns
+	 * are tightened before problem is passed to the solver (@see Presolve). Solution is mapped back onto
+	 * the whole problem, so it is read exactly as solution of problem that has not been reduced.
+	 * Since reduced problem cannot be changed, every change of problem makes it presolved and loaded
+	 * once again and basis of the previous solve is not used.
+	 *
+	 * @param presolveEnabled
+	 */
+	void setPresolveEnabled(const bool presolveEnabled);
+
+	bool isPresolveEnabled() const;
+
+	/** Returns reductions of loaded problem.
+	 *
+	 * @return nullptr if loaded problem has not been reduced
+	 */
+	const Presolve* getPresolve() const;
+
 };
 
 #endif /* OSIPROBLEMINSTANCE_HPP_ */
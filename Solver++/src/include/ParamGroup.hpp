@@ -0,0 +1,234 @@
+/*
+ * ParamGroup.hpp
+ *
+ *  Created on: 17 paź 2026
+ *      Author: tomasz
+ */
+
+#ifndef PARAMGROUP_HPP_
+#define PARAMGROUP_HPP_
+
+#include "DimensionTable.hpp"
+#include "exp/ParameterModelExeptions.hpp"
+#include "Typedefs.hpp"
+#include "utils/MapperUtils.hpp"
+#include "Parameter.hpp"
+#include "ParameterIdxMapper.hpp"
+
+/** @brief Prepared handle of N-dimensional group of parameters.
+ *
+ * @details Counterpart of VarGroup for parameters (@see VarGroup). Every access is a bounds check
+ * and stride arithmetic directly on array of values of the group, so values can be used
+ * as coefficients without any intermediate objects:
+ * @code
+ * 	Solver s(SolverInterface::GLPK);
+ * 	s.newVariable("x[100][20]", 0, 1, ValueType::DOUBLE);
+ * 	s.newParameter("cost[100][20]");
+ * 	s.newRows("budget");
+ * 	VarGroup<2> x = s.group<2>("x");
+ * 	ParamGroup<2> cost = s.paramGroup<2>("cost");
+ *
+ * 	s.getRow("budget").setConstraint(
+ * 			sum(1, 100, [&](const VarDimIdx i) {
+ * 				return sum(1, 20, [&, i](const VarDimIdx j) { return cost(i, j) * x(i, j); });
+ * 			}) <= 1000);
+ *
+ * 	ParamSpan row = cost.span(7);	// cost[7][1], ..., cost[7][20] - contiguous
+ * @endcode
+ *
+ * Handle does not own any data and it stays valid as long as group of parameters that it refers to exists.
+ *
+ */
+template<ParamDimIdx N>
+class ParamGroup {
+
+	friend class Solver;
+
+	static_assert(N <= MAX_NUMBER_OF_DIMENSIONS,
+			"Group of parameters cannot have more than MAX_NUMBER_OF_DIMENSIONS dimensions.");
+
+private:
+
+	//************************************ PRIVATE CONSTANT FIELDS *************************************//
+
+	/** @brief Size of #extents and #strides arrays (arrays of size 0 are not allowed).
+	 *
+	 */
+	const static ParamDimIdx ARRAYS_SIZE { N == 0 ? 1 : N };
+
+	//***************************************** CLASS FIELDS *******************************************//
+
+	/** @brief Group of parameters to which this handle refers.
+	 *
+	 */
+	ParamIdxMapper* parameterGroup;
+
+	/** @brief Array of values of group (@see ParamIdxMapper::getValues()).
+	 *
+	 */
+	ParamValue* values;
+
+	/** @brief Copy of sizes of dimensions of this group.
+	 *
+	 */
+	ParamDimIdx extents[ARRAYS_SIZE];
+
+	/** @brief Copy of strides of dimensions of this group (@see DimensionTable).
+	 *
+	 */
+	ParamIdx strides[ARRAYS_SIZE];
+
+	//*************************************** PRIVATE FUNCTIONS ****************************************//
+
+	/** @brief Logs and throws exception for indexes that do not refer to any parameter in this group.
+	 *
+	 * @details Kept out of linearize() so the common path contains only arithmetic.
+	 *
+	 * @param indexes list of count indexes
+	 * @param count
+	 */
+	void throwIndexOutOfBounds(const ParamDimIdx* indexes,
+			const ParamDimIdx count) const
+					throw (ParameterModelExceptions::IndexOutOfBoundException) {
+		ParamIndexTuple dimensions { };
+		for (ParamDimIdx i = 0; i < N; i += 1) {
+			dimensions.push_back(i < count ? indexes[i] : 1);
+		}
+		MapUtils::ifDimensionsOutOfBounds<ParamIdx, ParamDimIdx>(
+				this->parameterGroup->getDimensions(), dimensions);
+		throw ParameterModelExceptions::IndexOutOfBoundException();
+	}
+
+	/** @brief Returns index of value of the first parameter with given leading (1-based) indexes.
+	 *
+	 * @param indexes list of count indexes of the highest dimensions
+	 * @param count number of indexes (not greater than N)
+	 * @return
+	 *
+	 * @throw ParameterModelExceptions::IndexOutOfBoundException if any index is 0 or exceeds size of its dimension.
+	 */
+	ParamIdx linearize(const ParamDimIdx* indexes, const ParamDimIdx count) const
+			throw (ParameterModelExceptions::IndexOutOfBoundException) {
+		ParamIdx idx { 0 };
+		for (ParamDimIdx i = 0; i < count; i += 1) {
+			if (indexes[i] == 0 || indexes[i] > this->extents[i]) {
+				throwIndexOutOfBounds(indexes, count);
+			}
+			idx += (indexes[i] - 1) * this->strides[i];
+		}
+		return idx;
+	}
+
+	//************************************ CONSTRUCTOR & DESTRUCTOR ************************************//
+
+	/** @brief Creates handle of given group of parameters.
+	 *
+	 * @details Handles are created by Solver::paramGroup() which checks if given group has N dimensions.
+	 *
+	 * @param parameterGroup
+	 */
+	explicit ParamGroup(ParamIdxMapper* parameterGroup) :
+			parameterGroup(parameterGroup), values(
+					parameterGroup->getValues()) {
+		for (ParamDimIdx i = 0; i < N; i += 1) {
+			this->extents[i] = parameterGroup->getDimensions().getExtent(i);
+			this->strides[i] = parameterGroup->getDimensions().getStride(i);
+		}
+	}
+
+public:
+
+	//************************************* PUBLIC CONSTANT FIELDS *************************************//
+
+	//*************************************** PUBLIC FUNCTIONS *****************************************//
+
+	/** @brief Returns value of parameter with given (1-based) indexes.
+	 *
+	 * @param indexes exactly N indexes, from the highest dimension to the lowest
+	 * @return
+	 *
+	 * @throw ParameterModelExceptions::IndexOutOfBoundException if any index is 0 or exceeds size of its dimension.
+	 */
+	template<typename ... Indexes>
+	const ParamValue& operator()(const Indexes ... indexes) const
+			throw (ParameterModelExceptions::IndexOutOfBoundException) {
+		return this->values[getIdx(indexes...)];
+	}
+
+	/** @brief Returns a view of parameter with given (1-based) indexes (e.g. in order to change its value).
+	 *
+	 * @param indexes exactly N indexes, from the highest dimension to the lowest
+	 * @return
+	 *
+	 * @throw ParameterModelExceptions::IndexOutOfBoundException if any index is 0 or exceeds size of its dimension.
+	 */
+	template<typename ... Indexes>
+	Parameter getParameter(const Indexes ... indexes) const
+			throw (ParameterModelExceptions::IndexOutOfBoundException) {
+		return Parameter { this->parameterGroup, getIdx(indexes...) };
+	}
+
+	/** @brief Returns index of value of parameter with given (1-based) indexes.
+	 *
+	 * @param indexes exactly N indexes, from the highest dimension to the lowest
+	 * @return
+	 *
+	 * @throw ParameterModelExceptions::IndexOutOfBoundException if any index is 0 or exceeds size of its dimension.
+	 */
+	template<typename ... Indexes>
+	ParamIdx getIdx(const Indexes ... indexes) const
+			throw (ParameterModelExceptions::IndexOutOfBoundException) {
+		static_assert(sizeof...(Indexes) == N,
+				"Number of indexes has to be equal to number of dimensions of group of parameters.");
+		const ParamDimIdx indexesArray[ARRAYS_SIZE] = {
+				static_cast<ParamDimIdx>(indexes)... };
+		return linearize(indexesArray, N);
+	}
+
+	/** @brief Returns contiguous span of values of parameters with given leading (1-based) indexes.
+	 *
+	 * @details Values are stored in row-major order, so fixing K highest dimensions gives
+	 * contiguous block of values of the remaining ones, e.g. for p[n][m][k]: p.span(i) is a span
+	 * of m * k values, p.span(i, j) is a span of k values and p.span() is a span of every value.
+	 *
+	 * @param indexes at most N indexes, from the highest dimension to the lowest
+	 * @return
+	 *
+	 * @throw ParameterModelExceptions::IndexOutOfBoundException if any index is 0 or exceeds size of its dimension.
+	 */
+	template<typename ... Indexes>
+	ParamSpan span(const Indexes ... indexes) const
+			throw (ParameterModelExceptions::IndexOutOfBoundException) {
+		static_assert(sizeof...(Indexes) <= N,
+				"Number of indexes cannot be greater than number of dimensions of group of parameters.");
+		const ParamDimIdx indexesArray[sizeof...(Indexes) + 1] = {
+				static_cast<ParamDimIdx>(indexes)..., 0 };
+		return ParamSpan { this->values
+				+ linearize(indexesArray, sizeof...(Indexes)),
+				sizeof...(Indexes) == 0 ?
+						this->parameterGroup->getNumberOfParameters() :
+						this->strides[sizeof...(Indexes) == 0 ?
+								0 : sizeof...(Indexes) - 1] };
+	}
+
+	//*************************************** GETTERS & SETTERS ****************************************//
+
+	ParamIdx getNumberOfParameters() const {
+		return this->parameterGroup->getNumberOfParameters();
+	}
+
+	ParamDimIdx getExtent(const ParamDimIdx dimension) const {
+		return this->extents[dimension];
+	}
+
+	const ParamValue* getValues() const {
+		return this->values;
+	}
+
+	ParamIdxMapper* getParameterGroup() const {
+		return this->parameterGroup;
+	}
+
+};
+
+#endif /* PARAMGROUP_HPP_ */
@@ -0,0 +1,235 @@
+/*
+ * ParamTextLoader.hpp
+ *
+ *  Created on: 17 paź 2026
+ *      Author: tomasz
+ */
+
+#ifndef PARAMTEXTLOADER_HPP_
+#define PARAMTEXTLOADER_HPP_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+#include <string>
+#include <vector>
+
+#include "exp/ParameterModelExeptions.hpp"
+#include "Typedefs.hpp"
+
+class ParamIdxMapper;
+
+/** @brief Summary of loading of text file with values of parameters (@see ParamTextLoader::load()).
+ *
+ */
+struct ParamLoadReport {
+
+	/** @brief Number of lines read (including empty lines, comments and header).
+	 *
+	 */
+	size_t numberOfLines;
+
+	/** @brief Number of parameters whose values were read from file.
+	 *
+	 */
+	size_t numberOfValues;
+
+	/** @brief Number of parameters that did not appear in file and got default value.
+	 *
+	 */
+	size_t numberOfMissing;
+
+	/** @brief Number of lines with indexes of parameter that already appeared in file.
+	 *
+	 */
+	size_t numberOfDuplicates;
+
+	/** @brief Number of lines that could not be interpreted, have indexes out of bounds of group
+	 * or value out of bounds of its parameters.
+	 *
+	 */
+	size_t numberOfInvalidLines;
+
+};
+
+/** @brief Streaming, multi-threaded loader of values of group of parameters from text (CSV/TSV) file.
+ *
+ * @details Every line of file consists of N indexes of parameter of N-dimensional group followed by its value,
+ * separated by commas, semicolons, tabs or spaces, e.g. for group "distance[100][100]":
+ * @code
+ * 	i,j,value
+ * 	1,1,0
+ * 	1,2,12.5
+ * 	...
+ * @endcode
+ *
+ * Empty lines and lines starting with '#' are skipped and first line that is not a valid line is treated as header.
+ *
+ * File is read in blocks of #blockSize bytes (next block is read while the current one is parsed).
+ * Every block is split at line boundaries into one piece per thread and numbers are parsed without
+ * any allocation (@see StringUtils::parseNumber()) straight into array of values of group.
+ * Parameters that do not appear in file get default value. Duplicated indexes are detected by one bit
+ * per parameter (set atomically) - duplicates are counted and logged and the value that comes first in file is kept.
+ * Since threads race for the bit, block in which any duplicate has been found is scanned once again
+ * for duplicated indexes only (@see resolveDuplicates()), so result does not depend on number of threads.
+ *
+ */
+class ParamTextLoader {
+
+private:
+
+	//************************************ PRIVATE CONSTANT FIELDS *************************************//
+
+	//****************************************** CLASS TYPES *******************************************//
+
+	/** @brief Counters of single thread.
+	 *
+	 */
+	struct Counters {
+		size_t numberOfLines;
+		size_t numberOfValues;
+		size_t numberOfDuplicates;
+		size_t numberOfInvalidLines;
+
+		/** @brief Index of the first duplicated parameter found by thread (number of parameters if none).
+		 *
+		 */
+		size_t firstDuplicate;
+
+		/** @brief Indexes of parameters whose values have been rejected by thread in current block
+		 * as they had been already read.
+		 *
+		 */
+		std::vector<size_t> duplicates;
+	};
+
+	/** @brief Kind of line of file.
+	 *
+	 */
+	enum LineKind {
+		BLANK,   //!< empty line or comment
+		ENTRY,   //!< indexes and value of parameter
+		INVALID  //!< line that cannot be interpreted (or header)
+	};
+
+	//***************************************** CLASS FIELDS *******************************************//
+
+	/** @brief Group of parameters whose values are loaded.
+	 *
+	 */
+	ParamIdxMapper* parameterGroup;
+
+	/** @brief Value of parameters that do not appear in file.
+	 *
+	 */
+	ParamValue defaultValue;
+
+	/** @brief Number of threads that parse file.
+	 *
+	 */
+	unsigned int numberOfThreads;
+
+	/** @brief Number of bytes read from file at once.
+	 *
+	 */
+	size_t blockSize;
+
+	/** @brief One bit for every parameter of group - set if value of parameter has been read.
+	 *
+	 */
+	std::vector<std::atomic<uint64_t>> assigned;
+
+	//*************************************** PRIVATE FUNCTIONS ****************************************//
+
+	/** @brief Reads indexes and value of parameter from single line (without end of line character).
+	 *
+	 * @param begin
+	 * @param end
+	 * @param idx output index of parameter in group
+	 * @param value output value of parameter
+	 * @return kind of line (idx and value are set only for LineKind::ENTRY)
+	 */
+	LineKind readLine(const char* begin, const char* end, size_t& idx,
+			ParamValue& value) const;
+
+	/** @brief Parses single line (without end of line character).
+	 *
+	 * @param begin
+	 * @param end
+	 * @param counters counters of calling thread
+	 * @return false if line is not a valid line, true otherwise (also for empty lines and comments).
+	 */
+	bool parseLine(const char* begin, const char* end, Counters& counters);
+
+	/** @brief Assigns values that come first in file to parameters duplicated in given lines.
+	 *
+	 * @details Duplicated line is rejected by thread that finds bit of its parameter already set, which
+	 * is not necessarily the later line. Lines are scanned again (one piece per thread) for duplicated parameters
+	 * only - if parameter appears in them more times than it has been rejected, its value has been read
+	 * from them (not from previous block) and it is replaced by value of its first appearance.
+	 *
+	 * @param pieces numberOfThreads + 1 boundaries of pieces of lines (@see parseBlock())
+	 * @param counters counters of every thread (lists of duplicates are cleared)
+	 */
+	void resolveDuplicates(const std::vector<const char*>& pieces,
+			std::vector<Counters>& counters);
+
+	/** @brief Parses every line of given part of block.
+	 *
+	 * @param begin first character of the first line
+	 * @param end character after the end of the last line
+	 * @param header true if the first line may be a header
+	 * @param counters counters of calling thread
+	 */
+	void parsePiece(const char* begin, const char* end, bool header,
+			Counters& counters);
+
+	/** @brief Parses given lines by all threads.
+	 *
+	 * @param begin first character of the first line
+	 * @param end character after the end of the last line
+	 * @param header true if the first line may be a header
+	 * @param counters counters of every thread
+	 */
+	void parseBlock(const char* begin, const char* end, const bool header,
+			std::vector<Counters>& counters);
+
+public:
+
+	//************************************* PUBLIC CONSTANT FIELDS *************************************//
+
+	/** @brief Default number of bytes read from file at once.
+	 *
+	 */
+	const static size_t DEFAULT_BLOCK_SIZE { 64 << 20 };
+
+	//************************************ CONSTRUCTOR & DESTRUCTOR ************************************//
+
+	/** @brief Creates loader of values of given group of parameters.
+	 *
+	 * @param parameterGroup group of parameters to be filled
+	 * @param defaultValue value of parameters that do not appear in file
+	 * @param numberOfThreads number of threads that parse file (0 for number of hardware threads)
+	 * @param blockSize number of bytes read from file at once
+	 */
+	ParamTextLoader(ParamIdxMapper* parameterGroup,
+			const ParamValue defaultValue, const unsigned int numberOfThreads =
+					0, const size_t blockSize = DEFAULT_BLOCK_SIZE);
+
+	virtual ~ParamTextLoader();
+
+	//*************************************** PUBLIC FUNCTIONS *****************************************//
+
+	/** @brief Replaces values of every parameter of group with values read from given file.
+	 *
+	 * @param fileName
+	 * @return
+	 *
+	 * @throw ParameterModelExceptions::DataFileException if file cannot be read.
+	 */
+	ParamLoadReport load(const std::string& fileName)
+			throw (ParameterModelExceptions::DataFileException);
+
+};
+
+#endif /* PARAMTEXTLOADER_HPP_ */
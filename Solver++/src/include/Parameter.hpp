@@ -10,86 +10,110 @@
 
 #include <string>
 
+#include "exp/ParameterModelExeptions.hpp"
 #include "Typedefs.hpp"
 
+class ParamIdxMapper;
+
+template<ParamDimIdx N>
+class ParamGroup;
+
+/** @brief Defines parameter (named number) of LP/MIP optimization problem.
+ *
+ * @details Parameters are data of the model (costs, demands, distances...) that are used to compute
+ * coefficients and bounds of rows. Value of every parameter is stored in dense array of its group
+ * (@see ParamIdxMapper), so Parameter does not own any data - it is a lightweight view
+ * that can be freely copied and passed by value. View stays valid as long as group of parameters
+ * to which it belongs exists.
+ *
+ * Example:
+ * @code
+ * 	Solver s(SolverInterface::GLPK);
+ * 	s.newParameter("demand[10]", 0, 0, 100, ValueType::INTEGER);
+ * 	s.getParameter("demand[3]").setValue(20);
+ * 	s.getParameter("demand[3]").setValue(120);	// will throw ParameterModelExceptions::ValueOutOfBoundException
+ * @endcode
+ *
+ */
 class Parameter {
 
+	friend class ParamIdxMapper;
+
+	template<ParamDimIdx N>
+	friend class ParamGroup;
+
 private:
 
 	//************************************ PRIVATE CONSTANT FIELDS *************************************//
 
 	//***************************************** CLASS FIELDS *******************************************//
 
-	/** Lower bound of this parameter.
-	 *
-	 * Value of this parameter cannot be less than it's LB (LB <= parameter <= UB).
-	 *
-	 */
-	ParamValue lowerBonud;
-
-	/** Upper bound of this parameter.
-	 *
-	 * Value of this parameter cannot be greater than it's LB (LB <= parameter <= UB).
+	/** @brief Group of parameters to which this parameter belongs.
 	 *
 	 */
-	ParamValue upperBound;
+	ParamIdxMapper* parameterGroup;
 
-	/** Value of this parameter.
-	 *
-	 * Value which this parameter can take is bounded by it's lower and upper bound.
-	 *
-	 */
-	ParamValue value;
-
-	/** Stores actual parameter full name.
-	 *
-	 * Example:
-	 * 	p, param[2], parameter[3][4]
+	/** @brief Index of value of this parameter in array of values of its group (@see ParamIdxMapper::getValues()).
 	 *
 	 */
-	std::string parameterName;
+	ParamIdx idx;
 
 	//*************************************** PRIVATE FUNCTIONS ****************************************//
 
-	//************************************* PUBLIC CONSTANT FIELDS *************************************//
-
-public:
-
 	//************************************ CONSTRUCTOR & DESTRUCTOR ************************************//
 
-	/** Creates new parameter with default value 0.
+	/** @brief Creates a view of parameter stored at given index of group of parameters.
 	 *
-	 * @param lowerBonud value of this parameter cannot be less then this value
-	 * @param upperBound value of this parameter cannot be greater then this value
+	 * @param parameterGroup group of parameters to which this parameter belongs
+	 * @param idx index of value of this parameter in group
 	 */
-	Parameter(ParamValue lowerBonud, ParamValue upperBound);
+	Parameter(ParamIdxMapper* parameterGroup, const ParamIdx idx);
 
-	virtual ~Parameter();
+	//************************************* PUBLIC CONSTANT FIELDS *************************************//
+
+public:
 
 	//*************************************** PUBLIC FUNCTIONS *****************************************//
 
-	/** Checks if given value extends this parameter's bounds.
+	/** @brief Checks if given value extends this parameter's bounds.
 	 *
 	 * @param value
 	 * @return true if given value does extend lower or upper bound of this parameter, false if it's not.
 	 */
-	bool isParameterOutOfBounds(const ParamValue value);
+	bool isParameterOutOfBounds(const ParamValue value) const;
 
-	/** Returns string representation of this class.
+	/** @brief Returns string representation of this class.
 	 *
 	 * @return
 	 */
-	std::string toString();
+	std::string toString() const;
 
 	//*************************************** GETTERS & SETTERS ****************************************//
 
-	void setParameterName(const std::string& parameterName);
+	ParamValue getValue() const;
 
-	ParamValue getLowerBonud() const;
+	/** @brief Sets new value of this parameter.
+	 *
+	 * @param value
+	 *
+	 * @throw ParameterModelExceptions::ValueOutOfBoundException if given value is out of bounds of this parameter.
+	 */
+	void setValue(const ParamValue value)
+			throw (ParameterModelExceptions::ValueOutOfBoundException);
+
+	ParamValue getLowerBound() const;
 
 	ParamValue getUpperBound() const;
 
-	const std::string& getParameterName() const;
+	/** @brief Returns full name of this parameter e.g. "p[2][3]".
+	 *
+	 * @details Name is generated on every call (@see ParamIdxMapper::getParameterName()).
+	 *
+	 * @return
+	 */
+	std::string getParameterName() const;
+
+	ParamIdx getIdx() const;
 
 };
 
@@ -8,46 +8,115 @@
 #ifndef PARAMETERMAPPER_HPP_
 #define PARAMETERMAPPER_HPP_
 
-#include <list>
+#include <stddef.h>
 #include <string>
 
+#include "DimensionTable.hpp"
+#include "Solver.hpp"
 #include "Typedefs.hpp"
+#include "utils/TensorFileUtils.hpp"
 
 class Parameter;
 
+/** @brief Read-only view of contiguous part of values of group of parameters.
+ *
+ * @details Values are stored in row-major order (the last dimension changes the fastest), so e.g. row i
+ * of matrix p[n][m] is a span of m values (@see ParamGroup::span()) that can be passed directly
+ * to any code that computes coefficients.
+ *
+ */
+struct ParamSpan {
+
+	/** @brief The first value of span.
+	 *
+	 */
+	const ParamValue* data;
+
+	/** @brief Number of values of span.
+	 *
+	 */
+	size_t size;
+
+	/** @brief Returns value at given (0-based) position of span.
+	 *
+	 * @param position
+	 * @return
+	 */
+	const ParamValue& operator[](const size_t position) const {
+		return this->data[position];
+	}
+
+	const ParamValue* begin() const {
+		return this->data;
+	}
+
+	const ParamValue* end() const {
+		return this->data + this->size;
+	}
+
+};
+
+/** @brief Contains values and all informations about grouped parameters.
+ *
+ * @details Every group of parameters is a dense, row-major tensor of numbers: values of all parameters
+ * are stored in one contiguous array aligned to #ALIGNMENT bytes, located by the same stride arithmetic
+ * as variables and rows (@see DimensionTable). Parameters themselves are not objects - Parameter is
+ * a lightweight view of single value of this array.
+ *
+ * Example:
+ * @code
+ * 	Solver s(SolverInterface::GLPK);
+ * 	s.newParameter("distance[1000][1000]");	// 10^6 doubles in one array
+ * 	ParamGroup<2> distance = s.paramGroup<2>("distance");
+ * 	distance(3, 4);							// value of distance[3][4]
+ * 	distance.span(3);						// values of distance[3][1], ..., distance[3][1000]
+ * @endcode
+ *
+ */
 class ParamIdxMapper {
 
+	friend Parameter Solver::getParameter(const std::string& parameterDefinition)
+			throw (ParameterModelExceptions::NoSuchGroupException,
+			ParameterModelExceptions::InvalidNumberOfDimensionIndexesException,
+			ParameterModelExceptions::IndexOutOfBoundException,
+			ParameterModelExceptions::InvalidDefinitionException);
+
 private:
 
 	//************************************ PRIVATE CONSTANT FIELDS *************************************//
 
 	//***************************************** CLASS FIELDS *******************************************//
 
-	/** Index of the first parameter in array/matrix or more dimensional structure.
+	/** @brief Every parameter may have multiple dimensions.
 	 *
-	 */
-	ParamIdx beginIdx;
-
-	/** Every parameter may have multiple dimensions.
-	 *
-	 * List contains naturally ordered dimensional indexes of that parameter (from the highest dimension to the lowest).
-	 * If created parameter is 0-dimensional structure then dimensions list will be empty.
+	 * @details Table contains naturally ordered sizes of dimensions of that parameter (from the highest dimension to the lowest)
+	 * along with their strides. If created parameter is 0-dimensional structure then table will have no dimensions.
 	 *
 	 * Example:
 	 *
-	 * 	For given group of parameters "p[1][2][3]" dimensions list will contain elements: 1, 2 and 3.
+	 * 	For given group of parameters "p[1][2][3]" dimensions table will contain extents: 1, 2 and 3.
 	 *
 	 */
-	std::list<ParamDimIdx> dimensions;
+	ParamDimensionTable dimensions;
 
-	/** Number of parameters in array/matrix or more dimensional structure.
+	/** @brief Number of parameters in array/matrix or more dimensional structure.
 	 *
 	 */
 	ParamIdx numberOfParameters;
 
-	/** Type of parameter.
+	/** @brief Value of any parameter of this group cannot be less than this bound.
+	 *
+	 */
+	ParamValue lowerBound;
+
+	/** @brief Value of any parameter of this group cannot be greater than this bound.
+	 *
+	 */
+	ParamValue upperBound;
+
+	/** @brief Type of parameter.
 	 *
-	 * In Osi Solver Interface, parameters are not needed,
+	 * @details In Osi Solver Interface, parameters are not needed,
 	 * they are just passed by value to matrix of linear equations/inequalities from which LP/MIP problem is consists of.
 	 * Therefore there is no need for specifying a type of parameter for OSI but Solver class
 	 * can decided which lower and upper bounds the newly created parameter should have without defining them separately.
@@ -55,83 +124,106 @@ private:
 	 */
 	ValueType type;
 
-	/** Array of mapped parameters.
+	/** @brief Values of every parameter of this group.
+	 *
+	 * @details Regardless of the number of dimensions in group of parameters that was defined,
+	 * all of them are linearized (row-major order) into one array of #numberOfParameters values
+	 * aligned to #ALIGNMENT bytes.
+	 *
+	 */
+	ParamValue* values;
+
+	/** @brief Tensor file in which #values are stored (@see TensorFileUtils::map()).
 	 *
-	 * Calling the constructor will create numberOfParameters parameters with given type and bounds.
-	 * Regardless of the number of dimensions in group of parameters that was defined,
-	 * all of them will be linearized and assigned to the appropriate indexes in one-dimensional array.
+	 * @details Nothing is mapped if values are stored in memory allocated by this group.
 	 *
 	 */
-	Parameter** parameters;
+	TensorFileUtils::Mapping mapping;
 
-	/** Stores actual name of this group of parameters.
+	/** @brief Stores actual name of this group of parameters.
 	 *
 	 */
 	std::string groupName;
 
 	//*************************************** PRIVATE FUNCTIONS ****************************************//
 
-	bool ifDimensionsOutOfBounds(const std::list<ParamDimIdx>& dimensions);
-
-	/** Returns pointer to parameter in 'this' group of parameters with given indexes.
+	/** @brief Returns view of parameter in 'this' group of parameters with given indexes.
 	 *
 	 * @param dimensions
-	 * @return pointer to parameter with given index from parameters array of pointers
-	 * where given index is calculated based on given list of dimensions and linearized afterwards.
+	 * @return view of value at index i of #values where i is calculated based on given list of dimensions
+	 * and linearized afterwards.
 	 */
-	Parameter& getParameter(const std::list<ParamDimIdx>& dimensions);
-
-	ParamIdx linearizeDimensionList(const std::list<ParamDimIdx>& dimensions);
+	Parameter getParameter(const ParamIndexTuple& dimensions);
 
 public:
 
 	//************************************* PUBLIC CONSTANT FIELDS *************************************//
 
+	/** @brief Alignment (in bytes) of array of values of every group of parameters.
+	 *
+	 */
+	const static size_t ALIGNMENT { 64 };
+
 	//************************************ CONSTRUCTOR & DESTRUCTOR ************************************//
 
-	/** Creates parameter group with given dimensions and type.
+	/** @brief Creates group of parameters with given dimensions, bounds and value.
 	 *
-	 * Any group of parameters is defined by string that matches regular expression (@see Solver::VAR_REGEX)
+	 * @details Any group of parameters is defined by string that is a valid definition (@see StringUtils::parseDefinition())
 	 * and it consists of parameter base name and array-like list of group's dimensions.
 	 *
 	 * Example:
 	 *
-	 * Solver::newparameter("x[3][4]", ParamType::DOUBLE) ->
-	 * ParamIdxMapper("x", beginIdx, {{3},{4}}, ParamType::DOUBLE)
-	 * will result in creating of group of 12 parameters of default type (double).
-	 * parameters array will be filled with parameters with given lower and upper bounds in given order:
-	 * [x[1][1], x[1][2], x[1][3], ..., x[3][3], x[3][4]]
+	 * Solver::newParameter("p[3][4]", 0) ->
+	 * ParamIdxMapper({3, 4}, -inf, inf, ValueType::DOUBLE, 0, "p")
+	 * will result in creating of group of 12 parameters of default type (double), all of them equal to 0
+	 * and stored in given order: [p[1][1], p[1][2], p[1][3], ..., p[3][3], p[3][4]].
 	 *
-	 * BeginIdx will be calculated based on current number
-	 * of existing parameters/columns (@see OsiProblemInstance::numberOfColumns).
-	 *
-	 * @param firstIdx number of all existing parameters increased by one, index of the first parameter in this group
 	 * @param dimensions part of string-like parameters' group declaration
-	 * @param numberOfParameters number of parameters in this group
 	 * @param parameterLowerBound lower bound of every parameter in group
 	 * @param parameterUpperBound upper bound of every parameter in group
 	 * @param type type of all parameters in this group
+	 * @param value initial value of every parameter in group
 	 * @param groupName name of group of parameters
 	 *
+	 * @throw std::bad_alloc if array of values cannot be allocated.
+	 */
+	ParamIdxMapper(const ParamDimensionTable& dimensions,
+			const ParamValue parameterLowerBound,
+			const ParamValue parameterUpperBound, const ValueType type,
+			const ParamValue value, const std::string& groupName);
+
+	/** @brief Creates unbounded group of parameters (ValueType::DOUBLE) whose values are stored in mapped tensor file.
+	 *
+	 * @details Values are used in place - nothing is copied and pages of file that are never touched are never read.
+	 * Group takes ownership of given mapping and unmaps it when it is deleted.
+	 *
+	 * @param dimensions dimensions of group of parameters stored in file
+	 * @param mapping memory mapping of tensor file (@see TensorFileUtils::map())
+	 * @param dataOffset offset of the first value in file (multiple of ALIGNMENT)
+	 * @param groupName name of group of parameters
 	 */
-	ParamIdxMapper(const ParamIdx firstIdx,
-			const std::list<ParamDimIdx>& dimensions,
-			const ParamIdx numberOfParameters,
-			const VarValue parameterLowerBound,
-			const VarValue parameterUpperBound, const ValueType type,
+	ParamIdxMapper(const ParamDimensionTable& dimensions,
+			const TensorFileUtils::Mapping& mapping, const size_t dataOffset,
 			const std::string& groupName);
 
 	virtual ~ParamIdxMapper();
 
 	//*************************************** PUBLIC FUNCTIONS *****************************************//
 
-	/** Returns string representation of this class.
+	/** @brief Checks if given value extends bounds of parameters of this group.
+	 *
+	 * @param value
+	 * @return true if given value does extend lower or upper bound, false if it's not.
+	 */
+	bool isValueOutOfBounds(const ParamValue value) const;
+
+	/** @brief Returns string representation of this class.
 	 *
 	 * @return
 	 */
 	std::string toString();
 
-	/** Returns number of dimensions of this group.
+	/** @brief Returns number of dimensions of this group.
 	 *
 	 * @return
 	 */
@@ -139,17 +231,55 @@ public:
 
 	//*************************************** GETTERS & SETTERS ****************************************//
 
-	/** Returns value of beginIdx field.
+	/** @brief Returns number of parameters in this group.
+	 *
+	 * @return
+	 */
+	ParamIdx getNumberOfParameters() const;
+
+	/** @brief Returns full name of parameter with given index in this group e.g. "p[2][3]".
+	 *
+	 * @details Names of parameters are never kept, they are generated on every request (@see MapUtils::getVariableName()).
+	 *
+	 * @param idx index of parameter in this group
+	 * @return
+	 */
+	std::string getParameterName(const ParamIdx idx) const;
+
+	/** @brief Returns name of this group of parameters.
+	 *
+	 * @return
+	 */
+	const std::string& getGroupName() const;
+
+	/** @brief Returns dimensions table.
 	 *
 	 * @return
 	 */
-	ParamIdx getBeginIdx() const;
+	const ParamDimensionTable& getDimensions() const;
+
+	ParamValue getLowerBound() const;
+
+	ParamValue getUpperBound() const;
+
+	ValueType getType() const;
+
+	/** @brief Returns array of values of every parameter of this group.
+	 *
+	 * @details Values written directly into this array (e.g. by data loaders) are not checked against bounds
+	 * of this group (@see isValueOutOfBounds()).
+	 *
+	 * @return
+	 */
+	ParamValue* getValues();
+
+	const ParamValue* getValues() const;
 
-	/** Returns dimensions list.
+	/** @brief Returns span of values of every parameter of this group.
 	 *
 	 * @return
 	 */
-	const std::list<ParamDimIdx>& getDimensions() const;
+	ParamSpan getSpan() const;
 
 };
 
@@ -0,0 +1,366 @@
+/*
+ * Presolve.hpp
+ *
+ *  Created on: 17 paź 2026
+ *      Author: tomasz
+ */
+
+#ifndef PRESOLVE_HPP_
+#define PRESOLVE_HPP_
+
+#include <stddef.h>
+#include <vector>
+
+#include "Solution.hpp"
+#include "Typedefs.hpp"
+
+class CoefficientMatrix;
+class OsiSolverInterface;
+
+/** @brief Reductions of LP problem made before it is passed to the solver and mapping of reduced solution
+ * back onto the whole problem (@see OsiProblemInstance::setPresolveEnabled()).
+ *
+ * @details Presolve works on copy of the problem (columns, rows and compressed coefficients) and repeats
+ * following reductions until none of them changes the problem (at most #MAX_NUMBER_OF_PASSES times):
+ * - fixed columns (fixed by user or with equal bounds) are removed and moved into bounds of their rows
+ * and into constant term of objective function,
+ * - empty rows are removed (after their feasibility is checked),
+ * - rows with single coefficient (singleton rows) are turned into bounds of their column,
+ * - bounds of columns are tightened by bounds implied by minimal and maximal activity of rows;
+ * rows that cannot be violated by any values within bounds of their columns are removed,
+ * - rows whose coefficients are multiple of coefficients of another row (duplicate rows)
+ * are merged into that row.
+ *
+ * Postsolve (@see postsolve()) restores values of removed columns, takes row prices of kept rows from the solver,
+ * computes reduced costs of all columns from them and moves reduced costs of columns whose active bounds have been
+ * given by rows (singleton rows or activities of rows) and row prices of active duplicate rows back onto those rows.
+ * Row prices of removed empty and redundant rows are 0.
+ *
+ * If presolve finds that problem is infeasible, problem is passed to the solver without reductions,
+ * so status of solve is reported by the solver.
+ *
+ */
+class Presolve {
+
+	friend class OsiProblemInstance;
+
+private:
+
+	//************************************ PRIVATE CONSTANT FIELDS *************************************//
+
+	/** @brief Maximal number of passes of all reductions.
+	 *
+	 */
+	const static unsigned int MAX_NUMBER_OF_PASSES { 16 };
+
+	/** @brief Source of bound that has not been given by singleton or duplicate row.
+	 *
+	 */
+	const static RowIdx NO_SOURCE { static_cast<RowIdx>(-1) };
+
+	/** @brief Feasibility tolerance (relative to magnitude of compared values).
+	 *
+	 */
+	static const double TOLERANCE;
+
+	/** @brief Minimal relative improvement of bound of column tightened by activities of rows
+	 * (smaller improvements only slow down presolve).
+	 *
+	 */
+	static const double MIN_IMPROVEMENT;
+
+	//****************************************** CLASS TYPES *******************************************//
+
+	/** @brief Reduction that has to be reverted by postsolve.
+	 *
+	 */
+	struct Reduction {
+
+		enum Type {
+			SINGLETON_ROW, //!< row #rowIdx turned into bounds of column #idx
+			IMPLIED_BOUND, //!< bound of column #idx tightened by activity of row #rowIdx
+			DUPLICATE_ROW  //!< row #rowIdx merged into row #idx
+		};
+
+		Type type;
+
+		RowIdx rowIdx;
+
+		/** @brief Column of singleton row or row into which duplicate row has been merged.
+		 *
+		 */
+		VarIdx idx;
+
+		/** @brief Coefficient of column in row or ratio of coefficients of duplicate row to coefficients of kept row.
+		 *
+		 */
+		VarValue coefficient;
+
+	};
+
+	//***************************************** CLASS FIELDS *******************************************//
+
+	VarIdx numberOfColumns;
+
+	RowIdx numberOfRows;
+
+	/** @brief Infinity of the solver.
+	 *
+	 */
+	VarValue infinity;
+
+	/** @brief Coefficients of the whole problem in column-major (CSC) form (zero coefficients are dropped).
+	 *
+	 */
+	std::vector<size_t> columnStart;
+
+	std::vector<RowIdx> columnRowIdx;
+
+	std::vector<VarValue> columnElement;
+
+	/** @brief Coefficients of the whole problem in row-major (CSR) form (columns of every row are sorted).
+	 *
+	 */
+	std::vector<size_t> rowStart;
+
+	std::vector<VarIdx> rowColumnIdx;
+
+	std::vector<VarValue> rowElement;
+
+	std::vector<VarValue> objective;
+
+	/** @brief Current bounds of columns (value of removed column is its lower bound).
+	 *
+	 */
+	std::vector<VarValue> columnLower;
+
+	std::vector<VarValue> columnUpper;
+
+	/** @brief Singleton rows or rows whose activities gave current bounds of columns (#NO_SOURCE for other bounds).
+	 *
+	 */
+	std::vector<RowIdx> columnLowerSource;
+
+	std::vector<RowIdx> columnUpperSource;
+
+	/** @brief Current bounds of rows (shifted by removed columns).
+	 *
+	 */
+	std::vector<VarValue> rowLower;
+
+	std::vector<VarValue> rowUpper;
+
+	/** @brief Duplicate rows that gave current bounds of rows (#NO_SOURCE for other bounds).
+	 *
+	 */
+	std::vector<RowIdx> rowLowerSource;
+
+	std::vector<RowIdx> rowUpperSource;
+
+	std::vector<char> columnRemoved;
+
+	std::vector<char> rowRemoved;
+
+	/** @brief Number of coefficients of every row at columns that have not been removed.
+	 *
+	 */
+	std::vector<VarIdx> rowLength;
+
+	/** @brief Reductions in order in which they have been made.
+	 *
+	 */
+	std::vector<Reduction> reductions;
+
+	/** @brief Constant term of objective function given by removed columns.
+	 *
+	 */
+	VarValue objectiveOffset;
+
+	bool infeasible;
+
+	size_t numberOfFixedColumns;
+
+	size_t numberOfSingletonRows;
+
+	size_t numberOfEmptyRows;
+
+	size_t numberOfRedundantRows;
+
+	size_t numberOfDuplicateRows;
+
+	size_t numberOfTightenedBounds;
+
+	/** @brief Columns of the whole problem that are passed to the solver (in order of reduced problem).
+	 *
+	 */
+	std::vector<VarIdx> columnMap;
+
+	/** @brief Rows of the whole problem that are passed to the solver (in order of reduced problem).
+	 *
+	 */
+	std::vector<RowIdx> rowMap;
+
+	/** @brief Arrays of the last postsolved solution in order of Solution::Part enumeration
+	 * (empty if solver did not provide them).
+	 *
+	 */
+	std::vector<VarValue> solution[3];
+
+	//*************************************** PRIVATE FUNCTIONS ****************************************//
+
+	bool isFinite(const VarValue value) const {
+		return value > -this->infinity && value < this->infinity;
+	}
+
+	/** @brief Returns true if value is greater than bound by more than #TOLERANCE.
+	 *
+	 * @param value
+	 * @param bound
+	 * @return
+	 */
+	static bool exceeds(const VarValue value, const VarValue bound);
+
+	/** @brief Sets lower bound of given column and remembers row that gave it.
+	 *
+	 * @param columnIdx
+	 * @param lowerBound
+	 * @param source
+	 */
+	void setColumnLower(const VarIdx columnIdx, const VarValue lowerBound,
+			const RowIdx source);
+
+	/** @brief Sets upper bound of given column and remembers row that gave it.
+	 *
+	 * @param columnIdx
+	 * @param upperBound
+	 * @param source
+	 */
+	void setColumnUpper(const VarIdx columnIdx, const VarValue upperBound,
+			const RowIdx source);
+
+	/** @brief Removes given column with given value - moves it into bounds of its rows and into #objectiveOffset.
+	 *
+	 * @param columnIdx
+	 * @param value
+	 */
+	void removeColumn(const VarIdx columnIdx, const VarValue value);
+
+	/** @brief Removes columns whose bounds are equal.
+	 *
+	 * @return true if any column has been removed
+	 */
+	bool removeFixedColumns();
+
+	/** @brief Removes empty rows and turns singleton rows into bounds of their columns.
+	 *
+	 * @return true if any row has been removed
+	 */
+	bool removeShortRows();
+
+	/** @brief Tightens bounds of columns by activities of rows and removes rows that cannot be violated.
+	 *
+	 * @return true if any bound has been tightened or any row has been removed
+	 */
+	bool tightenBounds();
+
+	/** @brief Returns true if row with given index is multiple of given kept row.
+	 *
+	 * @param keptRowIdx
+	 * @param rowIdx
+	 * @param ratio output ratio of coefficients of given row to coefficients of kept row
+	 * @return
+	 */
+	bool isDuplicate(const RowIdx keptRowIdx, const RowIdx rowIdx,
+			VarValue& ratio) const;
+
+	/** @brief Merges duplicate rows into the first of them.
+	 *
+	 * @return true if any row has been merged
+	 */
+	bool removeDuplicateRows();
+
+	/** @brief Subtracts given change of row price of given row from reduced costs of its columns.
+	 *
+	 * @param rowIdx
+	 * @param change
+	 */
+	void changeRowPrice(const RowIdx rowIdx, const VarValue change);
+
+	/** @brief Reduces problem.
+	 *
+	 * @return false if problem is infeasible (it must not be reduced then)
+	 */
+	bool run();
+
+	/** @brief Maps solution of reduced problem found by given solver back onto the whole problem.
+	 *
+	 * @param si
+	 */
+	void postsolve(const OsiSolverInterface* si);
+
+	/** @brief Returns given array of the last postsolved solution.
+	 *
+	 * @param part
+	 * @return nullptr if the solver did not provide that array
+	 */
+	const VarValue* getSolution(const Solution::Part part) const;
+
+	//************************************ CONSTRUCTOR & DESTRUCTOR ************************************//
+
+	/** @brief Copies problem that is going to be reduced.
+	 *
+	 * @param coefficients
+	 * @param numberOfColumns
+	 * @param numberOfRows
+	 * @param objective
+	 * @param columnLower bounds of columns as they are passed to the solver
+	 * @param columnUpper
+	 * @param rowLower
+	 * @param rowUpper
+	 * @param infinity infinity of the solver
+	 */
+	Presolve(const CoefficientMatrix& coefficients,
+			const VarIdx numberOfColumns, const RowIdx numberOfRows,
+			const VarValue* objective, const VarValue* columnLower,
+			const VarValue* columnUpper, const VarValue* rowLower,
+			const VarValue* rowUpper, const VarValue infinity);
+
+public:
+
+	//************************************* PUBLIC CONSTANT FIELDS *************************************//
+
+	//************************************ CONSTRUCTOR & DESTRUCTOR ************************************//
+
+	virtual ~Presolve();
+
+	//*************************************** PUBLIC FUNCTIONS *****************************************//
+
+	//*************************************** GETTERS & SETTERS ****************************************//
+
+	/** @brief Returns number of columns passed to the solver.
+	 *
+	 * @return
+	 */
+	VarIdx getNumberOfReducedColumns() const {
+		return static_cast<VarIdx>(this->columnMap.size());
+	}
+
+	/** @brief Returns number of rows passed to the solver.
+	 *
+	 * @return
+	 */
+	RowIdx getNumberOfReducedRows() const {
+		return static_cast<RowIdx>(this->rowMap.size());
+	}
+
+	/** @brief Returns constant term of objective function given by removed columns.
+	 *
+	 * @return
+	 */
+	VarValue getObjectiveOffset() const {
+		return this->objectiveOffset;
+	}
+
+};
+
+#endif /* PRESOLVE_HPP_ */
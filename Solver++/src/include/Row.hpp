@@ -8,49 +8,209 @@
 #ifndef INCLUDE_ROW_HPP_
 #define INCLUDE_ROW_HPP_
 
+#include <stddef.h>
+#include <string>
 
+#include "exp/VariableModelExeptions.hpp"
+#include "LinearExpr.hpp"
+#include "Typedefs.hpp"
 
+class OsiProblemInstance;
+
+class RowIdxMapper;
+
+class Variable;
+
+template<RowDimIdx N>
+class RowGroup;
+
+/** @brief Defines single linear equation/inequality in LP/MIP optimization problem.
+ *
+ * @details Each row has its own lower and upper bound of its left-hand side expression
+ * which is a sum of coefficients of variables multiplied by those variables:
+ *
+ * @code
+ * 	lowerBound <= a1 * x1 + a2 * x2 + ... + an * xn <= upperBound
+ * @endcode
+ *
+ * Equality is defined by equal bounds and one-sided inequalities by unbounded lower or upper bound
+ * (@see Utils::getUnbounded()).
+ *
+ * Row does not own any data - it is a lightweight view into row arrays
+ * of problem instance (@see OsiProblemInstance) in the same way as Variable is a view into column arrays.
+ * Coefficients added through this view are appended to the problem instance and passed to the solver
+ * all at once (@see Solver::loadProblem()).
+ *
+ * Example (1st row of model from Variable class example):
+ * @code
+ * 	Solver s(SolverInterface::GLPK);
+ * 	s.newVariable("x[2]", 0, Utils::getUnbounded(Bounds::UPPER), ValueType::DOUBLE);
+ * 	s.newRows("c[2]", Utils::getUnbounded(Bounds::LOWER), 3);
+ *
+ * 	Row c1 = s.getRow("c[1]");
+ * 	c1.addElement(s.getVariable("x[1]"), 1);
+ * 	c1.addElement(s.getVariable("x[2]"), 2);
+ * @endcode
+ *
+ */
 class Row {
-private:
 
+	friend class RowIdxMapper;
 
-	//************************************ PRIVATE CONSTANT FIELDS *************************************//
+	template<RowDimIdx N>
+	friend class RowGroup;
 
+private:
 
+	//************************************ PRIVATE CONSTANT FIELDS *************************************//
 
 	//***************************************** CLASS FIELDS *******************************************//
 
+	/** @brief Problem instance that stores bounds and coefficients of this row.
+	 *
+	 */
+	OsiProblemInstance* problemInstance;
 
+	/** @brief Group of rows to which this row belongs.
+	 *
+	 */
+	const RowIdxMapper* rowGroup;
 
-	//*************************************** PRIVATE FUNCTIONS ****************************************//
+	/** @brief Index of this row in problem instance.
+	 *
+	 */
+	RowIdx rowIdx;
 
+	//*************************************** PRIVATE FUNCTIONS ****************************************//
 
-public:
+	/** @brief Logs and throws exception for column that does not exist in problem instance.
+	 *
+	 * @param columnIdx
+	 */
+	void throwColumnOutOfBounds(const VarIdx columnIdx) const
+			throw (VariableModelExceptions::IndexOutOfBoundException);
+
+	/** @brief Adds merged terms of given buffer to this row and sets its new bounds.
+	 *
+	 * @param buffer terms of expression (@see LinearExprBuffer::mergeDuplicates())
+	 * @param lowerBound lower bound of expression (constant terms are moved to the right-hand side)
+	 * @param upperBound upper bound of expression (constant terms are moved to the right-hand side)
+	 */
+	void addTerms(const LinearExprBuffer& buffer, const VarValue lowerBound,
+			const VarValue upperBound);
 
+	//************************************ CONSTRUCTOR & DESTRUCTOR ************************************//
 
-	//************************************* PUBLIC CONSTANT FIELDS *************************************//
+	/** @brief Creates a view of row stored at given index of problem instance.
+	 *
+	 * @param problemInstance problem instance that stores this row
+	 * @param rowGroup group of rows to which this row belongs
+	 * @param rowIdx index of row in problem instance
+	 */
+	Row(OsiProblemInstance* problemInstance, const RowIdxMapper* rowGroup,
+			const RowIdx rowIdx);
 
+public:
 
+	//************************************* PUBLIC CONSTANT FIELDS *************************************//
 
 	//**************************************** CONSTANT FIELDS *****************************************//
 
+	//*************************************** PUBLIC FUNCTIONS *****************************************//
 
+	/** @brief Adds coefficient of given variable to this row.
+	 *
+	 * @details Coefficients of the same variable added more than once are summed up.
+	 *
+	 * @param variable
+	 * @param coefficient
+	 */
+	void addElement(const Variable& variable, const VarValue coefficient);
+
+	/** @brief Adds coefficient of variable stored in given column to this row.
+	 *
+	 * @details Cheaper version of addElement(const Variable&, const VarValue)
+	 * that can be used together with VarGroup::getColumnIdx().
+	 *
+	 * @param columnIdx
+	 * @param coefficient
+	 *
+	 * @throw VariableModelExceptions::IndexOutOfBoundException if column does not exist in problem instance.
+	 */
+	void addElement(const VarIdx columnIdx, const VarValue coefficient)
+			throw (VariableModelExceptions::IndexOutOfBoundException);
+
+	/** @brief Adds coefficients of many variables to this row at once.
+	 *
+	 * @details All columns are checked before any coefficient is added.
+	 *
+	 * @param columnIdx array of count columns
+	 * @param coefficient array of count coefficients
+	 * @param count
+	 *
+	 * @throw VariableModelExceptions::IndexOutOfBoundException if any column does not exist in problem instance.
+	 */
+	void addElements(const VarIdx* columnIdx, const VarValue* coefficient,
+			const size_t count)
+					throw (VariableModelExceptions::IndexOutOfBoundException);
+
+	/** @brief Adds terms of given constraint to this row and replaces its bounds with bounds of constraint.
+	 *
+	 * @details Whole expression is evaluated in a single pass (@see LinearExpr), duplicated columns are merged
+	 * and constant terms are moved to bounds, e.g.:
+	 * @code
+	 * 	c(1).setConstraint(2 * x(1) + 3 * x(2) - x(1) + 4 <= 10);	// 1 * x(1) + 3 * x(2) <= 6
+	 * @endcode
+	 *
+	 * Coefficients added to this row before are kept.
+	 *
+	 * @param constraint
+	 */
+	template<typename E>
+	void setConstraint(const Constraint<E>& constraint) {
+		LinearExprBuffer& buffer = LinearExprBuffer::getThreadLocal();
+		constraint.emit(buffer);
+		addTerms(buffer, constraint.lowerBound, constraint.upperBound);
+	}
+
+	/** @brief Adds terms of given expression to this row.
+	 *
+	 * @details Constant terms of expression are moved to bounds of this row.
+	 *
+	 * @param expression
+	 */
+	template<typename E>
+	void addExpression(const LinearExpr<E>& expression) {
+		LinearExprBuffer& buffer = LinearExprBuffer::getThreadLocal();
+		expression.emit(buffer, 1);
+		buffer.mergeDuplicates();
+		addTerms(buffer, getLowerBound(), getUpperBound());
+	}
+
+	/** @brief Returns string representation of this row.
+	 *
+	 * @return
+	 */
+	std::string toString() const;
 
-	//************************************ CONSTRUCTOR & DESTRUCTOR ************************************//
-
-	Row();
+	//*************************************** GETTERS & SETTERS ****************************************//
 
-	virtual ~Row();
+	VarValue getLowerBound() const;
 
-	//*************************************** PUBLIC FUNCTIONS *****************************************//
+	void setLowerBound(const VarValue lowerBound);
 
+	VarValue getUpperBound() const;
 
+	void setUpperBound(const VarValue upperBound);
 
-	//*************************************** GETTERS & SETTERS ****************************************//
-
+	RowIdx getRowIdx() const;
 
+	/** @brief Returns full name of this row e.g. "c[2]".
+	 *
+	 * @return
+	 */
+	std::string getRowName() const;
 
 };
 
-
 #endif /* INCLUDE_ROW_HPP_ */
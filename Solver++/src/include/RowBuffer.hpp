@@ -0,0 +1,189 @@
+/*
+ * RowBuffer.hpp
+ *
+ *  Created on: 17 paź 2026
+ *      Author: tomasz
+ */
+
+#ifndef ROWBUFFER_HPP_
+#define ROWBUFFER_HPP_
+
+#include <stddef.h>
+#include <vector>
+
+#include "LinearExpr.hpp"
+#include "Typedefs.hpp"
+
+/** @brief Thread-local buffer of coefficients and bounds of rows generated by one worker thread.
+ *
+ * @details Every worker thread started by Solver::generateRows() owns exactly one buffer,
+ * so appending to it takes no locks. Buffer remembers which task produced which part of it (@see Segment)
+ * which allows Solver to merge buffers of all threads in order of tasks - model is then exactly the same
+ * regardless of number of threads that generated it.
+ *
+ * Rows have to exist before they are generated (@see Solver::newRows()) - buffer refers to them
+ * by their indexes (@see RowGroup::getRowIdx(), VarGroup::getColumnIdx()).
+ *
+ */
+class RowBuffer {
+
+	friend class Solver;
+
+private:
+
+	//************************************ PRIVATE CONSTANT FIELDS *************************************//
+
+	//****************************************** CLASS TYPES *******************************************//
+
+	/** @brief Part of buffer filled by single batch of tasks.
+	 *
+	 */
+	struct Segment {
+
+		/** @brief Index of the first coefficient of this segment (@see #rowIdx).
+		 *
+		 */
+		size_t elementsBegin;
+
+		/** @brief Number of coefficients of this segment.
+		 *
+		 */
+		size_t numberOfElements;
+
+		/** @brief Index of the first bound of this segment (@see #boundRowIdx).
+		 *
+		 */
+		size_t boundsBegin;
+
+		/** @brief Number of bounds of this segment.
+		 *
+		 */
+		size_t numberOfBounds;
+
+	};
+
+	//***************************************** CLASS FIELDS *******************************************//
+
+	/** @brief Rows of buffered coefficients.
+	 *
+	 */
+	std::vector<RowIdx> rowIdx;
+
+	/** @brief Columns of buffered coefficients.
+	 *
+	 */
+	std::vector<VarIdx> columnIdx;
+
+	/** @brief Values of buffered coefficients.
+	 *
+	 */
+	std::vector<VarValue> value;
+
+	/** @brief Rows of buffered bounds.
+	 *
+	 */
+	std::vector<RowIdx> boundRowIdx;
+
+	/** @brief Buffered lower bounds of rows.
+	 *
+	 */
+	std::vector<VarValue> lowerBound;
+
+	/** @brief Buffered upper bounds of rows.
+	 *
+	 */
+	std::vector<VarValue> upperBound;
+
+	//*************************************** PRIVATE FUNCTIONS ****************************************//
+
+	/** @brief Returns segment that starts at the current end of this buffer.
+	 *
+	 * @return
+	 */
+	Segment beginSegment() const;
+
+	/** @brief Closes given segment at the current end of this buffer.
+	 *
+	 * @param segment
+	 */
+	void endSegment(Segment& segment) const;
+
+	//************************************ CONSTRUCTOR & DESTRUCTOR ************************************//
+
+	RowBuffer();
+
+public:
+
+	//************************************* PUBLIC CONSTANT FIELDS *************************************//
+
+	//************************************ CONSTRUCTOR & DESTRUCTOR ************************************//
+
+	virtual ~RowBuffer();
+
+	//*************************************** PUBLIC FUNCTIONS *****************************************//
+
+	/** @brief Buffers coefficient of given column in given row.
+	 *
+	 * @param rowIdx
+	 * @param columnIdx
+	 * @param coefficient
+	 */
+	void addElement(const RowIdx rowIdx, const VarIdx columnIdx,
+			const VarValue coefficient) {
+		this->rowIdx.push_back(rowIdx);
+		this->columnIdx.push_back(columnIdx);
+		this->value.push_back(coefficient);
+	}
+
+	/** @brief Buffers coefficients of given columns in given row.
+	 *
+	 * @param rowIdx
+	 * @param columnIdx array of count columns
+	 * @param coefficient array of count coefficients
+	 * @param count
+	 */
+	void addElements(const RowIdx rowIdx, const VarIdx* columnIdx,
+			const VarValue* coefficient, const size_t count);
+
+	/** @brief Buffers new bounds of given row.
+	 *
+	 * @details Bounds are assigned while buffers are merged, so the last bounds
+	 * given by task with the highest index win (@see Solver::generateRows()).
+	 *
+	 * @param rowIdx
+	 * @param lowerBound
+	 * @param upperBound
+	 */
+	void setBounds(const RowIdx rowIdx, const VarValue lowerBound,
+			const VarValue upperBound);
+
+	/** @brief Buffers terms of given constraint as coefficients of given row together with bounds of constraint.
+	 *
+	 * @see Row::setConstraint()
+	 *
+	 * @param rowIdx
+	 * @param constraint
+	 */
+	template<typename E>
+	void addConstraint(const RowIdx rowIdx, const Constraint<E>& constraint) {
+		LinearExprBuffer& buffer = LinearExprBuffer::getThreadLocal();
+		constraint.emit(buffer);
+		addElements(rowIdx, buffer.getColumnIdx(), buffer.getValues(),
+				buffer.getNumberOfTerms());
+		setBounds(rowIdx, buffer.getRowBound(constraint.lowerBound),
+				buffer.getRowBound(constraint.upperBound));
+	}
+
+	/** @brief Reserves space for given number of coefficients (in addition to already buffered ones).
+	 *
+	 * @param numberOfElements
+	 */
+	void reserve(const size_t numberOfElements);
+
+	//*************************************** GETTERS & SETTERS ****************************************//
+
+	size_t getNumberOfElements() const;
+
+};
+
+#endif /* ROWBUFFER_HPP_ */
@@ -0,0 +1,297 @@
+/*
+ * RowGroup.hpp
+ *
+ *  Created on: 17 paź 2026
+ *      Author: tomasz
+ */
+
+#ifndef ROWGROUP_HPP_
+#define ROWGROUP_HPP_
+
+#include <stddef.h>
+
+#include "DimensionTable.hpp"
+#include "exp/RowModelExeptions.hpp"
+#include "Typedefs.hpp"
+#include "utils/MapperUtils.hpp"
+#include "Row.hpp"
+#include "RowBuffer.hpp"
+#include "RowIdxMapper.hpp"
+
+namespace RowGroupImpl {
+
+/** @brief Compile-time list of positions 0, ..., N - 1 used to expand array of indexes into arguments of function.
+ *
+ */
+template<RowDimIdx ... I>
+struct Positions {
+};
+
+template<RowDimIdx N, RowDimIdx ... I>
+struct MakePositions: MakePositions<N - 1, N - 1, I...> {
+};
+
+template<RowDimIdx ... I>
+struct MakePositions<0, I...> {
+	typedef Positions<I...> type;
+};
+
+/** @brief Calls f(indexes[0], ..., indexes[N - 1]).
+ *
+ * @param f
+ * @param indexes
+ * @return
+ */
+template<typename F, RowDimIdx ... I>
+inline auto call(const F& f, const RowDimIdx* indexes, Positions<I...>)
+-> decltype(f(indexes[I]...)) {
+	return f(indexes[I]...);
+}
+
+}
+
+/** @brief Prepared handle of N-dimensional group of rows.
+ *
+ * @details Counterpart of VarGroup for rows (@see VarGroup). Handle is obtained once by name
+ * (@see Solver::rowGroup()) and every access is a bounds check and stride arithmetic.
+ *
+ * Example:
+ * @code
+ * 	Solver s(SolverInterface::GLPK);
+ * 	s.newVariable("x[100][20]", 0, 1, ValueType::DOUBLE);
+ * 	s.newRows("capacity[20]", Utils::getUnbounded(Bounds::LOWER), 10);
+ * 	VarGroup<2> x = s.group<2>("x");
+ * 	RowGroup<1> capacity = s.rowGroup<1>("capacity");
+ *
+ * 	for (RowDimIdx j = 1; j <= 20; j += 1) {
+ * 		for (VarDimIdx i = 1; i <= 100; i += 1) {
+ * 			capacity(j).addElement(x.getColumnIdx(i, j), 1);
+ * 		}
+ * 	}
+ * @endcode
+ *
+ */
+template<RowDimIdx N>
+class RowGroup {
+
+	friend class Solver;
+
+	static_assert(N <= MAX_NUMBER_OF_DIMENSIONS,
+			"Group of rows cannot have more than MAX_NUMBER_OF_DIMENSIONS dimensions.");
+
+private:
+
+	//************************************ PRIVATE CONSTANT FIELDS *************************************//
+
+	/** @brief Size of #extents and #strides arrays (arrays of size 0 are not allowed).
+	 *
+	 */
+	const static RowDimIdx ARRAYS_SIZE { N == 0 ? 1 : N };
+
+	//***************************************** CLASS FIELDS *******************************************//
+
+	/** @brief Problem instance that stores rows of this group.
+	 *
+	 */
+	OsiProblemInstance* problemInstance;
+
+	/** @brief Group of rows to which this handle refers.
+	 *
+	 */
+	const RowIdxMapper* rowGroup;
+
+	/** @brief Index of the first row of this group (@see RowIdxMapper::getBeginIdx()).
+	 *
+	 */
+	RowIdx beginIdx;
+
+	/** @brief Copy of sizes of dimensions of this group.
+	 *
+	 */
+	RowDimIdx extents[ARRAYS_SIZE];
+
+	/** @brief Copy of strides of dimensions of this group (@see DimensionTable).
+	 *
+	 */
+	RowIdx strides[ARRAYS_SIZE];
+
+	//*************************************** PRIVATE FUNCTIONS ****************************************//
+
+	/** @brief Logs and throws exception for indexes that do not refer to any row in this group.
+	 *
+	 * @details Kept out of linearize() so the common path contains only arithmetic.
+	 *
+	 * @param indexes list of N indexes
+	 */
+	void throwIndexOutOfBounds(const RowDimIdx* indexes) const
+			throw (RowModelExceptions::IndexOutOfBoundException) {
+		RowIndexTuple dimensions { };
+		for (RowDimIdx i = 0; i < N; i += 1) {
+			dimensions.push_back(indexes[i]);
+		}
+		MapUtils::ifDimensionsOutOfBounds<RowIdx, RowDimIdx>(
+				this->rowGroup->getDimensions(), dimensions);
+		throw RowModelExceptions::IndexOutOfBoundException();
+	}
+
+	/** @brief Returns number of rows of this group with indexes in given ranges.
+	 *
+	 * @param ranges N ranges, from the highest dimension to the lowest
+	 * @return
+	 *
+	 * @throw RowModelExceptions::IndexOutOfBoundException if any non-empty range contains 0
+	 * or exceeds size of its dimension.
+	 */
+	size_t getNumberOfRows(const IndexRange* ranges) const
+			throw (RowModelExceptions::IndexOutOfBoundException) {
+		size_t numberOfRows { 1 };
+		for (RowDimIdx i = 0; i < N; i += 1) {
+			if (ranges[i].size() == 0) {
+				return 0;
+			}
+		}
+		for (RowDimIdx i = 0; i < N; i += 1) {
+			if (ranges[i].first == 0 || ranges[i].last > this->extents[i]) {
+				RowDimIdx indexes[ARRAYS_SIZE] { };
+				for (RowDimIdx j = 0; j < N; j += 1) {
+					indexes[j] = j != i ? ranges[j].first :
+							ranges[i].first == 0 ? 0 : ranges[i].last;
+				}
+				throwIndexOutOfBounds(indexes);
+			}
+			numberOfRows *= ranges[i].size();
+		}
+		return numberOfRows;
+	}
+
+	/** @brief Writes constraint of given row of family of rows into given buffer.
+	 *
+	 * @details Rows of family are numbered in row-major order over given ranges (the last dimension
+	 * changes the fastest), so consecutive tasks refer to consecutive rows of this group.
+	 * Ranges have to be checked before (@see getNumberOfRows()).
+	 *
+	 * @param row number of row in family (task of Solver::generateRows())
+	 * @param ranges N ranges, from the highest dimension to the lowest
+	 * @param constraint function that returns Constraint for N indexes of row
+	 * @param buffer
+	 */
+	template<typename F>
+	void generateRow(size_t row, const IndexRange* ranges, const F& constraint,
+			RowBuffer& buffer) const {
+		RowDimIdx indexes[ARRAYS_SIZE] { };
+		RowIdx rowIdx { this->beginIdx };
+		for (RowDimIdx i = N; i > 0; i -= 1) {
+			indexes[i - 1] = ranges[i - 1].first + row % ranges[i - 1].size();
+			row /= ranges[i - 1].size();
+			rowIdx += (indexes[i - 1] - 1) * this->strides[i - 1];
+		}
+		buffer.addConstraint(rowIdx,
+				RowGroupImpl::call(constraint, indexes,
+						typename RowGroupImpl::MakePositions<N>::type { }));
+	}
+
+	/** @brief Returns index of row with given (1-based) indexes.
+	 *
+	 * @param indexes list of N indexes
+	 * @return
+	 *
+	 * @throw RowModelExceptions::IndexOutOfBoundException if any index is 0 or exceeds size of its dimension.
+	 */
+	RowIdx linearize(const RowDimIdx* indexes) const
+			throw (RowModelExceptions::IndexOutOfBoundException) {
+		RowIdx idx { this->beginIdx };
+		for (RowDimIdx i = 0; i < N; i += 1) {
+			if (indexes[i] == 0 || indexes[i] > this->extents[i]) {
+				throwIndexOutOfBounds(indexes);
+			}
+			idx += (indexes[i] - 1) * this->strides[i];
+		}
+		return idx;
+	}
+
+	//************************************ CONSTRUCTOR & DESTRUCTOR ************************************//
+
+	/** @brief Creates handle of given group of rows.
+	 *
+	 * @details Handles are created by Solver::rowGroup() which checks if given group has N dimensions.
+	 *
+	 * @param rowGroup
+	 */
+	explicit RowGroup(const RowIdxMapper* rowGroup) :
+			problemInstance(rowGroup->getProblemInstance()), rowGroup(
+					rowGroup), beginIdx(rowGroup->getBeginIdx()) {
+		for (RowDimIdx i = 0; i < N; i += 1) {
+			this->extents[i] = rowGroup->getDimensions().getExtent(i);
+			this->strides[i] = rowGroup->getDimensions().getStride(i);
+		}
+	}
+
+public:
+
+	//************************************* PUBLIC CONSTANT FIELDS *************************************//
+
+	//*************************************** PUBLIC FUNCTIONS *****************************************//
+
+	/** @brief Returns a view of row with given (1-based) indexes.
+	 *
+	 * @param indexes exactly N indexes, from the highest dimension to the lowest
+	 * @return
+	 *
+	 * @throw RowModelExceptions::IndexOutOfBoundException if any index is 0 or exceeds size of its dimension.
+	 */
+	template<typename ... Indexes>
+	Row operator()(const Indexes ... indexes) const
+			throw (RowModelExceptions::IndexOutOfBoundException) {
+		return Row { this->problemInstance, this->rowGroup,
+				getRowIdx(indexes...) };
+	}
+
+	/** @brief Returns index of row with given (1-based) indexes.
+	 *
+	 * @details Cheapest way of referring to row.
+	 *
+	 * @param indexes exactly N indexes, from the highest dimension to the lowest
+	 * @return
+	 *
+	 * @throw RowModelExceptions::IndexOutOfBoundException if any index is 0 or exceeds size of its dimension.
+	 */
+	template<typename ... Indexes>
+	RowIdx getRowIdx(const Indexes ... indexes) const
+			throw (RowModelExceptions::IndexOutOfBoundException) {
+		static_assert(sizeof...(Indexes) == N,
+				"Number of indexes has to be equal to number of dimensions of group of rows.");
+		const RowDimIdx indexesArray[ARRAYS_SIZE] = {
+				static_cast<RowDimIdx>(indexes)... };
+		return linearize(indexesArray);
+	}
+
+	//*************************************** GETTERS & SETTERS ****************************************//
+
+	RowIdx getBeginIdx() const {
+		return this->beginIdx;
+	}
+
+	RowIdx getNumberOfRows() const {
+		return this->rowGroup->getNumberOfRows();
+	}
+
+	RowDimIdx getExtent(const RowDimIdx dimension) const {
+		return this->extents[dimension];
+	}
+
+	/** @brief Returns range of all indexes of given dimension.
+	 *
+	 * @param dimension
+	 * @return
+	 */
+	IndexRange getRange(const RowDimIdx dimension) const {
+		return IndexRange { 1, this->extents[dimension] };
+	}
+
+	const RowIdxMapper* getRowGroup() const {
+		return this->rowGroup;
+	}
+
+};
+
+#endif /* ROWGROUP_HPP_ */
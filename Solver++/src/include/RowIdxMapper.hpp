@@ -8,11 +8,16 @@
 #ifndef INCLUDE_ROWIDXMAPPER_HPP_
 #define INCLUDE_ROWIDXMAPPER_HPP_
 
-#include <list>
 #include <string>
 
+#include "DimensionTable.hpp"
+#include "Solver.hpp"
 #include "Typedefs.hpp"
 
+class OsiProblemInstance;
+
+class Row;
+
 /** Contains all informations about rows with equations/inequalities for LP/MIP solver.
  *
  * It helps Solver class to manage LP structure allowing natural row naming at the same time.
@@ -30,49 +35,63 @@
  *  @code
  *
  *  s.newRows("xp[3][4]");
- *  for ( int i = 1; i <= x; i += 1 ) {
- *  	for ( int i = 1; i <= x; i += 1 ) {
- *  		s.addElement(
- *  			s.getRow("xp[][]",x,y),
- *  			s.getVariable("x[][]",x,y),
- *  			xp[x-1][y-1]
- *  		);
+ *  for ( int i = 1; i <= 3; i += 1 ) {
+ *  	for ( int j = 1; j <= 4; j += 1 ) {
+ *  		xp(i, j).addElement(x(i, j), p[i-1][j-1]);
  *  	}
  *  }
  *
  *  @endcode
+ *
+ * where xp and x are handles of groups (@see Solver::rowGroup(), Solver::group()).
+ *
  */
 class RowIdxMapper {
+
+	friend Row Solver::getRow(const std::string& rowDefinition)
+			throw (RowModelExceptions::NoSuchGroupException,
+			RowModelExceptions::InvalidNumberOfDimensionIndexesException,
+			RowModelExceptions::IndexOutOfBoundException,
+			RowModelExceptions::InvalidDefinitionException);
+
 private:
 
 	//************************************ PRIVATE CONSTANT FIELDS *************************************//
 
 	//***************************************** CLASS FIELDS *******************************************//
 
+	/** Problem instance that stores bounds and coefficients of every row in this group.
+	 *
+	 * Group of rows owns no per-row data but range of rows
+	 * [#beginIdx, #beginIdx + #numberOfRows) in problem instance's row arrays.
+	 *
+	 */
+	OsiProblemInstance* problemInstance;
+
 	/** Index of the first row in array/matrix or more dimensional structure.
 	 *
-	 * If created variable is 0-dimensional structure then beginIdx is equal to lastIdx
-	 * and dimensions list is equal to null.
+	 * Every group of rows is joined into one array of rows in order of creation
+	 * so rows of this group are stored in consecutive rows of problem instance starting from this index.
 	 *
 	 */
 	RowIdx beginIdx;
 
 	/** Every row may have multiple dimensions.
 	 *
-	 * List contains naturally ordered dimensional indexes of that group of rows (from the highest dimension to the lowest).
-	 * If single row is created (0-dimensional row group) then dimensions list will be empty.
+	 * Table contains naturally ordered sizes of dimensions of that group of rows (from the highest dimension to the lowest)
+	 * along with their strides. If single row is created (0-dimensional row group) then table will have no dimensions.
 	 *
 	 * Example:
 	 *
-	 * 	For given group of rows "xp[1][2][3]" dimensions list will contain elements: 1, 2 and 3.
+	 * 	For given group of rows "xp[1][2][3]" dimensions table will contain extents: 1, 2 and 3.
 	 *
 	 */
-	std::list<RowDimIdx> dimensions;
+	RowDimensionTable dimensions;
 
 	/** Number of rows in array/matrix or more dimensional structure.
 	 *
 	 */
-	VarIdx numberOfRows;
+	RowIdx numberOfRows;
 
 	/** Stores actual name of this group of rows.
 	 *
@@ -81,6 +100,14 @@ private:
 
 	//*************************************** PRIVATE FUNCTIONS ****************************************//
 
+	/** Returns view of row in 'this' group of rows with given indexes.
+	 *
+	 * @param dimensions
+	 * @return view of row stored at index #beginIdx + i of problem instance
+	 * where i is calculated based on given list of dimensions and linearized afterwards.
+	 */
+	Row getRow(const RowIndexTuple& dimensions) const;
+
 public:
 
 	//************************************* PUBLIC CONSTANT FIELDS *************************************//
@@ -89,14 +116,84 @@ public:
 
 	//************************************ CONSTRUCTOR & DESTRUCTOR ************************************//
 
-	RowIdxMapper();
+	/** Creates group of rows with given dimensions.
+	 *
+	 * Rows itself (with their bounds) have to be already added to the problem instance
+	 * (@see OsiProblemInstance::addNumberOfRows()) which returns firstIdx of this group.
+	 *
+	 * @param problemInstance problem instance that stores rows of this group
+	 * @param firstIdx index of the first row in this group
+	 * @param dimensions table of dimensions taken from string-like declaration of group of rows
+	 * @param groupName name of group of rows
+	 */
+	RowIdxMapper(OsiProblemInstance* problemInstance, const RowIdx firstIdx,
+			const RowDimensionTable& dimensions, const std::string& groupName);
 
 	virtual ~RowIdxMapper();
 
 	//*************************************** PUBLIC FUNCTIONS *****************************************//
 
+	/** Returns string representation of this class.
+	 *
+	 * @return
+	 */
+	std::string toString();
+
+	/** Returns number of dimensions of this group.
+	 *
+	 * @return
+	 */
+	RowDimIdx getDimensionsSize();
+
 	//*************************************** GETTERS & SETTERS ****************************************//
 
+	/** Returns problem instance that stores rows of this group.
+	 *
+	 * @return
+	 */
+	OsiProblemInstance* getProblemInstance() const;
+
+	/** Returns value of beginIdx field.
+	 *
+	 * @return
+	 */
+	RowIdx getBeginIdx() const;
+
+	/** Moves this group to new range of rows starting from given index.
+	 *
+	 * Used when rows preceding this group are deleted from problem instance (@see OsiProblemInstance::deleteRows()).
+	 *
+	 * @param beginIdx
+	 */
+	void setBeginIdx(const RowIdx beginIdx);
+
+	/** Returns number of rows in this group.
+	 *
+	 * @return
+	 */
+	RowIdx getNumberOfRows() const;
+
+	/** Returns full name of row with given index in this group e.g. "xp[2][3]".
+	 *
+	 * Names of rows are never kept, they are generated on every request (@see MapUtils::getVariableName()).
+	 *
+	 * @param idx index of row in this group (0 for row at #beginIdx)
+	 * @return
+	 */
+	std::string getRowName(const RowIdx idx) const;
+
+	/** Returns name of this group of rows.
+	 *
+	 * @return
+	 */
+	const std::string& getGroupName() const;
+
+	/** Returns dimensions table.
+	 *
+	 * @return
+	 */
+	const RowDimensionTable& getDimensions() const;
+
 };
 
 #endif /* INCLUDE_ROWIDXMAPPER_HPP_ */
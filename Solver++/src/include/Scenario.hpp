@@ -0,0 +1,161 @@
+/*
+ * Scenario.hpp
+ *
+ *  Created on: 17 paź 2026
+ *      Author: tomasz
+ */
+
+#ifndef SCENARIO_HPP_
+#define SCENARIO_HPP_
+
+#include <stddef.h>
+#include <vector>
+
+#include "Typedefs.hpp"
+
+/** @brief Result of solving single scenario (@see Solver::solveScenarios()).
+ *
+ */
+struct ScenarioResult {
+
+	/** @brief Status of solution.
+	 *
+	 */
+	SolveStatus status;
+
+	/** @brief Value of objective function (meaningful only for SolveStatus::OPTIMAL).
+	 *
+	 */
+	VarValue objectiveValue;
+
+	/** @brief Number of iterations that solver needed for this scenario.
+	 *
+	 */
+	int numberOfIterations;
+
+	/** @brief Values of every column (indexed by VarIdx, @see VarGroup::getColumnIdx()).
+	 *
+	 */
+	std::vector<VarValue> columnValues;
+
+};
+
+/** @brief Variant of loaded model that differs only by bounds and objective coefficients.
+ *
+ * @details Scenario holds changes (deltas) that are applied on top of the base model - everything
+ * that is not changed by scenario is taken from the model. Columns and rows are referred to
+ * by their indexes (@see VarGroup::getColumnIdx(), RowGroup::getRowIdx()), so building thousands
+ * of scenarios needs no name lookups.
+ *
+ * Example:
+ * @code
+ * 	std::vector<Scenario> scenarios(1000);
+ * 	for (size_t k = 0; k < scenarios.size(); k += 1) {
+ * 		for (RowDimIdx i = 1; i <= 10; i += 1) {
+ * 			scenarios[k].setRowBounds(demand.getRowIdx(i), forecast[k][i], Utils::getUnbounded(UPPER));
+ * 		}
+ * 	}
+ * 	std::vector<ScenarioResult> results = s.solveScenarios(scenarios);
+ * @endcode
+ *
+ */
+class Scenario {
+
+	friend class OsiProblemInstance;
+
+private:
+
+	//************************************ PRIVATE CONSTANT FIELDS *************************************//
+
+	//****************************************** CLASS TYPES *******************************************//
+
+	/** @brief New bounds of column or row.
+	 *
+	 */
+	template<typename Idx>
+	struct BoundsChange {
+		Idx idx;
+		VarValue lowerBound;
+		VarValue upperBound;
+	};
+
+	/** @brief New objective coefficient of column.
+	 *
+	 */
+	struct ObjectiveChange {
+		VarIdx idx;
+		VarValue coefficient;
+	};
+
+	//***************************************** CLASS FIELDS *******************************************//
+
+	/** @brief Changed bounds of columns.
+	 *
+	 */
+	std::vector<BoundsChange<VarIdx>> columnBounds;
+
+	/** @brief Changed objective coefficients.
+	 *
+	 */
+	std::vector<ObjectiveChange> objective;
+
+	/** @brief Changed bounds of rows (right-hand sides).
+	 *
+	 */
+	std::vector<BoundsChange<RowIdx>> rowBounds;
+
+	//*************************************** PRIVATE FUNCTIONS ****************************************//
+
+public:
+
+	//************************************* PUBLIC CONSTANT FIELDS *************************************//
+
+	//************************************ CONSTRUCTOR & DESTRUCTOR ************************************//
+
+	Scenario();
+
+	virtual ~Scenario();
+
+	//*************************************** PUBLIC FUNCTIONS *****************************************//
+
+	/** @brief Changes bounds of given column in this scenario.
+	 *
+	 * @param columnIdx
+	 * @param lowerBound
+	 * @param upperBound
+	 */
+	void setColumnBounds(const VarIdx columnIdx, const VarValue lowerBound,
+			const VarValue upperBound);
+
+	/** @brief Changes objective coefficient of given column in this scenario.
+	 *
+	 * @param columnIdx
+	 * @param coefficient
+	 */
+	void setObjective(const VarIdx columnIdx, const VarValue coefficient);
+
+	/** @brief Changes bounds (right-hand side) of given row in this scenario.
+	 *
+	 * @param rowIdx
+	 * @param lowerBound
+	 * @param upperBound
+	 */
+	void setRowBounds(const RowIdx rowIdx, const VarValue lowerBound,
+			const VarValue upperBound);
+
+	/** @brief Checks if every changed column and row exists in model of given size.
+	 *
+	 * @param numberOfColumns
+	 * @param numberOfRows
+	 * @return
+	 */
+	bool isValid(const VarIdx numberOfColumns,
+			const RowIdx numberOfRows) const;
+
+	//*************************************** GETTERS & SETTERS ****************************************//
+
+	size_t getNumberOfChanges() const;
+
+};
+
+#endif /* SCENARIO_HPP_ */
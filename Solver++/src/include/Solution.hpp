@@ -0,0 +1,87 @@
+/*
+ * Solution.hpp
+ *
+ *  Created on: 17 paź 2026
+ *      Author: tomasz
+ */
+
+#ifndef SOLUTION_HPP_
+#define SOLUTION_HPP_
+
+#include <stddef.h>
+#include <vector>
+
+#include "Typedefs.hpp"
+
+/** @brief Copy of solution of model taken at some moment (@see Solver::getSolution()).
+ *
+ * @details Views of solution (@see SolutionView) normally refer directly to arrays of the solver,
+ * which change with every solve and become invalid when model is changed. Snapshot keeps
+ * its own copy of these arrays, so views created over it (@see Solver::values()) stay valid
+ * as long as snapshot exists, e.g. while the same model is modified and solved again.
+ *
+ */
+class Solution {
+
+	friend class OsiProblemInstance;
+
+public:
+
+	/** @brief Arrays of solution.
+	 *
+	 */
+	enum Part {
+		COLUMN_VALUES, //!< values of columns (OsiSolverInterface::getColSolution())
+		REDUCED_COSTS, //!< reduced costs of columns (OsiSolverInterface::getReducedCost())
+		ROW_PRICES     //!< dual values of rows (OsiSolverInterface::getRowPrice())
+	};
+
+private:
+
+	//************************************ PRIVATE CONSTANT FIELDS *************************************//
+
+	//***************************************** CLASS FIELDS *******************************************//
+
+	/** @brief Copies of arrays of solution in order of Part enumeration.
+	 *
+	 */
+	std::vector<VarValue> parts[3];
+
+	/** @brief Value of objective function.
+	 *
+	 */
+	VarValue objectiveValue;
+
+	//*************************************** PRIVATE FUNCTIONS ****************************************//
+
+public:
+
+	//************************************* PUBLIC CONSTANT FIELDS *************************************//
+
+	//************************************ CONSTRUCTOR & DESTRUCTOR ************************************//
+
+	/** @brief Creates empty snapshot.
+	 *
+	 */
+	Solution();
+
+	virtual ~Solution();
+
+	//*************************************** PUBLIC FUNCTIONS *****************************************//
+
+	//*************************************** GETTERS & SETTERS ****************************************//
+
+	/** @brief Returns given array of this snapshot or nullptr if solver did not provide it.
+	 *
+	 * @param part
+	 * @return
+	 */
+	const VarValue* getValues(const Part part) const;
+
+	size_t getSize(const Part part) const;
+
+	VarValue getObjectiveValue() const;
+
+};
+
+#endif /* SOLUTION_HPP_ */
@@ -0,0 +1,212 @@
+/*
+ * SolutionView.hpp
+ *
+ *  Created on: 17 paź 2026
+ *      Author: tomasz
+ */
+
+#ifndef SOLUTIONVIEW_HPP_
+#define SOLUTIONVIEW_HPP_
+
+#include <stddef.h>
+
+#include "DimensionTable.hpp"
+#include "exp/ModelExeptions.hpp"
+#include "Typedefs.hpp"
+
+/** @brief Contiguous part of solution of single group (@see SolutionView::span()).
+ *
+ */
+struct SolutionSpan {
+
+	/** @brief The first value of span.
+	 *
+	 */
+	const VarValue* data;
+
+	/** @brief Number of values of span.
+	 *
+	 */
+	size_t size;
+
+	/** @brief Returns value at given (0-based) position of span.
+	 *
+	 * @param position
+	 * @return
+	 */
+	const VarValue& operator[](const size_t position) const {
+		return this->data[position];
+	}
+
+	const VarValue* begin() const {
+		return this->data;
+	}
+
+	const VarValue* end() const {
+		return this->data + this->size;
+	}
+
+};
+
+/** @brief Read-only view of part of solution (values, reduced costs or dual values) of N-dimensional group.
+ *
+ * @details View refers directly to array of the solver (or of snapshot, @see Solution) at the first element
+ * of the group - elements of group are contiguous and in row-major order in solver's arrays, so nothing is
+ * copied and every access is a bounds check and stride arithmetic (the same as VarGroup):
+ * @code
+ * 	s.solve();
+ * 	SolutionView<2> x = s.values<2>("x");
+ * 	SolutionView<1> price = s.rowPrices<1>("demand");
+ * 	VarValue flow = x(3, 7);				// value of "x[3][7]"
+ * 	for (const VarValue value : x.span(3)) {	// values of x[3][1], x[3][2], ...
+ * 	}
+ * @endcode
+ *
+ * View created over arrays of the solver is valid until model is changed or solved again.
+ *
+ */
+template<unsigned int N>
+class SolutionView {
+
+	friend class Solver;
+
+	static_assert(N <= MAX_NUMBER_OF_DIMENSIONS,
+			"Group cannot have more than MAX_NUMBER_OF_DIMENSIONS dimensions.");
+
+private:
+
+	//************************************ PRIVATE CONSTANT FIELDS *************************************//
+
+	/** @brief Size of #extents and #strides arrays (arrays of size 0 are not allowed).
+	 *
+	 */
+	const static unsigned int ARRAYS_SIZE { N == 0 ? 1 : N };
+
+	//***************************************** CLASS FIELDS *******************************************//
+
+	/** @brief Value of the first element of group.
+	 *
+	 */
+	const VarValue* values;
+
+	/** @brief Number of elements of group.
+	 *
+	 */
+	size_t numberOfElements;
+
+	/** @brief Copy of sizes of dimensions of group.
+	 *
+	 */
+	unsigned int extents[ARRAYS_SIZE];
+
+	/** @brief Copy of strides of dimensions of group (@see DimensionTable).
+	 *
+	 */
+	size_t strides[ARRAYS_SIZE];
+
+	//*************************************** PRIVATE FUNCTIONS ****************************************//
+
+	/** @brief Returns position of the first element with given leading (1-based) indexes.
+	 *
+	 * @param indexes list of count indexes of the highest dimensions
+	 * @param count number of indexes (not greater than N)
+	 * @return
+	 *
+	 * @throw ModelExceptions::IndexOutOfBoundException if any index is 0 or exceeds size of its dimension.
+	 */
+	size_t linearize(const unsigned int* indexes, const unsigned int count) const
+			throw (ModelExceptions::IndexOutOfBoundException) {
+		size_t idx { 0 };
+		for (unsigned int i = 0; i < count; i += 1) {
+			if (indexes[i] == 0 || indexes[i] > this->extents[i]) {
+				throw ModelExceptions::IndexOutOfBoundException();
+			}
+			idx += (indexes[i] - 1) * this->strides[i];
+		}
+		return idx;
+	}
+
+	//************************************ CONSTRUCTOR & DESTRUCTOR ************************************//
+
+	/** @brief Creates view of group with given dimensions whose first element is at given address.
+	 *
+	 * @details Views are created by Solver which checks if group has N dimensions.
+	 *
+	 * @param values
+	 * @param dimensions
+	 */
+	template<typename Idx, typename DimIdx>
+	SolutionView(const VarValue* values,
+			const DimensionTable<Idx, DimIdx>& dimensions) :
+			values(values), numberOfElements(dimensions.getNumberOfElements()) {
+		for (unsigned int i = 0; i < N; i += 1) {
+			this->extents[i] = dimensions.getExtent(i);
+			this->strides[i] = dimensions.getStride(i);
+		}
+	}
+
+public:
+
+	//************************************* PUBLIC CONSTANT FIELDS *************************************//
+
+	//*************************************** PUBLIC FUNCTIONS *****************************************//
+
+	/** @brief Returns value of element with given (1-based) indexes.
+	 *
+	 * @param indexes exactly N indexes, from the highest dimension to the lowest
+	 * @return
+	 *
+	 * @throw ModelExceptions::IndexOutOfBoundException if any index is 0 or exceeds size of its dimension.
+	 */
+	template<typename ... Indexes>
+	const VarValue& operator()(const Indexes ... indexes) const
+			throw (ModelExceptions::IndexOutOfBoundException) {
+		static_assert(sizeof...(Indexes) == N,
+				"Number of indexes has to be equal to number of dimensions of group.");
+		const unsigned int indexesArray[ARRAYS_SIZE] = {
+				static_cast<unsigned int>(indexes)... };
+		return this->values[linearize(indexesArray, N)];
+	}
+
+	/** @brief Returns contiguous span of values of elements with given leading (1-based) indexes.
+	 *
+	 * @details For x[n][m][k]: x.span(i) is a span of m * k values, x.span(i, j) is a span of k values
+	 * and x.span() is a span of every value of group (@see ParamGroup::span()).
+	 *
+	 * @param indexes at most N indexes, from the highest dimension to the lowest
+	 * @return
+	 *
+	 * @throw ModelExceptions::IndexOutOfBoundException if any index is 0 or exceeds size of its dimension.
+	 */
+	template<typename ... Indexes>
+	SolutionSpan span(const Indexes ... indexes) const
+			throw (ModelExceptions::IndexOutOfBoundException) {
+		static_assert(sizeof...(Indexes) <= N,
+				"Number of indexes cannot be greater than number of dimensions of group.");
+		const unsigned int indexesArray[sizeof...(Indexes) + 1] = {
+				static_cast<unsigned int>(indexes)..., 0 };
+		return SolutionSpan { this->values
+				+ linearize(indexesArray, sizeof...(Indexes)),
+				sizeof...(Indexes) == 0 ?
+						this->numberOfElements :
+						this->strides[sizeof...(Indexes) == 0 ?
+								0 : sizeof...(Indexes) - 1] };
+	}
+
+	//*************************************** GETTERS & SETTERS ****************************************//
+
+	size_t getNumberOfElements() const {
+		return this->numberOfElements;
+	}
+
+	unsigned int getExtent(const unsigned int dimension) const {
+		return this->extents[dimension];
+	}
+
+	const VarValue* getValues() const {
+		return this->values;
+	}
+
+};
+
+#endif /* SOLUTIONVIEW_HPP_ */
@@ -0,0 +1,176 @@
+/*
+ * SolveHandle.hpp
+ *
+ *  Created on: 17 paź 2026
+ *      Author: tomasz
+ */
+
+#ifndef SOLVEHANDLE_HPP_
+#define SOLVEHANDLE_HPP_
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+#include "Typedefs.hpp"
+
+/** @brief State of solve that is in progress, passed to progress callback (@see SolveOptions).
+ *
+ */
+struct SolveProgress {
+
+	/** @brief Number of simplex iterations done so far.
+	 *
+	 */
+	int numberOfIterations;
+
+	/** @brief Value of objective function in current iterate.
+	 *
+	 */
+	VarValue objectiveValue;
+
+	/** @brief Bound of optimal value of objective function known so far (dual objective of current iterate).
+	 *
+	 * @details Lower bound for minimization, upper bound for maximization. NAN if solver engine cannot provide dual values.
+	 */
+	VarValue bound;
+
+	/** @brief Time since solve started (in seconds).
+	 *
+	 */
+	double elapsedTime;
+
+};
+
+/** @brief Limits and callbacks of single solve (@see Solver::solve(), Solver::solveAsync()).
+ *
+ * @details Time limit, cancellation and progress are handled between slices of simplex iterations
+ * (@see OsiProblemInstance::ITERATIONS_PER_SLICE) which are warm-started one from another, so they work
+ * the same way with every solver engine. Problems with integer columns are solved by branch and bound
+ * in one piece - time limit is passed to it only by CBC engine (CbcModel::setMaximumSeconds()), cancellation is
+ * checked only before it starts and progress is not reported (warning is logged when limit or cancellation cannot be honoured).
+ *
+ */
+struct SolveOptions {
+
+	/** @brief Limit of time of solve in seconds (0 means no limit).
+	 *
+	 */
+	double timeLimit;
+
+	/** @brief Function called with progress of solve (empty means no callback).
+	 *
+	 * @details Callback is called by thread that solves problem, so it should return quickly.
+	 */
+	std::function<void(const SolveProgress&)> progressCallback;
+
+	/** @brief Minimal time between two calls of #progressCallback in seconds.
+	 *
+	 */
+	double progressInterval;
+
+	SolveOptions() :
+			timeLimit(0), progressCallback(), progressInterval(0.1) {
+	}
+
+};
+
+/** @brief Handle of solve running in background thread (@see Solver::solveAsync()).
+ *
+ * @details Handle can be freely copied - every copy refers to the same solve.
+ *
+ * Example:
+ * @code
+ * 	SolveHandle handle = s.solveAsync();
+ * 	// ... build model of the next request in another Solver
+ * 	if (!handle.waitFor(30)) {
+ * 		handle.cancel();
+ * 	}
+ * 	SolveStatus status = handle.get();
+ * @endcode
+ *
+ */
+class SolveHandle {
+
+	friend class Solver;
+
+private:
+
+	//************************************ PRIVATE CONSTANT FIELDS *************************************//
+
+	//****************************************** CLASS TYPES *******************************************//
+
+	/** @brief State shared by handles and thread that solves problem.
+	 *
+	 */
+	struct State {
+		std::mutex mutex;
+		std::condition_variable finishedCondition;
+		bool finished;
+		SolveStatus status;
+		std::exception_ptr exception;
+		std::atomic<bool> cancelled;
+	};
+
+	//***************************************** CLASS FIELDS *******************************************//
+
+	std::shared_ptr<State> state;
+
+	//*************************************** PRIVATE FUNCTIONS ****************************************//
+
+	/** @brief Marks solve as finished with given status (or exception) and wakes up every waiting thread.
+	 *
+	 * @param status
+	 * @param exception
+	 */
+	void finish(const SolveStatus status, std::exception_ptr exception);
+
+	//************************************ CONSTRUCTOR & DESTRUCTOR ************************************//
+
+	/** @brief Creates handle of new unfinished solve.
+	 *
+	 */
+	SolveHandle();
+
+public:
+
+	//************************************* PUBLIC CONSTANT FIELDS *************************************//
+
+	//************************************ CONSTRUCTOR & DESTRUCTOR ************************************//
+
+	virtual ~SolveHandle();
+
+	//*************************************** PUBLIC FUNCTIONS *****************************************//
+
+	/** @brief Checks if solve has finished (never blocks).
+	 *
+	 * @return
+	 */
+	bool isDone() const;
+
+	/** @brief Waits until solve finishes but not longer than given time.
+	 *
+	 * @param seconds
+	 * @return true if solve has finished
+	 */
+	bool waitFor(const double seconds) const;
+
+	/** @brief Waits until solve finishes and returns its status.
+	 *
+	 * @details Exception thrown while solving is rethrown here.
+	 *
+	 * @return SolveStatus::CANCELLED if solve has been cancelled
+	 */
+	SolveStatus get() const;
+
+	/** @brief Asks solve to stop - it stops at the end of current slice of iterations (@see SolveOptions).
+	 *
+	 */
+	void cancel();
+
+};
+
+#endif /* SOLVEHANDLE_HPP_ */
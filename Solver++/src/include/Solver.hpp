@@ -10,14 +10,25 @@
 
 #include "Typedefs.hpp"
 
-#include <list>
-#include <regex>
+#include <stddef.h>
+#include <functional>
+#include <stdexcept>
 #include <string>
+#include <thread>
 #include <unordered_map>
+#include <vector>
 
+#include "Basis.hpp"
+#include "DimensionTable.hpp"
+#include "exp/ModelExeptions.hpp"
+#include "exp/ParameterModelExeptions.hpp"
+#include "exp/RowModelExeptions.hpp"
 #include "exp/VariableModelExeptions.hpp"
-
-#include "Typedefs.hpp"
+#include "ParamTextLoader.hpp"
+#include "Scenario.hpp"
+#include "Solution.hpp"
+#include "SolutionView.hpp"
+#include "SolveHandle.hpp"
 
 class ParamIdxMapper;
 
@@ -29,6 +40,28 @@ class OsiProblemInstance;
 
 class Variable;
 
+class Parameter;
+
+class Row;
+
+class RowBuffer;
+
+template<VarDimIdx N>
+class VarGroup;
+
+template<ParamDimIdx N>
+class ParamGroup;
+
+template<RowDimIdx N>
+class RowGroup;
+
+/** @brief Function that generates coefficients of rows for single task (@see Solver::generateRows()).
+ *
+ * @details It is called with index of task and thread-local buffer to which coefficients have to be appended.
+ *
+ */
+typedef std::function<void(const size_t task, RowBuffer& buffer)> RowGenerator;
+
 /** @brief Based class that handles model creation.
  *
  * @details Example above will describe entire process of model creation.
@@ -75,46 +108,6 @@ private:
 
 	//************************************ PRIVATE CONSTANT FIELDS *************************************//
 
-	/** @brief Will accept only strings that consist of variables group's name
-	 * followed by any number of indexes enclosed in Solver::DIM_GROUP_DELIMETERS.
-	 *
-	 * Name of group of variables has to consist of at least one character
-	 * that is a English letter, number or underscore ("_").
-	 *
-	 */
-	const static std::regex VAR_REGEXP;
-
-	/** @brief Index value for group name of variable.
-	 *
-	 * @details By parsing variable's definition, two matches will be found.
-	 * This variable holds predefined index for the first part of that definition.
-	 *
-	 * Example:
-	 * 	@code
-	 * 		Given a variable definition: x[2][3]:
-	 * 		std::regex_search("x[2][3]", variableMatch, Solver::VAR_REGEXP);
-	 * 		std::cout << variableMatch[VAR_REGEX_NAME_GROUP_IDX]; //will print "x"
-	 * 	@endcode
-	 *
-	 */
-	const static int VAR_REGEX_NAME_GROUP_IDX;
-
-	/** @brief Index value for group name of variable.
-	 *
-	 * @details By parsing variable's definition, two matches will be found.
-	 * This variable holds predefined index for the first part of that definition.
-	 *
-	 * Example:
-	 * 	@code
-	 * 		Given a variable definition: x[2][3]:
-	 * 		std::regex_search("x[2][3]", variableMatch, Solver::VAR_REGEXP);
-	 * 		std::cout << variableMatch[VAR_REGEX_DIM_GROUP_IDX]; //will print "[2][3]"
-	 * 	@endcode
-	 *
-	 */
-	const static int VAR_REGEX_DIM_GROUP_IDX;
-
-
 	//***************************************** CLASS FIELDS *******************************************//
 
 	/** @brief Reference to a selected solver engine.
@@ -185,7 +178,7 @@ private:
 	 * Example:
 	 * @code
 	 * 	Solver s(SolverInterface::GLPK);
-	 * 	s.newVariable("row[4][5]");	//will add {"row", RowIdxMapper} to rows map.
+	 * 	s.newRows("row[4][5]");	//will add {"row", RowIdxMapper} to rows map.
 	 * 								//RowIdxMapper will store all details about this set of rows (e.g. its dimension).
 	 * @endcode
 	 *
@@ -204,67 +197,102 @@ private:
 	 */
 	std::unordered_map<std::string, RowIdxMapper*>* rows;
 
-	//*************************************** PRIVATE FUNCTIONS ****************************************//
-
-	/** @brief Extends column size of linear equations/inequalities in LP/MIP problem by given number
-	 * after creating new group of variables.
+	/** @brief Decides if full names of variables are kept after they have been generated.
 	 *
-	 * @details This is private function that is called by any member of the newVariable() functions' family.
+	 * @details Names of variables are never created together with variables,
+	 * they are generated on demand from group name and index of variable.
+	 * By default generated names are not kept (NamesPolicy::GENERATE_NAMES).
 	 *
-	 * Example:
-	 * @code
-	 * 	Given problem instance with 2 variables: x[2], all coefficients equal 0 and one linear constraint:
-	 * 	min 0 * x1 + 0 * x2
-	 * 	s.t. 0 * x1 + 0 * x2 = 0
+	 * @see setNamesPolicy()
 	 *
-	 * 	By creating new variable (e.g. by calling  newVariable("y[3]")) this function will add them to model, giving:
-	 * 	min 0 * x1 + 0 * x2 + 0 * y1 + 0 * y2 + 0 * y3
-	 * 	s.t. 0 * x1 + 0 * x2 + 0 * y1 + 0 * y2 + 0 * y3 = 0
-	 * @endcode
+	 */
+	NamesPolicy namesPolicy;
+
+	/** @brief Basis of the last solution or basis given by user (@see getBasis(), setBasis()).
 	 *
-	 * @param numberOfNewVariables number of variables that will be added to model
+	 */
+	Basis* basis;
+
+	/** @brief Set when #basis has been given by user (or groups have been deleted since it was captured)
+	 * and it has to be passed to the solver before the next solve.
 	 *
 	 */
-	void addNumberOfVariables(const VarIdx& numberOfNewVariables);
+	bool basisPending;
 
-	/** @brief Transform dimensional part of definition of group of variables into list of dimensions.
+	/** @brief Thread of the last asynchronous solve (nullptr if there was none, @see solveAsync()).
 	 *
-	 * @details If given variableDimensionDefinition is a definition of 0-dimensional variable (without indexes)
-	 * then empty list will be returned.
+	 */
+	std::thread* solveThread;
+
+	/** @brief Handle of the last asynchronous solve (nullptr if there was none).
 	 *
-	 * This is private method that is called by any member of the newVariable() functions' family.
+	 */
+	SolveHandle* solveHandle;
+
+	//*************************************** PRIVATE FUNCTIONS ****************************************//
+
+	/** @brief Stores basis of the last solution in #basis (per group of variables and group of rows).
 	 *
-	 * Example:
-	 * @code
-	 * 	Given variable definition: x[2][3].
-	 * 	Calling this method will result in returning a given list: {2, 3}
-	 * @endcode
+	 */
+	void captureBasis();
+
+	/** @brief Passes #basis to the solver remapped onto current groups of variables and rows (@see Basis::remap()).
 	 *
-	 * @param variableDimensionDefinition dimensional part of variable's definition
+	 */
+	void applyBasis();
+
+	/** @brief Makes the next solve start from #basis remapped onto groups that are left after deletion of some groups.
 	 *
-	 * @return list of dimensions retrieved from dimensional part of variable's definition
+	 * @details Nothing is scheduled if no basis has been captured or given yet.
 	 *
 	 */
-	std::list<VarDimIdx> getVariableDimensionList(
-			const char* variableDimensionDefinition);
+	void remapBasisAfterDeletion();
 
-	/** @brief Counts number of all variables in given group based on it's dimensional part of definition
-	 * that was transformed into list by getVariableDimensionList() function.
+	/** @brief Solves this model with given options (@see OsiProblemInstance::solve()).
 	 *
-	 * @details If given dimensions list is empty then '1' will be returned as empty dimensions list
-	 * refers to 0-dimensional variable (single variable without indexes)
+	 * @param options
+	 * @param cancelled flag that stops solve when it is set (nullptr if solve cannot be cancelled)
+	 * @return
+	 */
+	SolveStatus solve(const SolveOptions& options,
+			const std::atomic<bool>* cancelled);
+
+	/** @brief Waits until the last asynchronous solve (if any) finishes.
+	 *
+	 */
+	void waitForSolve();
+
+	/** @brief Extends column size of linear equations/inequalities in LP/MIP problem by given number
+	 * after creating new group of variables.
+	 *
+	 * @details This is private function that is called by any member of the newVariable() functions' family.
 	 *
 	 * Example:
 	 * @code
-	 *	countVariablesInGroup({2,3,4});	// return a product of given numbers: 2*3*4 = 24
+	 * 	Given problem instance with 2 variables: x[2], all coefficients equal 0 and one linear constraint:
+	 * 	min 0 * x1 + 0 * x2
+	 * 	s.t. 0 * x1 + 0 * x2 = 0
+	 *
+	 * 	By creating new variable (e.g. by calling  newVariable("y[3]")) this function will add them to model, giving:
+	 * 	min 0 * x1 + 0 * x2 + 0 * y1 + 0 * y2 + 0 * y3
+	 * 	s.t. 0 * x1 + 0 * x2 + 0 * y1 + 0 * y2 + 0 * y3 = 0
 	 * @endcode
 	 *
-	 * @param dimensions list of dimensions of group of variables
+	 * @param numberOfNewVariables number of variables that will be added to model
+	 * @param lowerBound lower bound of every new variable
+	 * @param upperBound upper bound of every new variable
+	 * @param variableType type of every new variable (integer and binary columns are marked in the solver)
+	 *
+	 * @return index of the first added variable (column)
 	 *
-	 * @return number of variables that is defined by previously transformed dimensional part of its definition.
+	 * @throw VariableModelExceptions::InvalidGroupDefinitionException will be thrown in case index of any new column
+	 * would exceed the greatest value of VarIdx.
 	 *
 	 */
-	VarIdx countVariablesInGroup(const std::list<VarDimIdx>& dimensions);
+	VarIdx addNumberOfVariables(const VarIdx& numberOfNewVariables,
+			const VarValue lowerBound, const VarValue upperBound,
+			const ValueType variableType)
+					throw (VariableModelExceptions::InvalidGroupDefinitionException);
 
 	/** @brief Inserts given group of variables into variables map with matchedNameOfVariable as a key.
 	 *
@@ -272,24 +300,24 @@ private:
 	 * This is private method that is called by any member of the newVariable() functions' family.
 	 *
 	 * @param matchedNameOfVariable base name of a matched variable
-	 * @param numberOfVariables number of variables be added
-	 * @param listOfDimensions list of given variable's dimensions
+	 * @param dimensions table of given variable's dimensions
 	 * @param lowerBound the smallest value that can be assign to any of variables among given group
 	 * @param upperBound the greatest value that can be assign to any of variables among given group
 	 * @param variableType type of variable
 	 *
 	 * @throw VariableModelExceptions::DuplicateException will be thrown in case in #variables
 	 * there is already such an element with given name (another group of variables with the same base name was previously created).
+	 * @throw VariableModelExceptions::InvalidGroupDefinitionException will be thrown in case group has more variables
+	 * than VarIdx can index or they cannot be added to columns of model.
 	 *
 	 * @see ValueType
 	 *
 	 */
 	void insertVariable(const std::string& matchedNameOfVariable,
-			const VarIdx numberOfVariables,
-			const std::list<VarDimIdx>& listOfDimensions,
-			const VarValue lowerBound, const VarValue upperBound,
+			const VarDimensionTable& dimensions, const VarValue lowerBound, const VarValue upperBound,
 			const ValueType variableType)
-					throw (VariableModelExceptions::DuplicateException);
+					throw (VariableModelExceptions::DuplicateException,
+					VariableModelExceptions::InvalidGroupDefinitionException);
 
 	/** @brief Return VariableIdxMapper of given variable.
 	 *
@@ -307,6 +335,243 @@ private:
 			const std::string& groupOfVariablesName)
 					throw (VariableModelExceptions::NoSuchGroupException);
 
+	/** @brief Return VariableIdxMapper of given variable.
+	 *
+	 * @details Overload for names that are not null-terminated (@see StringUtils::Definition).
+	 * Name is copied into thread-local buffer which is reused between calls
+	 * so after first few calls lookup does not allocate any memory.
+	 *
+	 * @param groupOfVariablesName first character of base name of group of variables
+	 * @param length number of characters of base name
+	 * @return group of variables with given base name if such group exists
+	 *
+	 * @throw VariableModelExceptions::NoSuchGroupException will be raised
+	 * if in the #variables map there is no such a group of variables with given name.
+	 *
+	 */
+	VariableIdxMapper* getVariableIdxMapperAt(const char* groupOfVariablesName,
+			const size_t length)
+					throw (VariableModelExceptions::NoSuchGroupException);
+
+	/** @brief Return VariableIdxMapper of given variable if it has expected number of dimensions.
+	 *
+	 * @details Non-template part of group().
+	 *
+	 * @param groupOfVariablesName base name of group of variables
+	 * @param numberOfDimensions expected number of dimensions of group
+	 * @return group of variables with given base name
+	 *
+	 * @throw VariableModelExceptions::NoSuchGroupException if there is no such a group of variables with given name.
+	 * @throw VariableModelExceptions::InvalidNumberOfDimensionIndexesException if group of variables was found
+	 * but has different number of dimensions.
+	 *
+	 */
+	VariableIdxMapper* getVariableGroup(const std::string& groupOfVariablesName,
+			const VarDimIdx numberOfDimensions)
+					throw (VariableModelExceptions::NoSuchGroupException,
+					VariableModelExceptions::InvalidNumberOfDimensionIndexesException);
+
+	/** @brief Inserts given group of parameters into parameters map with matchedNameOfParameter as a key.
+	 *
+	 * @details This is private method that is called by any member of the newParameter() functions' family.
+	 *
+	 * @param matchedNameOfParameter base name of a matched group of parameters
+	 * @param dimensions table of given group's dimensions
+	 * @param lowerBound lower bound of every parameter among given group
+	 * @param upperBound upper bound of every parameter among given group
+	 * @param type type of every parameter among given group
+	 * @param value initial value of every parameter among given group
+	 *
+	 * @throw ParameterModelExceptions::DuplicateException will be thrown in case in #parameters
+	 * there is already such an element with given name.
+	 * @throw ParameterModelExceptions::InvalidGroupDefinitionException will be thrown in case group has more parameters
+	 * than ParamIdx can index.
+	 *
+	 */
+	void insertParameters(const std::string& matchedNameOfParameter,
+			const ParamDimensionTable& dimensions, const ParamValue lowerBound,
+			const ParamValue upperBound, const ValueType type,
+			const ParamValue value)
+					throw (ParameterModelExceptions::DuplicateException,
+					ParameterModelExceptions::InvalidGroupDefinitionException);
+
+	/** @brief Return ParamIdxMapper of given group of parameters.
+	 *
+	 * @details Name is copied into thread-local buffer which is reused between calls
+	 * (@see getVariableIdxMapperAt(const char*, const size_t)).
+	 *
+	 * @param groupOfParametersName first character of base name of group of parameters
+	 * @param length number of characters of base name
+	 * @return group of parameters with given base name if such group exists
+	 *
+	 * @throw ParameterModelExceptions::NoSuchGroupException will be raised
+	 * if in the #parameters map there is no such a group of parameters with given name.
+	 *
+	 */
+	ParamIdxMapper* getParamIdxMapperAt(const char* groupOfParametersName,
+			const size_t length)
+					throw (ParameterModelExceptions::NoSuchGroupException);
+
+	/** @brief Return ParamIdxMapper of given group of parameters if it has expected number of dimensions.
+	 *
+	 * @details Non-template part of paramGroup().
+	 *
+	 * @param groupOfParametersName base name of group of parameters
+	 * @param numberOfDimensions expected number of dimensions of group
+	 * @return group of parameters with given base name
+	 *
+	 * @throw ParameterModelExceptions::NoSuchGroupException if there is no such a group of parameters with given name.
+	 * @throw ParameterModelExceptions::InvalidNumberOfDimensionIndexesException if group of parameters was found
+	 * but has different number of dimensions.
+	 *
+	 */
+	ParamIdxMapper* getParameterGroup(const std::string& groupOfParametersName,
+			const ParamDimIdx numberOfDimensions)
+					throw (ParameterModelExceptions::NoSuchGroupException,
+					ParameterModelExceptions::InvalidNumberOfDimensionIndexesException);
+
+	/** @brief Inserts given group of rows into rows map with matchedNameOfRow as a key.
+	 *
+	 * @details This is private method that is called by any member of the newRows() functions' family.
+	 *
+	 * @param matchedNameOfRow base name of a matched group of rows
+	 * @param dimensions table of given group's dimensions
+	 * @param lowerBound lower bound of every row among given group
+	 * @param upperBound upper bound of every row among given group
+	 *
+	 * @throw RowModelExceptions::DuplicateException will be thrown in case in #rows
+	 * there is already such an element with given name.
+	 * @throw RowModelExceptions::InvalidGroupDefinitionException will be thrown in case group has more rows
+	 * than RowIdx can index or they cannot be added to rows of model.
+	 *
+	 */
+	void insertRows(const std::string& matchedNameOfRow,
+			const RowDimensionTable& dimensions, const VarValue lowerBound,
+			const VarValue upperBound)
+					throw (RowModelExceptions::DuplicateException,
+					RowModelExceptions::InvalidGroupDefinitionException);
+
+	/** @brief Return RowIdxMapper of given group of rows.
+	 *
+	 * @details Name is copied into thread-local buffer which is reused between calls
+	 * (@see getVariableIdxMapperAt(const char*, const size_t)).
+	 *
+	 * @param groupOfRowsName first character of base name of group of rows
+	 * @param length number of characters of base name
+	 * @return group of rows with given base name if such group exists
+	 *
+	 * @throw RowModelExceptions::NoSuchGroupException will be raised
+	 * if in the #rows map there is no such a group of rows with given name.
+	 *
+	 */
+	RowIdxMapper* getRowIdxMapperAt(const char* groupOfRowsName,
+			const size_t length) throw (RowModelExceptions::NoSuchGroupException);
+
+	/** @brief Return RowIdxMapper of given group of rows if it has expected number of dimensions.
+	 *
+	 * @details Non-template part of rowGroup().
+	 *
+	 * @param groupOfRowsName base name of group of rows
+	 * @param numberOfDimensions expected number of dimensions of group
+	 * @return group of rows with given base name
+	 *
+	 * @throw RowModelExceptions::NoSuchGroupException if there is no such a group of rows with given name.
+	 * @throw RowModelExceptions::InvalidNumberOfDimensionIndexesException if group of rows was found
+	 * but has different number of dimensions.
+	 *
+	 */
+	RowIdxMapper* getRowGroup(const std::string& groupOfRowsName,
+			const RowDimIdx numberOfDimensions)
+					throw (RowModelExceptions::NoSuchGroupException,
+					RowModelExceptions::InvalidNumberOfDimensionIndexesException);
+
+	/** @brief Returns given array of solution at the first column of given group of variables.
+	 *
+	 * @details Non-template part of values() and reducedCosts().
+	 *
+	 * @param groupOfVariablesName base name of group of variables
+	 * @param numberOfDimensions expected number of dimensions of group
+	 * @param part array of solution
+	 * @param solution snapshot to read from (nullptr means arrays of the solver)
+	 * @param dimensions output pointer to dimensions of group
+	 * @return
+	 *
+	 * @throw VariableModelExceptions::NoSuchGroupException if there is no such a group of variables with given name.
+	 * @throw VariableModelExceptions::InvalidNumberOfDimensionIndexesException if group of variables was found
+	 * but has different number of dimensions.
+	 * @throw ModelExceptions::NoSolutionException if given array of solution is not available.
+	 *
+	 */
+	const VarValue* getVariableSolution(const std::string& groupOfVariablesName,
+			const VarDimIdx numberOfDimensions, const Solution::Part part,
+			const Solution* solution, const VarDimensionTable*& dimensions)
+					throw (VariableModelExceptions::NoSuchGroupException,
+					VariableModelExceptions::InvalidNumberOfDimensionIndexesException,
+					ModelExceptions::NoSolutionException);
+
+	/** @brief Returns dual values of solution at the first row of given group of rows.
+	 *
+	 * @details Non-template part of rowPrices().
+	 *
+	 * @param groupOfRowsName base name of group of rows
+	 * @param numberOfDimensions expected number of dimensions of group
+	 * @param solution snapshot to read from (nullptr means arrays of the solver)
+	 * @param dimensions output pointer to dimensions of group
+	 * @return
+	 *
+	 * @throw RowModelExceptions::NoSuchGroupException if there is no such a group of rows with given name.
+	 * @throw RowModelExceptions::InvalidNumberOfDimensionIndexesException if group of rows was found
+	 * but has different number of dimensions.
+	 * @throw ModelExceptions::NoSolutionException if dual values are not available.
+	 *
+	 */
+	const VarValue* getRowSolution(const std::string& groupOfRowsName,
+			const RowDimIdx numberOfDimensions, const Solution* solution,
+			const RowDimensionTable*& dimensions)
+					throw (RowModelExceptions::NoSuchGroupException,
+					RowModelExceptions::InvalidNumberOfDimensionIndexesException,
+					ModelExceptions::NoSolutionException);
+
+	/** @brief Returns given array of the last solution (or of given snapshot) if it covers group of given end.
+	 *
+	 * @details Groups are only appended to the model, so snapshot taken before new groups were added
+	 * still covers every older group.
+	 *
+	 * @param part
+	 * @param solution snapshot to read from (nullptr means arrays of the solver)
+	 * @param size index following the last column or row of group
+	 * @return nullptr if array is not available
+	 */
+	const VarValue* getSolutionValues(const Solution::Part part,
+			const Solution* solution, const size_t size) const;
+
+	/** @brief Checks that coefficients and bounds appended to buffer since given positions refer to existing rows and columns.
+	 *
+	 * @details Called by worker of generateRows() for every finished batch, before anything is merged into problem instance.
+	 *
+	 * @param buffer
+	 * @param elementsBegin position of the first coefficient to check
+	 * @param boundsBegin position of the first bound to check
+	 *
+	 * @throw RowModelExceptions::IndexOutOfBoundException if any row does not exist in problem instance.
+	 * @throw VariableModelExceptions::IndexOutOfBoundException if any column does not exist in problem instance.
+	 */
+	void checkRowBuffer(const RowBuffer& buffer, const size_t elementsBegin,
+			const size_t boundsBegin) const
+					throw (RowModelExceptions::IndexOutOfBoundException,
+					VariableModelExceptions::IndexOutOfBoundException);
+
+	/** @brief Reserves space for coefficients of family of rows.
+	 *
+	 * @details Non-template part of forall().
+	 *
+	 * @param rowGroup group of rows of family
+	 * @param numberOfRows number of rows of family
+	 * @param elementsPerRow expected number of coefficients of each row
+	 */
+	void reserveRowFamily(const RowIdxMapper* rowGroup,
+			const size_t numberOfRows, const size_t elementsPerRow);
+
 public:
 
 	//************************************* PUBLIC CONSTANT FIELDS *************************************//
@@ -323,6 +588,7 @@ public:
 	 * Example:
 	 * @code
 	 * 	Solver s(SolverInterface::GLPK);	// will create new OsiGlpkSolverInterface as a solver.
+	 * 	Solver t(SolverInterface::CLP);	// the same model may be built for Clp (or Cbc for MIP problems)
 	 * @endcode
 	 *
 	 * @param solverInterface
@@ -351,7 +617,7 @@ public:
 	 * @throw VariableModelExceptions::InvalidGroupDefinitionException will be thrown in case
 	 * variableDefinition is not a valid definition of group of variables/variable.
 	 *
-	 * @see #VAR_REGEXP
+	 * @see StringUtils::parseDefinition()
 	 *
 	 */
 	void newVariable(const std::string& variableDefinition)
@@ -382,7 +648,7 @@ public:
 	 * @throw VariableModelExceptions::InvalidGroupDefinitionException will be thrown in case
 	 * variableDefinition is not a valid definition of group of variables/variable.
 	 *
-	 * @see #VAR_REGEXP
+	 * @see StringUtils::parseDefinition()
 	 * @see ValueType
 	 *
 	 */
@@ -428,7 +694,7 @@ public:
 	 * @throw VariableModelExceptions::InvalidGroupDefinitionException will be thrown in case
 	 * variableDefinition is not a valid definition of group of variables/variable.
 	 *
-	 * @see #VAR_REGEXP
+	 * @see StringUtils::parseDefinition()
 	 * @see ValueType
 	 * @see Utils::getUnbounded()
 	 *
@@ -441,7 +707,8 @@ public:
 
 	/** @brief Removes every group of variables available.
 	 *
-	 * @details Removes every VariableIdxMapper instance in variables map.
+	 * @details Removes every VariableIdxMapper instance in variables map together with every column
+	 * (and so every coefficient) of problem instance.
 	 *
 	 */
 	void deleteAllVariables();
@@ -449,14 +716,19 @@ public:
 	/** @brief Removes entire group of variables.
 	 *
 	 * @details It will remove given group of variables from groups' map (@see variables)
-	 * and after that delete object from memory itself.
+	 * and after that delete object from memory itself. Columns of the group are removed from problem instance
+	 * together with their coefficients and columns of groups created later are moved down
+	 * (@see OsiProblemInstance::deleteColumns()), so views of variables (Variable, VarGroup), scenarios
+	 * and snapshots of solution taken before deletion are no longer valid. Columns that are known to the solver
+	 * are deleted from it by the next loadProblem() and the next solve starts from basis remapped
+	 * onto remaining groups (@see setBasis()).
 	 *
 	 * @param variableName base name of a group of variables to be deleted
 	 * @throw std::out_of_range is thrown if no such variable is defined.
 	 */
 	void deleteVariable(const char* variableName) throw (std::out_of_range);
 
-	/** @brief Returns a reference to variable that matched given variableDefinition.
+	/** @brief Returns a view of variable that matched given variableDefinition.
 	 *
 	 * @details For 0-dimensional variable e.g. "x" there are two valid forms: "x" and "x[1]".
 	 *
@@ -471,7 +743,7 @@ public:
 	 *
 	 * @param variableDefinition definition of one particular variable e.g. "x[3]".
 	 *
-	 * @return reference to variable defined by variableDefinition
+	 * @return view of variable defined by variableDefinition
 	 *
 	 * @throw std::out_of_range If no such group of variable is defined.
 	 * @throw InvalidNumberOfDimensionIndexesException If group of variables was found
@@ -479,15 +751,15 @@ public:
 	 * @throw IndexOutOfBoundException If one or more indexes in given definition
 	 * extends dimension sizes of group of variables.
 	 * @throw InvalidVariableDefinitionException General error is thrown
-	 * when given variableDefinition is not a definition of group of variables (does not match #VAR_REGEXP).
+	 * when given variableDefinition is not a definition of group of variables (@see StringUtils::parseDefinition()).
 	 */
-	Variable& getVariable(const std::string& variableDefinition)
+	Variable getVariable(const std::string& variableDefinition)
 			throw (std::out_of_range,
 			VariableModelExceptions::InvalidNumberOfDimensionIndexesException,
 			VariableModelExceptions::IndexOutOfBoundException,
 			VariableModelExceptions::InvalidDefinitionException);
 
-	/** @brief Returns a reference to variable that matched given variableDefinition.
+	/** @brief Returns a view of variable that matched given variableDefinition.
 	 *
 	 * @details This method allows to input variables as indexes of given variableDefinition.
 	 * For 0-dimensional variables there is no option to retrieve them
@@ -505,7 +777,7 @@ public:
 	 * @param variableDefinition definition of variable with empty brackets.
 	 * @param firstDimensionIndex index of the highest dimension (the first one after base name)
 	 *
-	 * @return reference to variable defined by variableDefinition and given indexes.
+	 * @return view of variable defined by variableDefinition and given indexes.
 	 *
 	 * @throw std::out_of_range If no such group of variable is defined.
 	 * @throw InvalidNumberOfDimensionIndexesException If group of variables was found
@@ -513,22 +785,857 @@ public:
 	 * @throw IndexOutOfBoundException If one or more indexes in given definition
 	 * extends dimension sizes of group of variables.
 	 * @throw InvalidVariableDefinitionException General error is thrown
-	 * when given variableDefinition is not a definition of group of variables (@see VAR_REGEXP).
+	 * when given variableDefinition is not a definition of group of variables (@see StringUtils::parseDefinition()).
 	 */
-	Variable& getVariable(const std::string& variableDefinition,
+	Variable getVariable(const std::string& variableDefinition,
 			VarDimIdx firstDimensionIndex,
 			...) throw (std::out_of_range,
 					VariableModelExceptions::InvalidNumberOfDimensionIndexesException,
 					VariableModelExceptions::IndexOutOfBoundException);
 
+	/** @brief Returns prepared handle of N-dimensional group of variables.
+	 *
+	 * @details Name of group is resolved only once, every access through returned handle
+	 * is a bounds check and stride arithmetic (@see VarGroup). Handle stays valid
+	 * as long as group of variables exists. Definition of VarGroup is given in VarGroup.hpp
+	 * that has to be included in order to use this function.
+	 *
+	 * Example:
+	 * @code
+	 * Solver s(SolverInterface::GLPK);
+	 * s.newVariable("z[3][4][5]");
+	 * VarGroup<3> z = s.group<3>("z");
+	 * z(1, 2, 3);					// the same as s.getVariable("z[1][2][3]")
+	 * z.getColumnIdx(1, 2, 3);	// index of column of variable "z[1][2][3]"
+	 * @endcode
+	 *
+	 * @param groupOfVariablesName base name of group of variables
+	 * @return
+	 *
+	 * @throw VariableModelExceptions::NoSuchGroupException if there is no such a group of variables with given name.
+	 * @throw VariableModelExceptions::InvalidNumberOfDimensionIndexesException if group of variables was found
+	 * but has different number of dimensions than N.
+	 */
+	template<VarDimIdx N>
+	VarGroup<N> group(const std::string& groupOfVariablesName)
+			throw (VariableModelExceptions::NoSuchGroupException,
+			VariableModelExceptions::InvalidNumberOfDimensionIndexesException) {
+		return VarGroup<N> { getVariableGroup(groupOfVariablesName, N) };
+	}
+
+	/** @brief Creates new group of unbounded parameters equal to 0 according to given definition.
+	 *
+	 * @details Definition of group of parameters has the same form as definition of group of variables
+	 * (@see StringUtils::parseDefinition()). Values of the whole group are stored in one dense array
+	 * (@see ParamIdxMapper).
+	 *
+	 * @param parameterDefinition full definition of group of parameters to be created
+	 *
+	 * @throw ParameterModelExceptions::DuplicateException will be thrown in case
+	 * already exists a group of parameters with the same base name.
+	 * @throw ParameterModelExceptions::InvalidGroupDefinitionException will be thrown in case
+	 * parameterDefinition is not a valid definition of group of parameters.
+	 *
+	 */
+	void newParameter(const std::string& parameterDefinition)
+			throw (ParameterModelExceptions::DuplicateException,
+			ParameterModelExceptions::InvalidGroupDefinitionException);
+
+	/** @brief Creates new group of unbounded parameters equal to given value according to given definition.
+	 *
+	 * @param parameterDefinition full definition of group of parameters to be created
+	 * @param value initial value of every parameter among given group
+	 *
+	 * @throw ParameterModelExceptions::DuplicateException will be thrown in case
+	 * already exists a group of parameters with the same base name.
+	 * @throw ParameterModelExceptions::InvalidGroupDefinitionException will be thrown in case
+	 * parameterDefinition is not a valid definition of group of parameters.
+	 *
+	 */
+	void newParameter(const std::string& parameterDefinition,
+			const ParamValue value)
+					throw (ParameterModelExceptions::DuplicateException,
+					ParameterModelExceptions::InvalidGroupDefinitionException);
+
+	/** @brief Creates new group of bounded parameters equal to given value according to given definition.
+	 *
+	 * @details For example calling:
+	 * @code
+	 * Solver s(SolverInterface::GLPK);
+	 * s.newParameter("demand[10][4]", 0, 0, 100, ValueType::INTEGER);	// 40 parameters: 0 <= demand <= 100
+	 * @endcode
+	 *
+	 * @param parameterDefinition full definition of group of parameters to be created
+	 * @param value initial value of every parameter among given group
+	 * @param parameterLowerBound lower bound of every parameter among given group
+	 * @param parameterUpperBound upper bound of every parameter among given group
+	 * @param parameterType type of every parameter among given group
+	 *
+	 * @throw ParameterModelExceptions::DuplicateException will be thrown in case
+	 * already exists a group of parameters with the same base name.
+	 * @throw ParameterModelExceptions::InvalidGroupDefinitionException will be thrown in case
+	 * parameterDefinition is not a valid definition of group of parameters.
+	 * @throw ParameterModelExceptions::ValueOutOfBoundException will be thrown in case
+	 * given value is out of given bounds.
+	 *
+	 */
+	void newParameter(const std::string& parameterDefinition,
+			const ParamValue value, const ParamValue parameterLowerBound,
+			const ParamValue parameterUpperBound,
+			const ValueType parameterType)
+					throw (ParameterModelExceptions::DuplicateException,
+					ParameterModelExceptions::InvalidGroupDefinitionException,
+					ParameterModelExceptions::ValueOutOfBoundException);
+
+	/** @brief Creates new group of parameters stored in given tensor file (@see TensorFileUtils).
+	 *
+	 * @details Name of group is taken from file. Values of type TensorFileUtils::DataType::FLOAT64 are used
+	 * in place (file is mapped into memory copy-on-write), so group is ready within milliseconds regardless
+	 * of size of file and pages of file that are never accessed are never read. Values of other types
+	 * are converted into ParamValue values. Parameters of loaded group are unbounded.
+	 *
+	 * Example:
+	 * @code
+	 * Solver s(SolverInterface::GLPK);
+	 * s.loadParameter("/data/distance.tensor");	// e.g. 20000x20000 matrix named "distance"
+	 * ParamGroup<2> distance = s.paramGroup<2>("distance");
+	 * @endcode
+	 *
+	 * @param fileName
+	 *
+	 * @throw ParameterModelExceptions::DuplicateException will be thrown in case
+	 * already exists a group of parameters with the same base name.
+	 * @throw ParameterModelExceptions::TensorFileException will be thrown in case
+	 * file cannot be read or it is not a valid tensor file.
+	 */
+	void loadParameter(const std::string& fileName)
+			throw (ParameterModelExceptions::DuplicateException,
+			ParameterModelExceptions::TensorFileException);
+
+	/** @brief Creates new group of parameters with given name stored in given tensor file.
+	 *
+	 * @see loadParameter(const std::string&)
+	 *
+	 * @param fileName
+	 * @param groupOfParametersName base name of new group of parameters (it replaces name stored in file)
+	 *
+	 * @throw ParameterModelExceptions::DuplicateException will be thrown in case
+	 * already exists a group of parameters with the same base name.
+	 * @throw ParameterModelExceptions::TensorFileException will be thrown in case
+	 * file cannot be read or it is not a valid tensor file.
+	 */
+	void loadParameter(const std::string& fileName,
+			const std::string& groupOfParametersName)
+					throw (ParameterModelExceptions::DuplicateException,
+					ParameterModelExceptions::TensorFileException);
+
+	/** @brief Saves given group of parameters into tensor file (@see TensorFileUtils::write()).
+	 *
+	 * @param groupOfParametersName base name of group of parameters
+	 * @param fileName
+	 *
+	 * @throw ParameterModelExceptions::NoSuchGroupException if there is no such a group of parameters with given name.
+	 * @throw ParameterModelExceptions::TensorFileException will be thrown in case file cannot be written.
+	 */
+	void saveParameter(const std::string& groupOfParametersName,
+			const std::string& fileName)
+					throw (ParameterModelExceptions::NoSuchGroupException,
+					ParameterModelExceptions::TensorFileException);
+
+	/** @brief Assigns values of given group of parameters from delimited text file (CSV or TSV).
+	 *
+	 * @details Every line of file holds one-based indexes of parameter followed by its value, e.g.
+	 * "3,14,0.25" or "3\t14\t0.25" for group "p[5][20]". Fields are separated by commas, semicolons,
+	 * tabs or spaces, empty lines and lines starting with '#' are skipped and invalid first line
+	 * is treated as header. File is read in large blocks which are parsed by several threads
+	 * while the next block is read (@see ParamTextLoader).
+	 *
+	 * Parameters not present in file get given default value. The value of parameter present more than
+	 * once that comes first in file wins (regardless of number of threads), lines that are not valid entries (bad number, index or
+	 * value out of bounds of group) are skipped - both are counted in returned report.
+	 *
+	 * @param groupOfParametersName base name of existing group of parameters
+	 * @param fileName
+	 * @param defaultValue value of parameters not present in file
+	 * @param numberOfThreads number of parsing threads (0 means number of hardware threads)
+	 * @return summary of loaded file
+	 *
+	 * @throw ParameterModelExceptions::NoSuchGroupException if there is no such a group of parameters with given name.
+	 * @throw ParameterModelExceptions::DataFileException will be thrown in case file cannot be read.
+	 */
+	ParamLoadReport loadParameterText(const std::string& groupOfParametersName,
+			const std::string& fileName, const ParamValue defaultValue = 0,
+			const unsigned int numberOfThreads = 0)
+					throw (ParameterModelExceptions::NoSuchGroupException,
+					ParameterModelExceptions::DataFileException);
+
+	/** @brief Deletes every group of parameters.
+	 *
+	 */
+	void deleteAllParameters();
+
+	/** @brief Returns view of parameter based on given parameter definition.
+	 *
+	 * @details Example:
+	 * @code
+	 * Solver s(SolverInterface::GLPK);
+	 * s.newParameter("p[3][4]");
+	 * s.getParameter("p[2][3]").setValue(5);
+	 * @endcode
+	 *
+	 * @param parameterDefinition full definition of single parameter (@see StringUtils::parseDefinition())
+	 * @return
+	 *
+	 * @throw ParameterModelExceptions::NoSuchGroupException if no such group of parameters is defined.
+	 * @throw ParameterModelExceptions::InvalidNumberOfDimensionIndexesException if group of parameters was found
+	 * but has different number of dimensions then given in parameterDefinition.
+	 * @throw ParameterModelExceptions::IndexOutOfBoundException if one or more indexes in given definition
+	 * extends dimension sizes of group of parameters.
+	 * @throw ParameterModelExceptions::InvalidDefinitionException if given parameterDefinition
+	 * is not a definition of single parameter.
+	 */
+	Parameter getParameter(const std::string& parameterDefinition)
+			throw (ParameterModelExceptions::NoSuchGroupException,
+			ParameterModelExceptions::InvalidNumberOfDimensionIndexesException,
+			ParameterModelExceptions::IndexOutOfBoundException,
+			ParameterModelExceptions::InvalidDefinitionException);
+
+	/** @brief Returns prepared handle of N-dimensional group of parameters.
+	 *
+	 * @details Counterpart of group() for parameters (@see ParamGroup). Definition of ParamGroup is given
+	 * in ParamGroup.hpp that has to be included in order to use this function.
+	 *
+	 * @param groupOfParametersName base name of group of parameters
+	 * @return
+	 *
+	 * @throw ParameterModelExceptions::NoSuchGroupException if there is no such a group of parameters with given name.
+	 * @throw ParameterModelExceptions::InvalidNumberOfDimensionIndexesException if group of parameters was found
+	 * but has different number of dimensions than N.
+	 */
+	template<ParamDimIdx N>
+	ParamGroup<N> paramGroup(const std::string& groupOfParametersName)
+			throw (ParameterModelExceptions::NoSuchGroupException,
+			ParameterModelExceptions::InvalidNumberOfDimensionIndexesException) {
+		return ParamGroup<N> { getParameterGroup(groupOfParametersName, N) };
+	}
+
+	/** @brief Creates new group of free rows according to given definition.
+	 *
+	 * @details Definition of group of rows has the same form as definition of group of variables
+	 * (@see StringUtils::parseDefinition()). New rows have neither upper nor lower bound.
+	 *
+	 * @param rowDefinition full definition of group of rows to be created
+	 *
+	 * @throw RowModelExceptions::DuplicateException will be thrown in case
+	 * already exists a group of rows with the same base name.
+	 * @throw RowModelExceptions::InvalidGroupDefinitionException will be thrown in case
+	 * rowDefinition is not a valid definition of group of rows.
+	 *
+	 */
+	void newRows(const std::string& rowDefinition)
+			throw (RowModelExceptions::DuplicateException,
+			RowModelExceptions::InvalidGroupDefinitionException);
+
+	/** @brief Creates new group of bounded rows according to given definition.
+	 *
+	 * @details For example calling:
+	 * @code
+	 * Solver s(SolverInterface::GLPK);
+	 * s.newRows("capacity[10][4]", Utils::getUnbounded(Bounds::LOWER), 100);	// 40 rows: ... <= 100
+	 * s.newRows("demand[10]", 5, 5);												// 10 rows: ... = 5
+	 * @endcode
+	 *
+	 * Coefficients are added through views of rows (@see Row::addElement()) and the whole problem
+	 * is passed to the solver by loadProblem().
+	 *
+	 * @param rowDefinition full definition of group of rows to be created
+	 * @param rowLowerBound lower bound of every row among given group
+	 * @param rowUpperBound upper bound of every row among given group
+	 *
+	 * @throw RowModelExceptions::DuplicateException will be thrown in case
+	 * already exists a group of rows with the same base name.
+	 * @throw RowModelExceptions::InvalidGroupDefinitionException will be thrown in case
+	 * rowDefinition is not a valid definition of group of rows.
+	 *
+	 */
+	void newRows(const std::string& rowDefinition,
+			const VarValue rowLowerBound, const VarValue rowUpperBound)
+					throw (RowModelExceptions::DuplicateException,
+					RowModelExceptions::InvalidGroupDefinitionException);
+
+	/** @brief Removes every group of rows available.
+	 *
+	 * @details Removes every RowIdxMapper instance in rows map together with every row
+	 * (and so every coefficient) of problem instance (@see deleteVariable()).
+	 *
+	 */
+	void deleteAllRows();
+
+	/** @brief Returns a view of row that matched given rowDefinition.
+	 *
+	 * @details Rows are addressed in the same way as variables (@see getVariable(const std::string&)).
+	 *
+	 * @param rowDefinition definition of one particular row e.g. "capacity[3][2]".
+	 *
+	 * @return view of row defined by rowDefinition
+	 *
+	 * @throw RowModelExceptions::NoSuchGroupException If no such group of rows is defined.
+	 * @throw RowModelExceptions::InvalidNumberOfDimensionIndexesException If group of rows was found
+	 * but has different number of dimensions then given in rowDefinition.
+	 * @throw RowModelExceptions::IndexOutOfBoundException If one or more indexes in given definition
+	 * extends dimension sizes of group of rows.
+	 * @throw RowModelExceptions::InvalidDefinitionException General error is thrown
+	 * when given rowDefinition is not a valid definition (@see StringUtils::parseDefinition()).
+	 */
+	Row getRow(const std::string& rowDefinition)
+			throw (RowModelExceptions::NoSuchGroupException,
+			RowModelExceptions::InvalidNumberOfDimensionIndexesException,
+			RowModelExceptions::IndexOutOfBoundException,
+			RowModelExceptions::InvalidDefinitionException);
+
+	/** @brief Returns prepared handle of N-dimensional group of rows.
+	 *
+	 * @details Counterpart of group() for rows (@see RowGroup). Definition of RowGroup is given
+	 * in RowGroup.hpp that has to be included in order to use this function.
+	 *
+	 * @param groupOfRowsName base name of group of rows
+	 * @return
+	 *
+	 * @throw RowModelExceptions::NoSuchGroupException if there is no such a group of rows with given name.
+	 * @throw RowModelExceptions::InvalidNumberOfDimensionIndexesException if group of rows was found
+	 * but has different number of dimensions than N.
+	 */
+	template<RowDimIdx N>
+	RowGroup<N> rowGroup(const std::string& groupOfRowsName)
+			throw (RowModelExceptions::NoSuchGroupException,
+			RowModelExceptions::InvalidNumberOfDimensionIndexesException) {
+		return RowGroup<N> { getRowGroup(groupOfRowsName, N) };
+	}
+
+	/** @brief Generates coefficients of rows in parallel.
+	 *
+	 * @details Tasks [0, numberOfTasks) are split into batches of consecutive tasks that worker threads
+	 * take one after another. Each worker appends coefficients (and optionally new bounds) of rows to its own
+	 * RowBuffer so no locks are taken while generating. When every task is done buffers are merged
+	 * into problem instance in order of tasks (coefficients are copied by all threads at once),
+	 * so the model is bit-identical regardless of number of threads.
+	 *
+	 * If any generator throws or adds coefficient or bounds of row or column that does not exist,
+	 * nothing is merged and the exception is rethrown (the one thrown by thread with the lowest number
+	 * if more of them failed).
+	 *
+	 * Example (one capacity row per facility and period):
+	 * @code
+	 * 	Solver s(SolverInterface::GLPK);
+	 * 	s.newVariable("x[1000][100][12]", 0, 1, ValueType::DOUBLE);	// x[customer][facility][period]
+	 * 	s.newRows("capacity[100][12]", Utils::getUnbounded(Bounds::LOWER), 50);
+	 * 	VarGroup<3> x = s.group<3>("x");
+	 * 	RowGroup<2> capacity = s.rowGroup<2>("capacity");
+	 *
+	 * 	s.generateRows(100 * 12, [&](const size_t task, RowBuffer& buffer) {
+	 * 		const RowDimIdx f = task / 12 + 1, t = task % 12 + 1;
+	 * 		for (VarDimIdx c = 1; c <= 1000; c += 1) {
+	 * 			buffer.addElement(capacity.getRowIdx(f, t), x.getColumnIdx(c, f, t), 1);
+	 * 		}
+	 * 	});
+	 * @endcode
+	 *
+	 * @param numberOfTasks number of tasks
+	 * @param generator function called once for every task
+	 * @param numberOfThreads number of worker threads (0 for number of hardware threads)
+	 * @param batchSize number of consecutive tasks taken by worker at once (0 for automatic choice)
+	 *
+	 * @throw RowModelExceptions::IndexOutOfBoundException if generator refers to row that does not exist.
+	 * @throw VariableModelExceptions::IndexOutOfBoundException if generator refers to column that does not exist.
+	 */
+	void generateRows(const size_t numberOfTasks, const RowGenerator& generator,
+			const unsigned int numberOfThreads = 0, const size_t batchSize = 0);
+
+	/** @brief Generates constraints of family of rows indexed like given group of rows.
+	 *
+	 * @details Generator is called once for every combination of indexes from given ranges
+	 * and returns constraint (@see LinearExpr) of row with these indexes. Rows are taken in row-major order
+	 * (the last dimension changes the fastest) and split into batches generated in parallel
+	 * (@see generateRows()), so every row is located by stride arithmetic only and coefficients go straight
+	 * into thread-local buffers. If elementsPerRow is given, space for coefficients of the whole family
+	 * is reserved up front.
+	 *
+	 * Constraint is written into buffer after generator returns, so functions passed to sum() have to capture
+	 * indexes of row by value.
+	 *
+	 * Example (one capacity row per facility and period, without the first period):
+	 * @code
+	 * 	Solver s(SolverInterface::GLPK);
+	 * 	s.newVariable("x[1000][100][12]", 0, 1, ValueType::DOUBLE);	// x[customer][facility][period]
+	 * 	s.newRows("capacity[100][12]");
+	 * 	VarGroup<3> x = s.group<3>("x");
+	 *
+	 * 	s.forall(s.rowGroup<2>("capacity"), { range(100), range(2, 12) },
+	 * 			[&](const RowDimIdx f, const RowDimIdx t) {
+	 * 				return sum(1, 1000, [&, f, t](const VarDimIdx c) { return x(c, f, t); }) <= 50;
+	 * 			}, 1000);
+	 * @endcode
+	 *
+	 * @param rows group of rows of family
+	 * @param ranges N ranges of indexes, from the highest dimension to the lowest (@see range())
+	 * @param constraint function of N indexes (RowDimIdx) that returns Constraint
+	 * @param elementsPerRow expected number of coefficients of each row (0 if unknown)
+	 * @param numberOfThreads number of worker threads (0 for number of hardware threads)
+	 * @param batchSize number of consecutive rows generated by worker at once (0 for automatic choice)
+	 *
+	 * @throw RowModelExceptions::IndexOutOfBoundException if any non-empty range contains 0
+	 * or exceeds size of its dimension.
+	 * @throw VariableModelExceptions::IndexOutOfBoundException if constraint refers to variable that does not exist.
+	 * Any other exception thrown by constraint is rethrown as well (@see generateRows()).
+	 */
+	template<RowDimIdx N, typename F>
+	void forall(const RowGroup<N>& rows, const IndexRange (&ranges)[N],
+			const F& constraint, const size_t elementsPerRow = 0,
+			const unsigned int numberOfThreads = 0, const size_t batchSize = 0) {
+		const size_t numberOfRows { rows.getNumberOfRows(ranges) };
+		reserveRowFamily(rows.getRowGroup(), numberOfRows, elementsPerRow);
+		generateRows(numberOfRows,
+				[&](const size_t task, RowBuffer& buffer) {
+					rows.generateRow(task, ranges, constraint, buffer);
+				}, numberOfThreads, batchSize);
+	}
+
+	/** @brief Generates constraints of every row of given group.
+	 *
+	 * @see forall(const RowGroup<N>&, const IndexRange (&)[N], const F&, const size_t, const unsigned int, const size_t)
+	 *
+	 * @param rows group of rows of family
+	 * @param constraint function of N indexes (RowDimIdx) that returns Constraint
+	 * @param elementsPerRow expected number of coefficients of each row (0 if unknown)
+	 * @param numberOfThreads number of worker threads (0 for number of hardware threads)
+	 * @param batchSize number of consecutive rows generated by worker at once (0 for automatic choice)
+	 *
+	 * @throw VariableModelExceptions::IndexOutOfBoundException if constraint refers to variable that does not exist.
+	 * Any other exception thrown by constraint is rethrown as well (@see generateRows()).
+	 */
+	template<RowDimIdx N, typename F>
+	void forall(const RowGroup<N>& rows, const F& constraint,
+			const size_t elementsPerRow = 0, const unsigned int numberOfThreads =
+					0, const size_t batchSize = 0) {
+		IndexRange ranges[N == 0 ? 1 : N] { };
+		for (RowDimIdx i = 0; i < N; i += 1) {
+			ranges[i] = rows.getRange(i);
+		}
+		const size_t numberOfRows { rows.getNumberOfRows(ranges) };
+		reserveRowFamily(rows.getRowGroup(), numberOfRows, elementsPerRow);
+		generateRows(numberOfRows,
+				[&](const size_t task, RowBuffer& buffer) {
+					rows.generateRow(task, ranges, constraint, buffer);
+				}, numberOfThreads, batchSize);
+	}
+
+	/** @brief Passes the model (columns, rows and coefficients) to the solver.
+	 *
+	 * @details Coefficients are accumulated by problem instance as triplets, so model is built
+	 * in time proportional to number of coefficients and passed by single call
+	 * (@see OsiProblemInstance::loadProblem()) instead of adding rows one by one.
+	 *
+	 * Subsequent calls pass only changes made since the previous one (@see OsiProblemInstance::updateProblem()),
+	 * so e.g. re-solving after changing a few coefficients keeps basis of the previous solution:
+	 * @code
+	 * 	s.loadProblem();										// whole model is loaded
+	 * 	...														// solve
+	 * 	s.getVariable("x[3][2]").setObjectiveCoefficient(5);
+	 * 	s.loadProblem();										// only objective coefficient of x[3][2] is passed
+	 * @endcode
+	 *
+	 */
+	void loadProblem();
+
+	/** @brief Passes the whole model to the solver once again, discarding its current state.
+	 *
+	 */
+	void reloadProblem();
+
+	/** @brief Solves this model.
+	 *
+	 * @details Model is loaded into the solver first (@see loadProblem()). Simplex starts from basis
+	 * of the previous solution, so reoptimization after small changes of model takes only a few iterations.
+	 * Basis can also be taken from another model or file (@see setBasis(), loadBasis()).
+	 *
+	 * Example:
+	 * @code
+	 * 	Solver s(SolverInterface::CLP);
+	 * 	// ... build model
+	 * 	s.solve();						// cold start
+	 * 	s.saveBasis("/data/model.basis");
+	 * 	s.getVariable("x[3][2]").setObjectiveCoefficient(5);
+	 * 	s.solve();						// warm start from basis of the previous solution
+	 *
+	 * 	Solver t(SolverInterface::CLP);
+	 * 	// ... build the same model (groups may have different sizes)
+	 * 	t.loadBasis("/data/model.basis");
+	 * 	t.solve();						// warm start from saved basis
+	 * @endcode
+	 *
+	 * @param options time limit and progress callback of solve (@see SolveOptions)
+	 * @return
+	 */
+	SolveStatus solve(const SolveOptions& options = SolveOptions());
+
+	/** @brief Starts solving this model in background thread and returns immediately.
+	 *
+	 * @details Solve works exactly as solve(const SolveOptions&) and it can be cancelled through returned handle.
+	 * Model must not be changed or read until solve finishes (@see SolveHandle::isDone()) - other
+	 * Solver instances can be freely used meanwhile, e.g. to build model of the next request.
+	 * Next call of solve() or solveAsync() and destructor wait for running solve
+	 * (destructor cancels it first).
+	 *
+	 * Example:
+	 * @code
+	 * 	SolveOptions options { };
+	 * 	options.timeLimit = 60;
+	 * 	options.progressCallback = [](const SolveProgress& progress) {
+	 * 		std::cout << progress.numberOfIterations << ": " << progress.objectiveValue << std::endl;
+	 * 	};
+	 * 	SolveHandle handle = s.solveAsync(options);
+	 * 	Solver next(SolverInterface::CLP);
+	 * 	// ... build model of the next request
+	 * 	if (handle.get() == SolveStatus::OPTIMAL) {
+	 * 		// ... read solution of s
+	 * 	}
+	 * @endcode
+	 *
+	 * @param options
+	 * @return handle of started solve
+	 */
+	SolveHandle solveAsync(const SolveOptions& options = SolveOptions());
+
+	/** @brief Saves basis of the last solution into given file (@see Basis).
+	 *
+	 * @param fileName
+	 *
+	 * @throw ModelExceptions::BasisFileException will be thrown in case file cannot be written.
+	 */
+	void saveBasis(const std::string& fileName) const
+			throw (ModelExceptions::BasisFileException);
+
+	/** @brief Loads basis from given file - the next solve starts from it (@see setBasis()).
+	 *
+	 * @param fileName
+	 *
+	 * @throw ModelExceptions::BasisFileException will be thrown in case file cannot be read
+	 * or it is not a valid basis file.
+	 */
+	void loadBasis(const std::string& fileName)
+			throw (ModelExceptions::BasisFileException);
+
+	/** @brief Writes this model into free MPS or CPLEX LP file.
+	 *
+	 * @details Model is streamed straight from arrays of this model (@see ModelWriter) - it does not have to be
+	 * loaded into the solver and memory used by writer does not depend on size of model. Names of columns and rows
+	 * are generated from names and dimensions of their groups, e.g. "x[2][3]" (MPS) or "x(2)(3)" (LP).
+	 *
+	 * Example:
+	 * @code
+	 * 	s.writeModel("/tmp/model.mps");
+	 * 	s.writeModel("/tmp/model.lp.gz", ModelFormat::LP, true);
+	 * @endcode
+	 *
+	 * @param fileName
+	 * @param format
+	 * @param compressed if true file is compressed by gzip
+	 *
+	 * @throw ModelExceptions::ModelFileException will be thrown in case file cannot be written.
+	 */
+	void writeModel(const std::string& fileName, const ModelFormat format =
+			ModelFormat::MPS, const bool compressed = false)
+					throw (ModelExceptions::ModelFileException);
+
+	/** @brief Reads model from free MPS or CPLEX LP file (also gzip-compressed) and adds it to this model.
+	 *
+	 * @details File is mapped into memory and its sections are parsed in parallel (@see ModelReader). Names
+	 * of columns and rows are folded back into groups with inferred extents, e.g. columns "x[1][1]", ..., "x[3][4]"
+	 * become group of variables "x[3][4]" - so model written by writeModel() is reopened with the same groups.
+	 * Coefficients are loaded in bulk, like the ones of generateRows().
+	 *
+	 * Example:
+	 * @code
+	 * 	s.readModel("/tmp/model.mps");
+	 * 	s.getVariable("x[2][3]");
+	 * @endcode
+	 *
+	 * @param fileName
+	 * @param format
+	 * @param numberOfThreads number of parsing threads (0 - number of hardware threads)
+	 *
+	 * @throw ModelExceptions::ModelFileException will be thrown in case file cannot be read or it is not a valid model file.
+	 * @throw VariableModelExceptions::DuplicateException will be thrown in case model already has group of variables of file.
+	 * @throw RowModelExceptions::DuplicateException will be thrown in case model already has group of rows of file.
+	 */
+	void readModel(const std::string& fileName, const ModelFormat format =
+			ModelFormat::MPS, const unsigned int numberOfThreads = 0)
+					throw (ModelExceptions::ModelFileException,
+					VariableModelExceptions::DuplicateException,
+					RowModelExceptions::DuplicateException);
+
+	/** @brief Saves snapshot of the whole model into binary file (@see ModelSnapshot).
+	 *
+	 * @details Snapshot holds groups of variables, rows and parameters, bounds, types, values and objective
+	 * coefficients of columns, bounds of rows, values of parameters and coefficients of rows (in compressed
+	 * column-major form). Existing file is replaced only when snapshot has been written completely.
+	 * Basis is not part of snapshot (@see saveBasis()).
+	 *
+	 * @param fileName
+	 *
+	 * @throw ModelExceptions::SnapshotFileException will be thrown in case file cannot be written.
+	 */
+	void saveSnapshot(const std::string& fileName)
+			throw (ModelExceptions::SnapshotFileException);
+
+	/** @brief Loads snapshot saved by saveSnapshot() into this (empty) model.
+	 *
+	 * @details Snapshot is not parsed: file is mapped into memory and its arrays are copied straight
+	 * into the model, so even large models are ready in a fraction of time needed by readModel()
+	 * or by generating rows again.
+	 *
+	 * Example:
+	 * @code
+	 * 	Solver s(SolverInterface::CLP);
+	 * 	// ... build model
+	 * 	s.saveSnapshot("/data/model.snapshot");
+	 *
+	 * 	Solver t(SolverInterface::CLP);
+	 * 	t.loadSnapshot("/data/model.snapshot");
+	 * 	t.solve();
+	 * @endcode
+	 *
+	 * @param fileName
+	 * @param numberOfThreads number of threads that load coefficients (0 - number of hardware threads)
+	 *
+	 * @throw ModelExceptions::SnapshotFileException will be thrown in case file cannot be read, it is not a valid
+	 * snapshot file or this model is not empty.
+	 */
+	void loadSnapshot(const std::string& fileName,
+			const unsigned int numberOfThreads = 0)
+					throw (ModelExceptions::SnapshotFileException);
+
+	/** @brief Solves many variants (scenarios) of this model in parallel.
+	 *
+	 * @details Model is loaded into the solver first (@see loadProblem()), then every worker thread
+	 * solves scenarios on its own copy of the loaded problem - it applies changes of scenario,
+	 * reoptimizes from basis of its previous scenario and reverts changes (@see OsiProblemInstance::solveScenarios()).
+	 * Model itself is not changed. Scenarios change columns and rows that presolve might remove,
+	 * so model is always loaded without reductions (@see setPresolveEnabled()).
+	 *
+	 * Example:
+	 * @code
+	 * 	Solver s(SolverInterface::CLP);
+	 * 	// ... build model with group of rows "demand[10]"
+	 * 	RowGroup<1> demand = s.rowGroup<1>("demand");
+	 * 	std::vector<Scenario> scenarios(1000);
+	 * 	for (size_t k = 0; k < scenarios.size(); k += 1) {
+	 * 		scenarios[k].setRowBounds(demand.getRowIdx(3), 10 + k, Utils::getUnbounded(UPPER));
+	 * 	}
+	 * 	std::vector<ScenarioResult> results = s.solveScenarios(scenarios);	// results[k] belongs to scenarios[k]
+	 * @endcode
+	 *
+	 * @param scenarios
+	 * @param numberOfThreads number of workers (0 means number of hardware threads)
+	 * @return results in order of given scenarios
+	 *
+	 * @throw ModelExceptions::InvalidScenarioException if any scenario refers to column or row that does not exist.
+	 * Exception of the solver (e.g. CoinError) thrown while any scenario is solved is rethrown
+	 * after all workers finish (@see OsiProblemInstance::solveScenarios()).
+	 */
+	std::vector<ScenarioResult> solveScenarios(
+			const std::vector<Scenario>& scenarios,
+			const unsigned int numberOfThreads = 0);
+
+	/** @brief Returns read-only view of values of given group of variables in the last solution.
+	 *
+	 * @details Nothing is copied - view refers directly to array of the solver at the first column of group
+	 * (@see SolutionView), so it is valid only until model is changed or solved again. View over snapshot
+	 * (@see getSolution()) stays valid as long as snapshot exists.
+	 *
+	 * Example:
+	 * @code
+	 * 	s.solve();
+	 * 	SolutionView<2> x = s.values<2>("x");
+	 * 	VarValue flow = x(3, 7);			// value of "x[3][7]"
+	 *
+	 * 	Solution base = s.getSolution();	// keep solution of base model
+	 * 	s.getVariable("x[3][7]").setObjectiveCoefficient(5);
+	 * 	s.solve();
+	 * 	VarValue change = s.values<2>("x")(3, 7) - s.values<2>("x", &base)(3, 7);
+	 * @endcode
+	 *
+	 * @param groupOfVariablesName base name of N-dimensional group of variables
+	 * @param solution snapshot to read from (nullptr means the last solution of the solver)
+	 * @return
+	 *
+	 * @throw VariableModelExceptions::NoSuchGroupException if there is no such a group of variables with given name.
+	 * @throw VariableModelExceptions::InvalidNumberOfDimensionIndexesException if group of variables
+	 * does not have N dimensions.
+	 * @throw ModelExceptions::NoSolutionException if solution is not available.
+	 */
+	template<VarDimIdx N>
+	SolutionView<N> values(const std::string& groupOfVariablesName,
+			const Solution* solution = nullptr)
+					throw (VariableModelExceptions::NoSuchGroupException,
+					VariableModelExceptions::InvalidNumberOfDimensionIndexesException,
+					ModelExceptions::NoSolutionException) {
+		const VarDimensionTable* dimensions { };
+		const VarValue* values { getVariableSolution(groupOfVariablesName, N,
+				Solution::Part::COLUMN_VALUES, solution, dimensions) };
+		return SolutionView<N> { values, *dimensions };
+	}
+
+	/** @brief Returns read-only view of reduced costs of given group of variables in the last solution.
+	 *
+	 * @see values()
+	 *
+	 * @param groupOfVariablesName base name of N-dimensional group of variables
+	 * @param solution snapshot to read from (nullptr means the last solution of the solver)
+	 * @return
+	 *
+	 * @throw VariableModelExceptions::NoSuchGroupException if there is no such a group of variables with given name.
+	 * @throw VariableModelExceptions::InvalidNumberOfDimensionIndexesException if group of variables
+	 * does not have N dimensions.
+	 * @throw ModelExceptions::NoSolutionException if reduced costs are not available.
+	 */
+	template<VarDimIdx N>
+	SolutionView<N> reducedCosts(const std::string& groupOfVariablesName,
+			const Solution* solution = nullptr)
+					throw (VariableModelExceptions::NoSuchGroupException,
+					VariableModelExceptions::InvalidNumberOfDimensionIndexesException,
+					ModelExceptions::NoSolutionException) {
+		const VarDimensionTable* dimensions { };
+		const VarValue* values { getVariableSolution(groupOfVariablesName, N,
+				Solution::Part::REDUCED_COSTS, solution, dimensions) };
+		return SolutionView<N> { values, *dimensions };
+	}
+
+	/** @brief Returns read-only view of dual values of given group of rows in the last solution.
+	 *
+	 * @see values()
+	 *
+	 * @param groupOfRowsName base name of N-dimensional group of rows
+	 * @param solution snapshot to read from (nullptr means the last solution of the solver)
+	 * @return
+	 *
+	 * @throw RowModelExceptions::NoSuchGroupException if there is no such a group of rows with given name.
+	 * @throw RowModelExceptions::InvalidNumberOfDimensionIndexesException if group of rows
+	 * does not have N dimensions.
+	 * @throw ModelExceptions::NoSolutionException if dual values are not available.
+	 */
+	template<RowDimIdx N>
+	SolutionView<N> rowPrices(const std::string& groupOfRowsName,
+			const Solution* solution = nullptr)
+					throw (RowModelExceptions::NoSuchGroupException,
+					RowModelExceptions::InvalidNumberOfDimensionIndexesException,
+					ModelExceptions::NoSolutionException) {
+		const RowDimensionTable* dimensions { };
+		const VarValue* values { getRowSolution(groupOfRowsName, N, solution,
+				dimensions) };
+		return SolutionView<N> { values, *dimensions };
+	}
+
 	//*************************************** GETTERS & SETTERS ****************************************//
 
+	/** @brief Sets names policy of every group of variables in this model (both existing and new ones).
+	 *
+	 * @details By default names are generated on every request and never kept in memory
+	 * (NamesPolicy::GENERATE_NAMES). For models with few names that are requested many times
+	 * (e.g. in logs) it may be desirable to keep them:
+	 *
+	 * @code
+	 * Solver s(SolverInterface::GLPK);
+	 * s.setNamesPolicy(NamesPolicy::CACHE_NAMES);	// requested names are kept by their groups
+	 * s.newVariable("x[20][10]");
+	 * @endcode
+	 *
+	 * @param namesPolicy
+	 */
+	void setNamesPolicy(const NamesPolicy namesPolicy);
+
+	/** @brief Returns names policy of this model.
+	 *
+	 * @return
+	 */
+	NamesPolicy getNamesPolicy() const;
+
+	/** @brief Enables or disables presolve of this model before it is passed to the solver (disabled by default).
+	 *
+	 * @details Presolve removes fixed variables (moving them into bounds of rows), empty, redundant and duplicate rows,
+	 * turns rows with single coefficient into bounds of their variables and tightens bounds of variables
+	 * by activities of rows (@see Presolve). Solution is mapped back onto groups of the whole model,
+	 * so it is read exactly as without presolve. Reduced model cannot be changed by the solver,
+	 * so every solve presolves and loads the whole model once again (without warm start from basis).
+	 *
+	 * @code
+	 * Solver s(SolverInterface::CLP);
+	 * s.setPresolveEnabled(true);
+	 * // ... build model
+	 * s.solve();
+	 * VarValue x = s.values<2>("x")(2, 3);	// value of "x[2][3]" even if presolve has removed it
+	 * @endcode
+	 *
+	 * @param presolveEnabled
+	 */
+	void setPresolveEnabled(const bool presolveEnabled);
+
+	/** @brief Returns true if model is presolved before it is passed to the solver.
+	 *
+	 * @return
+	 */
+	bool isPresolveEnabled() const;
+
+	/** @brief Returns solver engine chosen for this model (@see Solver(SolverInterface)).
+	 *
+	 * @return
+	 */
+	SolverInterface getSolverInterface() const;
+
+	/** @brief Returns basis of the last solution (empty if model has not been solved yet).
+	 *
+	 * @return
+	 */
+	const Basis& getBasis() const;
+
+	/** @brief Sets basis that the next solve starts from.
+	 *
+	 * @details Basis is matched with groups of this model by their names and indexes, so it may come
+	 * from another model (@see Basis). Columns and rows that are not present in basis start
+	 * as nonbasic at lower bound and basic respectively.
+	 *
+	 * @param basis
+	 */
+	void setBasis(const Basis& basis);
+
+	/** @brief Returns value of objective function of the last solution.
+	 *
+	 * @return
+	 */
+	VarValue getObjectiveValue() const;
+
+	/** @brief Returns copy of the last solution (values, reduced costs and dual values of every column and row).
+	 *
+	 * @details Snapshot is a single bulk copy of arrays of the solver - it remains valid after model is changed
+	 * or solved again and views of its groups can be obtained the same way as views of the last solution
+	 * (@see values()).
+	 *
+	 * @return
+	 */
+	Solution getSolution() const;
+
 	/** @brief Return number of variables in this model.
 	 *
 	 * @return number of variables in this model
 	 */
 	VarIdx getNumberOfVariables() const;
 
+	/** @brief Return number of rows in this model.
+	 *
+	 * @return number of rows in this model
+	 */
+	RowIdx getNumberOfRows() const;
+
 };
 
 #endif /* SOLVER_HPP_ */
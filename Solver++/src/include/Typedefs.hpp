@@ -23,17 +23,53 @@ typedef unsigned int RowDimIdx;
 
 typedef std::pair<VarValue, VarValue> VarBounds;
 
-/**
- * Test doc
+/** Solver engines that can be used by Solver (@see Solver::Solver(SolverInterface)).
+ *
+ * Model is built the same way regardless of chosen engine, so the same model can be solved
+ * by each of them (e.g. to compare their performance).
+ *
  */
 enum SolverInterface {
-	GLPK //!< GLPK
+	GLPK, //!< GLPK (OsiGlpkSolverInterface)
+	CLP, //!< COIN-OR Clp simplex for LP problems (OsiClpSolverInterface)
+	CBC //!< COIN-OR Cbc branch and cut for MIP problems, uses Clp for LP relaxations (OsiCbcSolverInterface)
+};
+
+/** Status of solution of LP/MIP problem reported by solver engine.
+ *
+ */
+enum SolveStatus {
+	OPTIMAL, //!< optimal solution was found
+	PRIMAL_INFEASIBLE, //!< problem has no feasible solution
+	DUAL_INFEASIBLE, //!< problem is unbounded (or dual infeasible)
+	LIMIT_REACHED, //!< solver stopped on iteration or time limit
+	ABANDONED, //!< solver gave up (e.g. numerical difficulties)
+	CANCELLED //!< solve was cancelled by user (@see SolveHandle::cancel())
+};
+
+/** Text formats of model files (@see Solver::writeModel(), Solver::readModel()).
+ *
+ */
+enum ModelFormat {
+	MPS, //!< free MPS (names cannot contain spaces, every section is written in fixed order)
+	LP //!< CPLEX LP (brackets of names are written as parentheses, e.g. "x(2)(3)")
 };
 
 enum Bounds {
 	LOWER, UPPER
 };
 
+/** Defines what happens with full names of variables (e.g. "x[2][3]") after they are generated.
+ *
+ * Names are never created together with variables - they are generated from group name
+ * and index of variable in group only when someone asks for them (logging, exceptions, model export).
+ *
+ */
+enum NamesPolicy {
+	CACHE_NAMES, //!< generated name is kept by group of variables for subsequent requests
+	GENERATE_NAMES //!< name is generated on every request and never kept in memory (default)
+};
+
 /** Test doc
  *
  */
@@ -0,0 +1,441 @@
+/*
+ * VarGroup.hpp
+ *
+ *  Created on: 17 paź 2026
+ *      Author: tomasz
+ */
+
+#ifndef VARGROUP_HPP_
+#define VARGROUP_HPP_
+
+#include <stddef.h>
+
+#include "BoundsReport.hpp"
+#include "DimensionTable.hpp"
+#include "exp/VariableModelExeptions.hpp"
+#include "ParamGroup.hpp"
+#include "Typedefs.hpp"
+#include "utils/MapperUtils.hpp"
+#include "Variable.hpp"
+#include "VariableIdxMapper.hpp"
+
+/** @brief Prepared handle of N-dimensional group of variables.
+ *
+ * @details Handle is obtained once by name (@see Solver::group()) and then gives access to every variable
+ * of that group without parsing any definition, hashing group name or reading variadic arguments.
+ * Number of indexes is checked at compile time, so the only work done by every access is bounds check
+ * and stride arithmetic on extents and strides copied into the handle.
+ *
+ * Handle does not own any data and it stays valid as long as group of variables that it refers to exists.
+ *
+ * Example:
+ * @code
+ * 	Solver s(SolverInterface::GLPK);
+ * 	s.newVariable("x[100][20][5]");
+ * 	VarGroup<3> x = s.group<3>("x");
+ *
+ * 	for (VarDimIdx i = 1; i <= 100; i += 1) {
+ * 		for (VarDimIdx j = 1; j <= 20; j += 1) {
+ * 			for (VarDimIdx k = 1; k <= 5; k += 1) {
+ * 				x(i, j, k).setObjectiveCoefficient(1);	// the same as s.getVariable("x[i][j][k]")
+ * 			}
+ * 		}
+ * 	}
+ *
+ * 	x(1, 2);		// will not compile
+ * 	x(101, 1, 1);	// will throw VariableModelExceptions::IndexOutOfBoundException
+ * @endcode
+ *
+ * Bounds and fixed values of the whole group or of its slice (one range of indexes for every dimension,
+ * @see range()) are changed at once - every variable is checked first and batch is applied either to all
+ * of its variables or to none of them, so nothing is thrown halfway (@see BoundsReport):
+ * @code
+ * 	s.newVariable("y[50][12]", 0, 100, ValueType::DOUBLE);
+ * 	s.newParameter("minimum[50][12]");
+ * 	s.newParameter("capacity[50][12]");
+ * 	VarGroup<2> y = s.group<2>("y");
+ *
+ * 	y.fix({ y.getRange(0), range(3, 3) }, 0);								// y[*][3] = 0
+ * 	y.setBounds(s.paramGroup<2>("minimum"), s.paramGroup<2>("capacity"));	// bounds of every y[i][t]
+ * 	BoundsReport report = y.setBounds({ range(1, 10), range(1, 6) }, 0, 50);
+ * 	if (!report.isApplied()) {
+ * 		...																// report.failures
+ * 	}
+ * 	y.relax();	// releases every fixed value of group
+ * @endcode
+ *
+ * Changes are recorded by problem instance and only changed columns are passed to the solver
+ * by the next load (@see OsiProblemInstance::updateProblem()).
+ *
+ */
+template<VarDimIdx N>
+class VarGroup {
+
+	friend class Solver;
+
+	static_assert(N <= MAX_NUMBER_OF_DIMENSIONS,
+			"Group of variables cannot have more than MAX_NUMBER_OF_DIMENSIONS dimensions.");
+
+private:
+
+	//************************************ PRIVATE CONSTANT FIELDS *************************************//
+
+	/** @brief Size of #extents and #strides arrays and of arrays of ranges (arrays of size 0 are not allowed,
+	 * so slice of group without dimensions is given by single unused range, e.g. y.fix({ }, 0)).
+	 *
+	 */
+	const static VarDimIdx ARRAYS_SIZE { N == 0 ? 1 : N };
+
+	//****************************************** CLASS TYPES *******************************************//
+
+	/** @brief Ranges of every index of every dimension of this group (@see getRanges()).
+	 *
+	 */
+	struct Ranges {
+		IndexRange ranges[ARRAYS_SIZE];
+	};
+
+	//***************************************** CLASS FIELDS *******************************************//
+
+	/** @brief Problem instance that stores columns of this group.
+	 *
+	 */
+	OsiProblemInstance* problemInstance;
+
+	/** @brief Group of variables to which this handle refers.
+	 *
+	 */
+	const VariableIdxMapper* variableGroup;
+
+	/** @brief Index of column of the first variable of this group (@see VariableIdxMapper::getBeginIdx()).
+	 *
+	 */
+	VarIdx beginIdx;
+
+	/** @brief Copy of sizes of dimensions of this group.
+	 *
+	 */
+	VarDimIdx extents[ARRAYS_SIZE];
+
+	/** @brief Copy of strides of dimensions of this group (@see DimensionTable).
+	 *
+	 */
+	VarIdx strides[ARRAYS_SIZE];
+
+	//*************************************** PRIVATE FUNCTIONS ****************************************//
+
+	/** @brief Returns ranges of every index of every dimension of this group.
+	 *
+	 * @return
+	 */
+	Ranges getRanges() const {
+		Ranges ranges { };
+		for (VarDimIdx i = 0; i < N; i += 1) {
+			ranges.ranges[i] = getRange(i);
+		}
+		return ranges;
+	}
+
+	/** @brief Logs and throws exception for indexes that do not refer to any variable in this group.
+	 *
+	 * @details Kept out of linearize() so the common path contains only arithmetic.
+	 *
+	 * @param indexes list of N indexes
+	 */
+	void throwIndexOutOfBounds(const VarDimIdx* indexes) const
+			throw (VariableModelExceptions::IndexOutOfBoundException) {
+		VarIndexTuple dimensions { };
+		for (VarDimIdx i = 0; i < N; i += 1) {
+			dimensions.push_back(indexes[i]);
+		}
+		MapUtils::ifDimensionsOutOfBounds<VarIdx, VarDimIdx>(
+				this->variableGroup->getDimensions(), dimensions);
+		throw VariableModelExceptions::IndexOutOfBoundException();
+	}
+
+	/** @brief Returns index of column of variable with given (1-based) indexes.
+	 *
+	 * @param indexes list of N indexes
+	 * @return
+	 *
+	 * @throw VariableModelExceptions::IndexOutOfBoundException if any index is 0 or exceeds size of its dimension.
+	 */
+	VarIdx linearize(const VarDimIdx* indexes) const
+			throw (VariableModelExceptions::IndexOutOfBoundException) {
+		VarIdx idx { this->beginIdx };
+		for (VarDimIdx i = 0; i < N; i += 1) {
+			if (indexes[i] == 0 || indexes[i] > this->extents[i]) {
+				throwIndexOutOfBounds(indexes);
+			}
+			idx += (indexes[i] - 1) * this->strides[i];
+		}
+		return idx;
+	}
+
+	//************************************ CONSTRUCTOR & DESTRUCTOR ************************************//
+
+	/** @brief Creates handle of given group of variables.
+	 *
+	 * @details Handles are created by Solver::group() which checks if given group has N dimensions.
+	 *
+	 * @param variableGroup
+	 */
+	explicit VarGroup(const VariableIdxMapper* variableGroup) :
+			problemInstance(variableGroup->getProblemInstance()), variableGroup(
+					variableGroup), beginIdx(variableGroup->getBeginIdx()) {
+		for (VarDimIdx i = 0; i < N; i += 1) {
+			this->extents[i] = variableGroup->getDimensions().getExtent(i);
+			this->strides[i] = variableGroup->getDimensions().getStride(i);
+		}
+	}
+
+public:
+
+	//************************************* PUBLIC CONSTANT FIELDS *************************************//
+
+	//*************************************** PUBLIC FUNCTIONS *****************************************//
+
+	/** @brief Returns a view of variable with given (1-based) indexes.
+	 *
+	 * @param indexes exactly N indexes, from the highest dimension to the lowest
+	 * @return
+	 *
+	 * @throw VariableModelExceptions::IndexOutOfBoundException if any index is 0 or exceeds size of its dimension.
+	 */
+	template<typename ... Indexes>
+	Variable operator()(const Indexes ... indexes) const
+			throw (VariableModelExceptions::IndexOutOfBoundException) {
+		return Variable { this->problemInstance, this->variableGroup,
+				getColumnIdx(indexes...) };
+	}
+
+	/** @brief Returns index of column of variable with given (1-based) indexes.
+	 *
+	 * @details Cheapest way of referring to variable, e.g. while filling coefficients of rows.
+	 *
+	 * @param indexes exactly N indexes, from the highest dimension to the lowest
+	 * @return
+	 *
+	 * @throw VariableModelExceptions::IndexOutOfBoundException if any index is 0 or exceeds size of its dimension.
+	 */
+	template<typename ... Indexes>
+	VarIdx getColumnIdx(const Indexes ... indexes) const
+			throw (VariableModelExceptions::IndexOutOfBoundException) {
+		static_assert(sizeof...(Indexes) == N,
+				"Number of indexes has to be equal to number of dimensions of group of variables.");
+		const VarDimIdx indexesArray[ARRAYS_SIZE] = {
+				static_cast<VarDimIdx>(indexes)... };
+		return linearize(indexesArray);
+	}
+
+	/** @brief Returns number of variables of this group with indexes in given ranges.
+	 *
+	 * @param ranges N ranges, from the highest dimension to the lowest
+	 * @return
+	 *
+	 * @throw VariableModelExceptions::IndexOutOfBoundException if any non-empty range contains 0
+	 * or exceeds size of its dimension.
+	 */
+	size_t getNumberOfVariables(const IndexRange* ranges) const
+			throw (VariableModelExceptions::IndexOutOfBoundException) {
+		size_t numberOfVariables { 1 };
+		for (VarDimIdx i = 0; i < N; i += 1) {
+			if (ranges[i].size() == 0) {
+				return 0;
+			}
+		}
+		for (VarDimIdx i = 0; i < N; i += 1) {
+			if (ranges[i].first == 0 || ranges[i].last > this->extents[i]) {
+				VarDimIdx indexes[ARRAYS_SIZE] { };
+				for (VarDimIdx j = 0; j < N; j += 1) {
+					indexes[j] = j != i ? ranges[j].first :
+							ranges[i].first == 0 ? 0 : ranges[i].last;
+				}
+				throwIndexOutOfBounds(indexes);
+			}
+			numberOfVariables *= ranges[i].size();
+		}
+		return numberOfVariables;
+	}
+
+	/** @brief Fixes every variable of given slice of this group at given value.
+	 *
+	 * @see VariableIdxMapper::fixValues()
+	 *
+	 * @param ranges N ranges of indexes, from the highest dimension to the lowest (@see range())
+	 * @param value
+	 * @return
+	 *
+	 * @throw VariableModelExceptions::IndexOutOfBoundException if any non-empty range contains 0
+	 * or exceeds size of its dimension.
+	 */
+	BoundsReport fix(const IndexRange (&ranges)[ARRAYS_SIZE], const VarValue value) const
+			throw (VariableModelExceptions::IndexOutOfBoundException) {
+		getNumberOfVariables(ranges);
+		return this->variableGroup->fixValues(ranges, value);
+	}
+
+	/** @brief Fixes every variable of given slice of this group at value of parameter with the same indexes.
+	 *
+	 * @see VariableIdxMapper::fixValues()
+	 *
+	 * @param ranges N ranges of indexes, from the highest dimension to the lowest (@see range())
+	 * @param values group of parameters with the same dimensions as this group
+	 * @return
+	 *
+	 * @throw VariableModelExceptions::IndexOutOfBoundException if any non-empty range contains 0
+	 * or exceeds size of its dimension.
+	 * @throw VariableModelExceptions::DifferentDimensionsException if group of parameters has different dimensions.
+	 */
+	BoundsReport fix(const IndexRange (&ranges)[ARRAYS_SIZE],
+			const ParamGroup<N>& values) const
+					throw (VariableModelExceptions::IndexOutOfBoundException,
+					VariableModelExceptions::DifferentDimensionsException) {
+		getNumberOfVariables(ranges);
+		return this->variableGroup->fixValues(ranges,
+				values.getParameterGroup());
+	}
+
+	/** @brief Fixes every variable of this group at given value.
+	 *
+	 * @param value
+	 * @return
+	 */
+	BoundsReport fix(const VarValue value) const {
+		return this->variableGroup->fixValues(getRanges().ranges, value);
+	}
+
+	/** @brief Fixes every variable of this group at value of parameter with the same indexes.
+	 *
+	 * @param values group of parameters with the same dimensions as this group
+	 * @return
+	 *
+	 * @throw VariableModelExceptions::DifferentDimensionsException if group of parameters has different dimensions.
+	 */
+	BoundsReport fix(const ParamGroup<N>& values) const
+			throw (VariableModelExceptions::DifferentDimensionsException) {
+		return this->variableGroup->fixValues(getRanges().ranges,
+				values.getParameterGroup());
+	}
+
+	/** @brief Sets the same bounds of every variable of given slice of this group.
+	 *
+	 * @see VariableIdxMapper::setBounds()
+	 *
+	 * @param ranges N ranges of indexes, from the highest dimension to the lowest (@see range())
+	 * @param lowerBound
+	 * @param upperBound
+	 * @return
+	 *
+	 * @throw VariableModelExceptions::IndexOutOfBoundException if any non-empty range contains 0
+	 * or exceeds size of its dimension.
+	 */
+	BoundsReport setBounds(const IndexRange (&ranges)[ARRAYS_SIZE],
+			const VarValue lowerBound, const VarValue upperBound) const
+					throw (VariableModelExceptions::IndexOutOfBoundException) {
+		getNumberOfVariables(ranges);
+		return this->variableGroup->setBounds(ranges, lowerBound, upperBound);
+	}
+
+	/** @brief Sets bounds of every variable of given slice of this group to values of parameters with the same indexes.
+	 *
+	 * @see VariableIdxMapper::setBounds()
+	 *
+	 * @param ranges N ranges of indexes, from the highest dimension to the lowest (@see range())
+	 * @param lowerBounds group of parameters with the same dimensions as this group
+	 * @param upperBounds group of parameters with the same dimensions as this group
+	 * @return
+	 *
+	 * @throw VariableModelExceptions::IndexOutOfBoundException if any non-empty range contains 0
+	 * or exceeds size of its dimension.
+	 * @throw VariableModelExceptions::DifferentDimensionsException if any group of parameters has different dimensions.
+	 */
+	BoundsReport setBounds(const IndexRange (&ranges)[ARRAYS_SIZE],
+			const ParamGroup<N>& lowerBounds,
+			const ParamGroup<N>& upperBounds) const
+					throw (VariableModelExceptions::IndexOutOfBoundException,
+					VariableModelExceptions::DifferentDimensionsException) {
+		getNumberOfVariables(ranges);
+		return this->variableGroup->setBounds(ranges,
+				lowerBounds.getParameterGroup(),
+				upperBounds.getParameterGroup());
+	}
+
+	/** @brief Sets the same bounds of every variable of this group.
+	 *
+	 * @param lowerBound
+	 * @param upperBound
+	 * @return
+	 */
+	BoundsReport setBounds(const VarValue lowerBound,
+			const VarValue upperBound) const {
+		return this->variableGroup->setBounds(getRanges().ranges, lowerBound,
+				upperBound);
+	}
+
+	/** @brief Sets bounds of every variable of this group to values of parameters with the same indexes.
+	 *
+	 * @param lowerBounds group of parameters with the same dimensions as this group
+	 * @param upperBounds group of parameters with the same dimensions as this group
+	 * @return
+	 *
+	 * @throw VariableModelExceptions::DifferentDimensionsException if any group of parameters has different dimensions.
+	 */
+	BoundsReport setBounds(const ParamGroup<N>& lowerBounds,
+			const ParamGroup<N>& upperBounds) const
+					throw (VariableModelExceptions::DifferentDimensionsException) {
+		return this->variableGroup->setBounds(getRanges().ranges,
+				lowerBounds.getParameterGroup(),
+				upperBounds.getParameterGroup());
+	}
+
+	/** @brief Releases fixed values of every variable of given slice of this group.
+	 *
+	 * @param ranges N ranges of indexes, from the highest dimension to the lowest (@see range())
+	 *
+	 * @throw VariableModelExceptions::IndexOutOfBoundException if any non-empty range contains 0
+	 * or exceeds size of its dimension.
+	 */
+	void relax(const IndexRange (&ranges)[ARRAYS_SIZE]) const
+			throw (VariableModelExceptions::IndexOutOfBoundException) {
+		getNumberOfVariables(ranges);
+		this->variableGroup->relax(ranges);
+	}
+
+	/** @brief Releases fixed values of every variable of this group.
+	 *
+	 */
+	void relax() const {
+		this->variableGroup->relax(getRanges().ranges);
+	}
+
+	//*************************************** GETTERS & SETTERS ****************************************//
+
+	/** @brief Returns range of every index of given dimension.
+	 *
+	 * @param dimension
+	 * @return
+	 */
+	IndexRange getRange(const VarDimIdx dimension) const {
+		return IndexRange { 1, this->extents[dimension] };
+	}
+
+	VarIdx getBeginIdx() const {
+		return this->beginIdx;
+	}
+
+	VarIdx getNumberOfVariables() const {
+		return this->variableGroup->getNumberOfVariables();
+	}
+
+	VarDimIdx getExtent(const VarDimIdx dimension) const {
+		return this->extents[dimension];
+	}
+
+	const VariableIdxMapper* getVariableGroup() const {
+		return this->variableGroup;
+	}
+
+};
+
+#endif /* VARGROUP_HPP_ */
@@ -8,13 +8,17 @@
 #ifndef VARIABLE_HPP_
 #define VARIABLE_HPP_
 
-#include <list>
 #include <string>
-#include <unordered_map>
 
-#include "Solver.hpp"
+#include "exp/VariableModelExeptions.hpp"
 #include "Typedefs.hpp"
-#include "VariableIdxMapper.hpp"
+
+class OsiProblemInstance;
+
+class VariableIdxMapper;
+
+template<VarDimIdx N>
+class VarGroup;
 
 /** @brief Defines variable in LP/MIP optimization problem.
  *
@@ -24,6 +28,10 @@
  * Some of variable's properties are stored in @see VariableIdxMapper as each variable
  * is a part variable group with it's own, more general properties like variable type and name.
  *
+ * Variable does not own any data - it is a lightweight view into column arrays
+ * of problem instance (@see OsiProblemInstance) so it can be freely copied and passed by value.
+ * View stays valid as long as group of variables to which it belongs exists.
+ *
  * Example:
  * @code
  * 	This section adapted from Matt Galati's example
@@ -71,11 +79,10 @@
  */
 class Variable {
 
-	friend VariableIdxMapper::VariableIdxMapper(const VarIdx firstIdx,
-			const std::list<VarDimIdx>& dimensions,
-			const VarIdx numberOfVariables, const VarValue variableLowerBound,
-			const VarValue variableUpperBound, const ValueType type,
-			const std::string& groupName);
+	friend class VariableIdxMapper;
+
+	template<VarDimIdx N>
+	friend class VarGroup;
 
 private:
 
@@ -83,93 +90,43 @@ private:
 
 	//***************************************** CLASS FIELDS *******************************************//
 
-	/** @brief Lower bound of this variable.
+	/** @brief Problem instance that stores every property of this variable.
 	 *
-	 * @details Value of this variable cannot be less than it's LB (LB <= variable <= UB).
+	 * @details Lower and upper bound, objective coefficient, fixed flag and value of this variable
+	 * are stored in column arrays of problem instance (@see OsiProblemInstance) at #columnIdx index.
 	 *
 	 */
-	VarValue lowerBonud;
+	OsiProblemInstance* problemInstance;
 
-	/** @brief Upper bound of this variable.
-	 *
-	 * @details Value of this variable cannot be greater than it's LB (LB <= variable <= UB).
+	/** @brief Group of variables to which this variable belongs.
 	 *
 	 */
-	VarValue upperBound;
+	const VariableIdxMapper* variableGroup;
 
-	/** @brief Coefficient value corresponding to this variable in objective function.
-	 *
-	 * @details Variable's coefficient determinate how much influence value
-	 * of this variable has on final solution (objective function's value)
+	/** @brief Index of column that corresponds to this variable in problem instance.
 	 *
 	 */
-	VarValue objectiveCoefficient;
+	VarIdx columnIdx;
 
-	/** @brief Map of coefficients associated to this variable in given row.
-	 *
-	 * @details In general form of LP/MIP optimization problem every row's left-hand side expression
-	 * consists of every defined variable (some with coefficient equal to 0 if given variable
-	 * has no influence on particular row's expression) so variable has number
-	 * of coefficients equal to number of rows (and objective coefficient - @see objectiveCoefficient).
-	 *
-	 */
-	std::unordered_map<RowIdx, VarValue>* rowCoefficients;
+	//*************************************** PRIVATE FUNCTIONS ****************************************//
 
-	/** @brief Value of this variable.
-	 *
-	 * @details Value which this variable can take is bounded by it's lower and upper bound.
-	 *
-	 */
-	VarValue value;
+	bool isValueOutOfBounds(const VarValue value) const;
 
-	/** @brief True if fixValue() function was called.
-	 *
-	 * @details After declaration of variable there is possible to fix its value during solving LP/MIP problem.
-	 * It causes to ignore current lower and upper bounds of this variable
-	 * and pass current value of variable as bounds to OsiSolverInterface instead.
-	 *
-	 * If false then field value will be initialize
-	 * during solving LP/MIP problem (not during model creation by user).
-	 *
-	 * @see fixValue()
-	 *
-	 */
-	bool isFixed;
+	//************************************ CONSTRUCTOR & DESTRUCTOR ************************************//
 
-	/** @brief Stores actual variable full name.
-	 *
-	 * @details Full name of particular variable consists of is't base name (as it is a part of some bigger group of variables)
-	 * and list of indexes that creates a unique name for this variable.
-	 *
-	 * Examples:
-	 * @code
-	 * 	x - single variable named "x";
-	 * 	y[2]- two variables in group named "y";
-	 * 	z[3][4] - 12 variables organized in two-dimensional structure with name "z";
-	 * @endcode
+	/** @brief Creates a view of variable stored in given column of problem instance.
 	 *
+	 * @param problemInstance problem instance that stores properties of this variable
+	 * @param variableGroup group of variables to which this variable belongs
+	 * @param columnIdx index of column in problem instance
 	 */
-	std::string variableName;
-
-	//*************************************** PRIVATE FUNCTIONS ****************************************//
-
-	bool isValueOutOfBounds( const VarValue value);
+	Variable(OsiProblemInstance* problemInstance,
+			const VariableIdxMapper* variableGroup, const VarIdx columnIdx);
 
 	//************************************* PUBLIC CONSTANT FIELDS *************************************//
 
 public:
 
-	//************************************ CONSTRUCTOR & DESTRUCTOR ************************************//
-
-	/** @brief Creates new variable with given parameters.
-	 *
-	 * @param lowerBonud value of this variable cannot be less then this value
-	 * @param upperBound value of this variable cannot be greater then this value
-	 */
-	Variable(VarValue lowerBonud, VarValue upperBound);
-
-	virtual ~Variable();
-
 	//*************************************** PUBLIC FUNCTIONS *****************************************//
 
 
@@ -202,26 +159,22 @@ public:
 	 *  -10 <= x <= 10
 	 * @endcode
 	 *
+	 * Many variables are fixed at once by their group (@see VarGroup::fix()).
+	 *
 	 * @param fixedValue
 	 */
 	void fixValue(const VarValue& fixedValue);
 
 	/** @brief Redefine upper and lower bound of this variable.
 	 *
-	 * @details Allows to redefine bounds of this variable. If new bounds is incorrect for this variable's type
-	 * then type of variable will be extended to valid one:
+	 * @details Allows to redefine bounds of this variable. Type of variable is defined by its group,
+	 * so it is not changed by new bounds. Fixed value of fixed variable has to stay within new bounds.
 	 *
-	 * Examples:
+	 * Example:
 	 * @code
 	 *  Solver s(SolverInterface::GLPK);
-	 *  s.newVariable("x");	// ValueType::DOUBLE by default
-	 *  s.getVariable("x").setNewBounds(VarBounds(0,0));	// no change
-	 *
-	 *  s.newVariable("y",ValueType::INTEGER);
-	 *	s.getVariable("y").setNewBounds(VarBounds(0,3.5));	// will change type to ValueType::DOUBLE
-	 *
-	 *	s.newVariable("z",ValueType::BINARY);
-	 *	s.getVariable("z").setNewBounds(VarBounds(0,3));	// will change type to ValueType::INTEGER
+	 *  s.newVariable("x");
+	 *  s.getVariable("x").setNewBounds(VarBounds(0,0));
 	 * @endcode
 	 *
 	 * will result in creation of an unbounded variable 'x' which bounds are then adjust to 0, forcing inequalities 0 <= x <= 0 to hold.
@@ -235,12 +188,18 @@ public:
 	 *
 	 * @code
 	 *  Solver s(SolverInterface::GLPK);
-	 *  s.newVariable("x[2]", 0, 0, ValueType::DOUBLE);
+	 *  s.newVariable("x", 0, 0, ValueType::DOUBLE);
 	 * @endcode
 	 *
-	 * @param varBounds
+	 * Bounds of many variables are changed at once by their group (@see VarGroup::setBounds()).
+	 *
+	 * @param varBounds pair of lower and upper bound
+	 *
+	 * @throw VariableModelExceptions::InvalidBoundsException if lower bound is greater than upper bound
+	 * or fixed value of this variable is out of new bounds.
 	 */
-	void setNewBounds(const VarBounds& varBounds);
+	void setNewBounds(const VarBounds& varBounds)
+			throw (VariableModelExceptions::InvalidBoundsException);
 
 	/** @brief return string representation of this variable
 	 *
@@ -250,21 +209,27 @@ public:
 
 	//*************************************** GETTERS & SETTERS ****************************************//
 
-private:
+	VarValue getLowerBonud() const;
 
-	/** @brief s
-	 *
-	 * @param variableName
-	 */
-	void setVariableName(const std::string& variableName);
+	VarValue getUpperBound() const;
 
-public:
+	VarValue getObjectiveCoefficient() const;
 
-	VarValue getLowerBonud() const;
+	void setObjectiveCoefficient(const VarValue objectiveCoefficient);
 
-	VarValue getUpperBound() const;
+	bool isFixed() const;
 
-	const std::string& getVariableName() const;
+	VarValue getValue() const;
+
+	VarIdx getColumnIdx() const;
+
+	/** @brief Returns full name of this variable e.g. "x[2][3]".
+	 *
+	 * @details Name is generated on demand by group of variables (@see VariableIdxMapper::getVariableName()).
+	 *
+	 * @return
+	 */
+	std::string getVariableName() const;
 
 };
 
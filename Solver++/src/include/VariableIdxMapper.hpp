@@ -8,12 +8,21 @@
 #ifndef VARIABLEIDXMAPPER_HPP_
 #define VARIABLEIDXMAPPER_HPP_
 
-#include <list>
+#include <mutex>
 #include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
+#include "BoundsReport.hpp"
+#include "DimensionTable.hpp"
 #include "Solver.hpp"
 #include "Typedefs.hpp"
 
+class OsiProblemInstance;
+
+class ParamIdxMapper;
+
 class Variable;
 
 /** @brief Contains all informations about grouped variables.
@@ -35,13 +44,13 @@ class Variable;
  */
 class VariableIdxMapper {
 
-	friend Variable& Solver::getVariable(const std::string& variableDefinition)
+	friend Variable Solver::getVariable(const std::string& variableDefinition)
 			throw (std::out_of_range,
 					VariableModelExceptions::InvalidNumberOfDimensionIndexesException,
 					VariableModelExceptions::IndexOutOfBoundException,
 					VariableModelExceptions::InvalidGroupDefinitionException);
 
-	friend Variable& Solver::getVariable(const std::string& variableDefinition,
+	friend Variable Solver::getVariable(const std::string& variableDefinition,
 			VarDimIdx firstDimensionIndex, ...) throw (std::out_of_range,
 					VariableModelExceptions::InvalidNumberOfDimensionIndexesException,
 					VariableModelExceptions::IndexOutOfBoundException,
@@ -53,6 +62,14 @@ private:
 
 	//***************************************** CLASS FIELDS *******************************************//
 
+	/** @brief Problem instance that stores properties of every variable in this group.
+	 *
+	 * @details Group of variables owns no per-variable data but range of columns
+	 * [#beginIdx, #beginIdx + #numberOfVariables) in problem instance's column arrays.
+	 *
+	 */
+	OsiProblemInstance* problemInstance;
+
 	/** @brief Index of the first variable in array/matrix or more dimensional structure.
 	 *
 	 * @brief During extracting model, every group of variables will be joined into one array of variables
@@ -77,15 +94,16 @@ private:
 
 	/** @brief Every variable may have multiple dimensions.
 	 *
-	 * List contains naturally ordered dimensional indexes of that variable (from the highest dimension to the lowest).
-	 * If created variable is 0-dimensional structure then dimensions list will be empty.
+	 * Table contains naturally ordered sizes of dimensions of that variable (from the highest dimension to the lowest)
+	 * along with their strides. If created variable is 0-dimensional structure then table will have no dimensions.
 	 *
 	 * Example:
 	 *
-	 * 	For given group of variables "x[1][2][3]" dimensions list will contain elements: 1, 2 and 3.
+	 * 	For given group of variables "x[1][2][3]" dimensions table will contain extents: 1, 2 and 3
+	 * 	and strides: 6, 3 and 1.
 	 *
 	 */
-	std::list<VarDimIdx> dimensions;
+	VarDimensionTable dimensions;
 
 	/** @brief Number of variables in array/matrix or more dimensional structure.
 	 *
@@ -101,14 +119,29 @@ private:
 	 */
 	ValueType type;
 
-	/** @brief Array of mapped variables.
+	/** @brief Decides if names of variables in this group are kept after they have been generated.
 	 *
-	 * Calling the constructor will create numberOfVariables variables with given type and bounds.
-	 * Regardless of the number of dimensions in group of variables that was defined,
-	 * all of them will be linearized and assigned to the appropriate indexes in one-dimensional array.
+	 * @see NamesPolicy
+	 * @see Solver::setNamesPolicy()
 	 *
 	 */
-	Variable** variables;
+	NamesPolicy namesPolicy;
+
+	/** @brief Full names of variables that have been requested so far.
+	 *
+	 * Maps index of variable in this group to its full name.
+	 * Names are generated on demand (@see getVariableName()) so for groups which names are never requested
+	 * (no logging, no model export) this map stays empty. It exists only
+	 * if #namesPolicy is set to NamesPolicy::CACHE_NAMES (nullptr otherwise).
+	 *
+	 */
+	mutable std::unordered_map<VarIdx, std::string>* variableNames;
+
+	/** @brief Guards #variableNames, so names can be requested by many threads at once
+	 * (e.g. by workers of Solver::generateRows()).
+	 *
+	 */
+	mutable std::mutex variableNamesMutex;
 
 	/** @brief Stores actual name of this group of variables.
 	 *
@@ -117,13 +150,53 @@ private:
 
 	//*************************************** PRIVATE FUNCTIONS ****************************************//
 
-	/** Returns pointer to variable in 'this' group of variables with given indexes.
+	/** Returns view of variable in 'this' group of variables with given indexes.
 	 *
 	 * @param dimensions
-	 * @return pointer to variable with given index from variables array of pointers
-	 * where given index is calculated based on given list of dimensions and linearized afterwards.
+	 * @return view of variable stored in column #beginIdx + i of problem instance
+	 * where i is calculated based on given list of dimensions and linearized afterwards.
+	 */
+	Variable getVariable(const VarIndexTuple& dimensions) const;
+
+	/** Returns runs of consecutive columns of variables with indexes in given ranges.
+	 *
+	 * Indexes of the lowest dimension refer to consecutive columns, so there is one run for every combination
+	 * of indexes of the other dimensions (adjacent runs are joined, e.g. whole group is a single run).
+	 *
+	 * @param ranges one range for every dimension (checked before, @see VarGroup::getNumberOfVariables())
+	 * @param runs output list of pairs of the first column of run and number of its columns
 	 */
-	Variable& getVariable(const std::list<VarDimIdx>& dimensions);
+	void getRuns(const IndexRange* ranges,
+			std::vector<std::pair<VarIdx, VarIdx>>& runs) const;
+
+	/** Logs and throws exception if given group of parameters has different dimensions than this group.
+	 *
+	 * @param parameterGroup
+	 */
+	void checkDimensions(const ParamIdxMapper* parameterGroup) const
+			throw (VariableModelExceptions::DifferentDimensionsException);
+
+	/** Checks and sets bounds of variables with indexes in given ranges.
+	 *
+	 * @param ranges
+	 * @param lowerBounds lower bound of the first variable of this group
+	 * @param upperBounds upper bound of the first variable of this group
+	 * @param stride distance between bounds of consecutive variables (0 if all variables get the same bounds)
+	 * @return
+	 */
+	BoundsReport changeBounds(const IndexRange* ranges,
+			const VarValue* lowerBounds, const VarValue* upperBounds,
+			const size_t stride) const;
+
+	/** Checks and fixes values of variables with indexes in given ranges.
+	 *
+	 * @param ranges
+	 * @param values value of the first variable of this group
+	 * @param stride distance between values of consecutive variables (0 if all variables get the same value)
+	 * @return
+	 */
+	BoundsReport changeValues(const IndexRange* ranges, const VarValue* values,
+			const size_t stride) const;
 
 public:
 
@@ -133,34 +206,32 @@ public:
 
 	/** Creates variable group with given dimensions and type.
 	 *
-	 * Any group of variables is defined by string that matches regular expression (@see Solver::VAR_REGEX)
+	 * Any group of variables is defined by string that is a valid definition (@see StringUtils::parseDefinition())
 	 * and it consists of variable base name and array-like list of group's dimensions.
 	 *
 	 * Example:
 	 *
 	 * Solver::newVariable("x[3][4]", ValueType::DOUBLE) ->
-	 * VariableIdxMapper("x", beginIdx, {{3},{4}}, ValueType::DOUBLE)
+	 * VariableIdxMapper(problemInstance, beginIdx, {{3},{4}}, 12, ValueType::DOUBLE, "x")
 	 * will result in creating of group of 12 variables of default type (double).
-	 * Variables array will be filled with variables with given lower and upper bounds in given order:
+	 * Columns of problem instance starting from beginIdx will be mapped to variables in given order:
 	 * [x[1][1], x[1][2], x[1][3], ..., x[3][3], x[3][4]]
 	 *
-	 * BeginIdx will be calculated based on current number
-	 * of existing variables/columns (@see OsiProblemInstance::numberOfColumns).
+	 * Columns itself (with their bounds) have to be already added to the problem instance
+	 * (@see OsiProblemInstance::addNumberOfVariables()) which returns firstIdx of this group.
 	 *
-	 * @param firstIdx number of all existing variables increased by one, index of the first variable in this group
-	 * @param dimensions part of string-like variables' group declaration
-	 * @param numberOfVariables number of variables in this group
-	 * @param variableLowerBound lower bound of every variable in group
-	 * @param variableUpperBound upper bound of every variable in group
+	 * @param problemInstance problem instance that stores columns of this group
+	 * @param firstIdx index of the first variable (column) in this group
+	 * @param dimensions table of dimensions taken from string-like variables' group declaration
 	 * @param type type of all variables in this group
 	 * @param groupName name of group of variables
+	 * @param namesPolicy decides if generated names of variables will be kept
 	 *
 	 */
-	VariableIdxMapper(const VarIdx firstIdx,
-			const std::list<VarDimIdx>& dimensions,
-			const VarIdx numberOfVariables, const VarValue variableLowerBound,
-			const VarValue variableUpperBound, const ValueType type,
-			const std::string& groupName);
+	VariableIdxMapper(OsiProblemInstance* problemInstance,
+			const VarIdx firstIdx, const VarDimensionTable& dimensions,
+			const ValueType type,
+			const std::string& groupName, const NamesPolicy namesPolicy);
 
 	virtual ~VariableIdxMapper();
 
@@ -178,19 +249,131 @@ public:
 	 */
 	VarDimIdx getDimensionsSize();
 
+	/** Sets the same bounds of every variable with indexes in given ranges.
+	 *
+	 * Every variable is checked first (@see OsiProblemInstance::checkColumnBounds()), so bounds are set
+	 * either for all of them or (if bounds of any of them are rejected) for none of them.
+	 *
+	 * @param ranges one range for every dimension (checked before, @see VarGroup::getNumberOfVariables())
+	 * @param lowerBound
+	 * @param upperBound
+	 * @return
+	 */
+	BoundsReport setBounds(const IndexRange* ranges, const VarValue lowerBound,
+			const VarValue upperBound) const;
+
+	/** Sets bounds of every variable with indexes in given ranges to values of parameters with the same indexes.
+	 *
+	 * @see setBounds(const IndexRange*, const VarValue, const VarValue)
+	 *
+	 * @param ranges one range for every dimension (checked before, @see VarGroup::getNumberOfVariables())
+	 * @param lowerBounds group of parameters with the same dimensions as this group
+	 * @param upperBounds group of parameters with the same dimensions as this group
+	 * @return
+	 *
+	 * @throw VariableModelExceptions::DifferentDimensionsException if any group of parameters has different dimensions.
+	 */
+	BoundsReport setBounds(const IndexRange* ranges,
+			const ParamIdxMapper* lowerBounds,
+			const ParamIdxMapper* upperBounds) const
+					throw (VariableModelExceptions::DifferentDimensionsException);
+
+	/** Fixes every variable with indexes in given ranges at the same value.
+	 *
+	 * Every value is checked first (@see OsiProblemInstance::checkColumnValues()), so values are fixed
+	 * either for all variables or (if any value is out of bounds of its variable) for none of them.
+	 *
+	 * @param ranges one range for every dimension (checked before, @see VarGroup::getNumberOfVariables())
+	 * @param value
+	 * @return
+	 */
+	BoundsReport fixValues(const IndexRange* ranges,
+			const VarValue value) const;
+
+	/** Fixes every variable with indexes in given ranges at value of parameter with the same indexes.
+	 *
+	 * @see fixValues(const IndexRange*, const VarValue)
+	 *
+	 * @param ranges one range for every dimension (checked before, @see VarGroup::getNumberOfVariables())
+	 * @param values group of parameters with the same dimensions as this group
+	 * @return
+	 *
+	 * @throw VariableModelExceptions::DifferentDimensionsException if group of parameters has different dimensions.
+	 */
+	BoundsReport fixValues(const IndexRange* ranges,
+			const ParamIdxMapper* values) const
+					throw (VariableModelExceptions::DifferentDimensionsException);
+
+	/** Releases fixed values of every variable with indexes in given ranges.
+	 *
+	 * @param ranges one range for every dimension (checked before, @see VarGroup::getNumberOfVariables())
+	 */
+	void relax(const IndexRange* ranges) const;
+
 	//*************************************** GETTERS & SETTERS ****************************************//
 
+	/** Returns problem instance that stores columns of this group.
+	 *
+	 * @return
+	 */
+	OsiProblemInstance* getProblemInstance() const;
+
 	/** Returns value of beginIdx field.
 	 *
 	 * @return
 	 */
 	VarIdx getBeginIdx() const;
 
-	/** Returns dimensions list.
+	/** Moves this group to new range of columns starting from given index.
+	 *
+	 * Used when columns preceding this group are deleted from problem instance (@see OsiProblemInstance::deleteColumns()).
+	 *
+	 * @param beginIdx
+	 */
+	void setBeginIdx(const VarIdx beginIdx);
+
+	/** Returns number of variables in this group.
+	 *
+	 * @return
+	 */
+	VarIdx getNumberOfVariables() const;
+
+	/** Returns type of variables in this group.
+	 *
+	 * @return
+	 */
+	ValueType getType() const;
+
+	/** Returns full name of variable with given index in this group.
+	 *
+	 * Name is generated from #groupName and given index (@see MapUtils::getVariableName())
+	 * unless it has been already generated and kept (@see #namesPolicy). Function is thread-safe.
+	 *
+	 * @param idx index of variable in this group (0 for variable at #beginIdx column)
+	 * @return
+	 */
+	std::string getVariableName(const VarIdx idx) const;
+
+	/** Changes names policy of this group.
+	 *
+	 * Switching to NamesPolicy::GENERATE_NAMES releases every name kept so far.
+	 * Policy must not be changed while names are requested by other threads.
+	 *
+	 * @param namesPolicy
+	 */
+	void setNamesPolicy(const NamesPolicy namesPolicy);
+
+	/** Returns name of this group of variables.
+	 *
+	 * @return
+	 */
+	const std::string& getGroupName() const;
+
+	/** Returns dimensions table.
 	 *
 	 * @return
 	 */
-	const std::list<VarDimIdx>& getDimensions() const;
+	const VarDimensionTable& getDimensions() const;
 
 };
 
@@ -12,6 +12,60 @@
 
 namespace ModelExceptions {
 
+/** Will be thrown when scenario refers to column or row that does not exist in the model (@see Scenario).
+ *
+ */
+struct InvalidScenarioException: public std::exception {
+	const char* what() const throw () {
+		return "Scenario changes column or row that does not exist in the model.";
+	}
+};
+
+/** Will be thrown when basis file cannot be read or written (@see Basis).
+ *
+ */
+struct BasisFileException: public std::exception {
+	const char* what() const throw () {
+		return "Basis file cannot be accessed or it is not a valid basis file.";
+	}
+};
+
+/** Will be thrown when model file cannot be written or read (@see Solver::writeModel(), Solver::readModel()).
+ *
+ */
+struct ModelFileException: public std::exception {
+	const char* what() const throw () {
+		return "Model file cannot be written or read.";
+	}
+};
+
+/** Will be thrown when snapshot file cannot be written or read (@see Solver::saveSnapshot(), Solver::loadSnapshot()).
+ *
+ */
+struct SnapshotFileException: public std::exception {
+	const char* what() const throw () {
+		return "Snapshot file cannot be accessed or it is not a valid snapshot file of empty model.";
+	}
+};
+
+/** Will be thrown when solution of model is requested but solver does not provide it (@see Solver::values()).
+ *
+ */
+struct NoSolutionException: public std::exception {
+	const char* what() const throw () {
+		return "Solution of the model is not available.";
+	}
+};
+
+/** Will be thrown when indexes do not refer to any element of group (@see SolutionView).
+ *
+ */
+struct IndexOutOfBoundException: public std::exception {
+	const char* what() const throw () {
+		return "Index is out of bound of group.";
+	}
+};
+
 }
 
 #endif /* MODEL_EXCEPTIONS_UTILS_HPP_ */
@@ -0,0 +1,86 @@
+/*
+ * ParameterModelExeptions.hpp
+ *
+ *  Created on: 17 paź 2026
+ *      Author: tomasz
+ */
+
+#ifndef PARAMETER_MODEL_EXCEPTIONS_UTILS_HPP_
+#define PARAMETER_MODEL_EXCEPTIONS_UTILS_HPP_
+
+#include <exception>
+
+namespace ParameterModelExceptions {
+
+/** Will be thrown on attempt of creating a new group of parameters with the same base name as already existing group.
+ *
+ */
+struct DuplicateException: public std::exception {
+	const char* what() const throw () {
+		return "Group of parameters with the same name already exists.";
+	}
+};
+
+/** Exception will be thrown on attempt of creating a new group of parameters while invalid definition was selected.
+ *
+ * Definition of group of parameters has the same form as definition of group of variables (@see StringUtils::parseDefinition()).
+ *
+ */
+struct InvalidGroupDefinitionException: public std::exception {
+	const char* what() const throw () {
+		return "Given definition of a group of parameters is invalid and cannot be interpreted.";
+	}
+};
+
+struct InvalidDefinitionException: public std::exception {
+	const char* what() const throw () {
+		return "Given definition of a parameter is invalid and cannot be interpreted.";
+	}
+};
+
+struct InvalidNumberOfDimensionIndexesException: public std::exception {
+	const char* what() const throw () {
+		return "Given group of parameters has different number of dimensions.";
+	}
+};
+
+struct IndexOutOfBoundException: public std::exception {
+	const char* what() const throw () {
+		return "No such parameter is defined (some index is greater than definition of given group specify?)";
+	}
+};
+
+struct NoSuchGroupException: public std::exception {
+	const char* what() const throw () {
+		return "Cannot find group of parameters with given name.";
+	}
+};
+
+struct ValueOutOfBoundException: public std::exception {
+	const char* what() const throw () {
+		return "Given value is out of parameter's lower or upper bound.";
+	}
+};
+
+/** Will be thrown if tensor file of parameters cannot be read or written or it has invalid format
+ * (@see TensorFileUtils).
+ *
+ */
+struct TensorFileException: public std::exception {
+	const char* what() const throw () {
+		return "Tensor file of parameters cannot be accessed or has invalid format.";
+	}
+};
+
+/** Will be thrown if text file with values of parameters cannot be read (@see ParamTextLoader).
+ *
+ */
+struct DataFileException: public std::exception {
+	const char* what() const throw () {
+		return "File with values of parameters cannot be read.";
+	}
+};
+
+}
+
+#endif /* PARAMETER_MODEL_EXCEPTIONS_UTILS_HPP_ */
@@ -0,0 +1,61 @@
+/*
+ * RowModelExeptions.hpp
+ *
+ *  Created on: 17 paź 2026
+ *      Author: tomasz
+ */
+
+#ifndef ROW_MODEL_EXCEPTIONS_UTILS_HPP_
+#define ROW_MODEL_EXCEPTIONS_UTILS_HPP_
+
+#include <exception>
+
+namespace RowModelExceptions {
+
+/** Will be thrown on attempt of creating a new group of rows with the same base name as already existing group.
+ *
+ */
+struct DuplicateException: public std::exception {
+	const char* what() const throw () {
+		return "Group of rows with the same name already exists.";
+	}
+};
+
+/** Exception will be thrown on attempt of creating a new group of rows while invalid definition was selected.
+ *
+ * Definition of group of rows has the same form as definition of group of variables (@see StringUtils::parseDefinition()).
+ *
+ */
+struct InvalidGroupDefinitionException: public std::exception {
+	const char* what() const throw () {
+		return "Given definition of a group of rows is invalid and cannot be interpreted.";
+	}
+};
+
+struct InvalidDefinitionException: public std::exception {
+	const char* what() const throw () {
+		return "Given definition of a row is invalid and cannot be interpreted.";
+	}
+};
+
+struct InvalidNumberOfDimensionIndexesException: public std::exception {
+	const char* what() const throw () {
+		return "Given group of rows has different number of dimensions.";
+	}
+};
+
+struct IndexOutOfBoundException: public std::exception {
+	const char* what() const throw () {
+		return "No such row is defined (some index is greater than definition of given group specify?)";
+	}
+};
+
+struct NoSuchGroupException: public std::exception {
+	const char* what() const throw () {
+		return "Cannot find group of rows with given name.";
+	}
+};
+
+}
+
+#endif /* ROW_MODEL_EXCEPTIONS_UTILS_HPP_ */
@@ -72,6 +72,26 @@ struct ValueOutOfBoundException: public std::exception {
 	}
 };
 
+/** Will be thrown on attempt of setting lower bound of variable greater than its upper bound
+ * or bounds that do not contain fixed value of variable (@see Variable::setNewBounds()).
+ *
+ */
+struct InvalidBoundsException: public std::exception {
+	const char* what() const throw () {
+		return "Given bounds are invalid for variable (lower bound is greater than upper bound or fixed value is out of them).";
+	}
+};
+
+/** Will be thrown on attempt of changing bounds or fixed values of variables by group of parameters
+ * with different dimensions (@see VarGroup::fix(), VarGroup::setBounds()).
+ *
+ */
+struct DifferentDimensionsException: public std::exception {
+	const char* what() const throw () {
+		return "Given group of parameters has different dimensions than group of variables.";
+	}
+};
+
 }
 
 #endif /* VARIABLE_MODEL_EXCEPTIONS_UTILS_HPP_ */
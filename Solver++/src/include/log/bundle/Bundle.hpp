@@ -15,40 +15,207 @@ enum BundleKey {
 	//*********************************** Solver ***********************************//
 	//**************** Trace ****************//
 	INIT_VAR_GROUP,
-	INIT_VAR_REGEX_MATCH,
-	INIT_VAR_GET_DIM_LIST,
+	INIT_VAR_DEFINITION_MATCH,
 	INIT_VAR_ADD_COUNT,
-	GET_VAR_REGEX_MATCHED,
+	GET_VAR_DEFINITION_MATCHED,
 	GET_VAR_SPLIT_DEFINITION_STATUS,
 	DELETE_VARIABLE,
+	INIT_ROW_GROUP,
+	INIT_ROW_ADD_COUNT,
+	DELETE_ROWS,
+	INIT_PARAM_GROUP,
+	DELETE_PARAMETERS,
 	//**************** Debug ****************//
+	MERGE_ROW_BUFFERS,
+	CAPTURE_BASIS,
+	APPLY_BASIS,
 	//**************** Info *****************//
+	GENERATE_ROWS,
+	GENERATE_ROW_FAMILY,
+	LOAD_PARAM_TENSOR,
+	SAVE_PARAM_TENSOR,
+	SAVE_BASIS,
+	LOAD_BASIS,
+	SAVE_SNAPSHOT,
+	LOAD_SNAPSHOT,
+	SOLVE_ASYNC,
 	//**************** Warn *****************//
 	//**************** Error ****************//
 	//**************** Fatal ****************//
-	INIT_VAR_GROUP_REGEX_SEARCH_FAILED,
+	INIT_VAR_GROUP_PARSE_FAILED,
 	INIT_VAR_DUPLICATE,
+	INIT_VAR_GROUP_TOO_LARGE,
+	INIT_VAR_ADD_COUNT_TOO_LARGE,
 	GET_VAR_DIFFERENT_DIM_SIZE,
 	GET_VAR_INDEX_OUT_OF_BOUNDS,
-	GET_VAR_GROUP_REGEX_SEARCH_FAILED,
+	GET_VAR_DEFINITION_PARSE_FAILED,
+	GET_VAR_GROUP_DIFFERENT_DIM_SIZE,
 	SET_VAR_FIX_VALUE_OUT_OF_BOUNDS,
+	INIT_ROW_GROUP_PARSE_FAILED,
+	INIT_ROW_DUPLICATE,
+	INIT_ROW_GROUP_TOO_LARGE,
+	INIT_ROW_ADD_COUNT_TOO_LARGE,
+	GET_ROW_DIFFERENT_DIM_SIZE,
+	GET_ROW_INDEX_OUT_OF_BOUNDS,
+	GET_ROW_DEFINITION_PARSE_FAILED,
+	GET_ROW_GROUP_DIFFERENT_DIM_SIZE,
+	INIT_PARAM_GROUP_PARSE_FAILED,
+	INIT_PARAM_DUPLICATE,
+	INIT_PARAM_GROUP_TOO_LARGE,
+	INIT_PARAM_VALUE_OUT_OF_BOUNDS,
+	GET_PARAM_DIFFERENT_DIM_SIZE,
+	GET_PARAM_INDEX_OUT_OF_BOUNDS,
+	GET_PARAM_DEFINITION_PARSE_FAILED,
+	GET_PARAM_GROUP_DIFFERENT_DIM_SIZE,
+	LOAD_PARAM_TENSOR_FAILED,
+	SAVE_PARAM_TENSOR_FAILED,
+	SOLVE_SCENARIO_INVALID,
+	SAVE_BASIS_FAILED,
+	LOAD_BASIS_FAILED,
+	GET_SOLUTION_NOT_AVAILABLE,
+	SAVE_SNAPSHOT_FAILED,
+	LOAD_SNAPSHOT_FAILED,
+	LOAD_SNAPSHOT_NOT_EMPTY,
+	GENERATE_ROWS_INDEX_OUT_OF_BOUNDS,
+	GENERATE_ROWS_BOUND_OUT_OF_BOUNDS,
 	//*********************************** VariableIdxMapper ***********************************//
 	//**************** Trace ****************//
 	IF_DIMS_OUT_OF_BOUNDS,
 	LINEARIZE_DIMENSION_LIST,
 	//**************** Debug ****************//
 	INIT_VAR_MAPPER_CONSTRUCTOR,
+	SET_VAR_GROUP_BOUNDS,
+	FIX_VAR_GROUP_VALUES,
+	RELAX_VAR_GROUP,
 	//**************** Info *****************//
 	//**************** Warn *****************//
+	SET_VAR_GROUP_BOUNDS_REJECTED,
+	FIX_VAR_GROUP_VALUES_REJECTED,
 	//**************** Error ****************//
 	NEGATIVE_INDEX,
 	INDEX_OUT_OF_BOUNDS,
 	//**************** Fatal ****************//
+	VAR_GROUP_DIFFERENT_PARAM_DIMS,
 	//*********************************** Variable ***********************************//
 	//**************** Trace ****************//
 	SET_VAR_FIX_VALUE,
+	SET_VAR_BOUNDS,
 	//**************** Debug ****************//
-	INIT_VAR_VARIABLE_CONSTRUCTOR
+	//**************** Info *****************//
+	//**************** Warn *****************//
+	//**************** Error ****************//
+	//**************** Fatal ****************//
+	SET_VAR_BOUNDS_INVALID,
+	//*********************************** Row ***********************************//
+	//**************** Trace ****************//
+	//**************** Debug ****************//
+	//**************** Info *****************//
+	//**************** Warn *****************//
+	//**************** Error ****************//
+	//**************** Fatal ****************//
+	ADD_ROW_ELEMENT_OUT_OF_BOUNDS,
+	//*********************************** RowIdxMapper ***********************************//
+	//**************** Trace ****************//
+	//**************** Debug ****************//
+	INIT_ROW_MAPPER_CONSTRUCTOR,
+	//**************** Info *****************//
+	//**************** Warn *****************//
+	//**************** Error ****************//
+	//**************** Fatal ****************//
+	//*********************************** ParamIdxMapper ***********************************//
+	//**************** Trace ****************//
+	//**************** Debug ****************//
+	INIT_PARAM_MAPPER_CONSTRUCTOR,
+	INIT_PARAM_MAPPER_MAPPED,
+	//**************** Info *****************//
+	//**************** Warn *****************//
+	//**************** Error ****************//
+	//**************** Fatal ****************//
+	//*********************************** Parameter ***********************************//
+	//**************** Trace ****************//
+	//**************** Debug ****************//
+	//**************** Info *****************//
+	//**************** Warn *****************//
+	//**************** Error ****************//
+	//**************** Fatal ****************//
+	SET_PARAM_VALUE_OUT_OF_BOUNDS,
+	//*********************************** ParamTextLoader ***********************************//
+	//**************** Trace ****************//
+	//**************** Debug ****************//
+	//**************** Info *****************//
+	LOAD_PARAM_TEXT,
+	LOAD_PARAM_TEXT_DONE,
+	//**************** Warn *****************//
+	LOAD_PARAM_TEXT_DUPLICATES,
+	LOAD_PARAM_TEXT_INVALID,
+	//**************** Error ****************//
+	//**************** Fatal ****************//
+	LOAD_PARAM_TEXT_FAILED,
+	//*********************************** ModelWriter ***********************************//
+	//**************** Trace ****************//
+	//**************** Debug ****************//
+	//**************** Info *****************//
+	WRITE_MODEL,
+	WRITE_MODEL_DONE,
+	//**************** Warn *****************//
+	//**************** Error ****************//
+	//**************** Fatal ****************//
+	WRITE_MODEL_FAILED,
+	//*********************************** ModelReader ***********************************//
+	//**************** Trace ****************//
+	//**************** Debug ****************//
+	//**************** Info *****************//
+	READ_MODEL,
+	READ_MODEL_DONE,
+	//**************** Warn *****************//
+	READ_MODEL_SPARSE_GROUP,
+	READ_MODEL_MIXED_TYPES,
+	READ_MODEL_MAXIMIZE,
+	//**************** Error ****************//
+	//**************** Fatal ****************//
+	READ_MODEL_FAILED,
+	READ_MODEL_INVALID_LINE,
+	READ_MODEL_INVALID_GROUP,
+	READ_MODEL_DUPLICATE_VARIABLES,
+	READ_MODEL_DUPLICATE_ROWS,
+	READ_MODEL_TOO_LARGE,
+	//*********************************** OsiProblemInstance ***********************************//
+	//**************** Trace ****************//
+	RESERVE_COLUMNS,
+	RESERVE_ROWS,
+	//**************** Debug ****************//
+	INIT_SOLVER_INTERFACE,
+	ADD_COLUMNS,
+	ADD_ROWS,
+	REMOVE_COLUMNS,
+	REMOVE_ROWS,
+	//**************** Info *****************//
+	LOAD_PROBLEM,
+	UPDATE_PROBLEM,
+	UPDATE_PROBLEM_RELOAD,
+	SOLVE_PROBLEM,
+	SOLVE_PROBLEM_DONE,
+	SOLVE_SCENARIOS,
+	SOLVE_SCENARIOS_DONE,
+	//**************** Warn *****************//
+	SOLVE_MIP_TIME_LIMIT_IGNORED,
+	SOLVE_MIP_CANCEL_IGNORED,
+	//**************** Error ****************//
+	//**************** Fatal ****************//
+	//*********************************** Presolve ***********************************//
+	//**************** Trace ****************//
+	//**************** Debug ****************//
+	//**************** Info *****************//
+	PRESOLVE_DONE,
+	//**************** Warn *****************//
+	PRESOLVE_INFEASIBLE,
+	//**************** Error ****************//
+	//**************** Fatal ****************//
+	//*********************************** CoefficientMatrix ***********************************//
+	//**************** Trace ****************//
+	ALLOCATE_CHUNK,
+	//**************** Debug ****************//
+	REMOVE_ELEMENTS
 	//**************** Info *****************//
 	//**************** Warn *****************//
 	//**************** Error ****************//
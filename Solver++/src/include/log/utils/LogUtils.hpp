@@ -91,6 +91,13 @@ const char* parseBundle(const char* const & bundle);
 size_t insertRightFormat(std::string& bundle, const size_t& beginIdx,
 		const size_t& length);
 
+/** Formats given bundle with given arguments into buffer of calling thread.
+ *
+ * Returned message is valid until the next call from the same thread.
+ *
+ * @param bundle
+ * @return
+ */
 const char* formatBundle(const char* bundle, ...);
 
 }
@@ -10,9 +10,10 @@
 
 #include <log4cxx/helpers/messagebuffer.h>
 #include <log4cxx/logger.h>
-#include <list>
+#include <algorithm>
 #include <string>
 
+#include "../DimensionTable.hpp"
 #include "../log/bundle/Bundle.hpp"
 #include "../log/utils/LogUtils.hpp"
 #include "../Typedefs.hpp"
@@ -31,37 +32,31 @@ const static log4cxx::LoggerPtr logger(log4cxx::Logger::getLogger("MapperUtils")
 /** Checks if given list of dimensions is valid in context of dimensions of some group of elements.
  *
  *  Function will return true only if at least one of the following conditions is met"
- *  - size of list that was passed by parameter is not equal to size
- *  of groupDimensions list (number of dimension are not equal),
- *  - one of given indexes in dimensions parameter exceeds the corresponding index
- *  in groupDimensions list (element with that set of indexes does not exists).
+ *  - size of list that was passed by parameter is not equal to number
+ *  of dimensions of groupDimensions table (number of dimension are not equal),
+ *  - one of given indexes in dimensions parameter exceeds the corresponding size
+ *  in groupDimensions table (element with that set of indexes does not exists).
  *
  * @param groupDimensions
  * @param elementDimensions
  * @return
  */
-template<typename DimIdx>
-bool ifDimensionsOutOfBounds(const std::list<DimIdx>& groupDimensions,
-		const std::list<DimIdx>& elementDimensions) {
-	std::list<VarDimIdx>::const_iterator itThisBegin = groupDimensions.begin();
-	std::list<VarDimIdx>::const_iterator itParamBegin =
-			elementDimensions.begin();
-	const std::list<VarDimIdx>::const_iterator itThisEnd =
-			groupDimensions.end();
-
+template<typename Idx, typename DimIdx>
+bool ifDimensionsOutOfBounds(
+		const DimensionTable<Idx, DimIdx>& groupDimensions,
+		const IndexTuple<DimIdx>& elementDimensions) {
 	TRACE(logger, BundleKey::IF_DIMS_OUT_OF_BOUNDS,
 			Utils::getStringDimensions(elementDimensions).c_str(),
-			Utils::getStringDimensions(groupDimensions).c_str());
-	for (; itThisBegin != itThisEnd; ++itThisBegin, ++itParamBegin) {
-		if (*itParamBegin <= 0 || *itThisBegin < *itParamBegin) {
-			ERROR(logger,
-					(*itParamBegin <= 0 ?
-							BundleKey::NEGATIVE_INDEX :
-							BundleKey::INDEX_OUT_OF_BOUNDS),
-					Utils::getStringDimensions(elementDimensions).c_str(),
-					Utils::getStringDimensions(groupDimensions).c_str());
-			return false;
-		}
+			Utils::getStringDimensions(groupDimensions.getExtents()).c_str());
+	if (groupDimensions.isOutOfBounds(elementDimensions)) {
+		ERROR(logger,
+				(std::find(elementDimensions.begin(), elementDimensions.end(),
+						0) != elementDimensions.end() ?
+						BundleKey::NEGATIVE_INDEX :
+						BundleKey::INDEX_OUT_OF_BOUNDS),
+				Utils::getStringDimensions(elementDimensions).c_str(),
+				Utils::getStringDimensions(groupDimensions.getExtents()).c_str());
+		return true;
 	}
 	return false;
 }
@@ -85,30 +80,15 @@ bool ifDimensionsOutOfBounds(const std::list<DimIdx>& groupDimensions,
  * @return
  */
 template<typename Idx, typename DimIdx>
-Idx linearizeDimensionList(const std::list<DimIdx>& groupDimensions,
-		const std::list<DimIdx>& elementDimensions) {
-	typename std::list<DimIdx>::const_reverse_iterator itParamEnd =
-			elementDimensions.rbegin();
-	typename std::list<DimIdx>::const_reverse_iterator itThisEnd =
-			groupDimensions.rbegin();
-	const typename std::list<DimIdx>::const_reverse_iterator itParamBegin =
-			elementDimensions.rend();
-
-	VarIdx numberOfVariablesOnPreviousDim = 1;
-	VarIdx variableIndex = 0;
-
+Idx linearizeDimensionList(const DimensionTable<Idx, DimIdx>& groupDimensions,
+		const IndexTuple<DimIdx>& elementDimensions) {
 	TRACE(logger, BundleKey::LINEARIZE_DIMENSION_LIST,
 			Utils::getStringDimensions(elementDimensions).c_str());
-
-	for (; itParamEnd != itParamBegin; ++itParamEnd, ++itThisEnd) {
-		variableIndex += numberOfVariablesOnPreviousDim * (*itParamEnd - 1);
-		numberOfVariablesOnPreviousDim *= *itThisEnd;
-	}
-	return variableIndex;
+	return groupDimensions.linearize(elementDimensions);
 }
 
 /** Reconstruct list of dimensions of element based on its index in XIdxMapper class
- * and given list of bounds of dimensions of that element where "X" is either: Parameter, Variable or Row.
+ * and given table of dimensions of that element where "X" is either: Parameter, Variable or Row.
  *
  * Every structure has its own types and this method needs to be called with proper template parameters:
  * - MapUtils::unlinearizeDimensionList<VarIdx,VarDimIdx>(i, d) - for VariableIdxMapper,
@@ -116,47 +96,50 @@ Idx linearizeDimensionList(const std::list<DimIdx>& groupDimensions,
  * - MapUtils::unlinearizeDimensionList<RowIdx,RowDimIdx>(i, d) - for RowdxMapper,
  *
  * where "i" is an index of given structure in XIdxMapper one-dimensional array field
- * that stores given element and "d" is dimension list that defines group of elements
+ * that stores given element and "d" is dimension table that defines group of elements
  * to which given element belongs.
  *
- * Example on group of parameters 'p[4][5]' (list<ParamDimIdx> - {4,5}):
+ * Example on group of parameters 'p[4][5]' (extents - {4,5}):
  * 	p[0]	->	p[1][1]	(0*5 + 0)
  * 	p[7]	->	p[2][3]	(1*5 + 2)
  *
- * Example on group of variables 'x[12][6][8]' (list<VarDimIdx> - {12,6,8}):
+ * Example on group of variables 'x[12][6][8]' (extents - {12,6,8}):
  * 	x[0]	->	x[1][1][1]	(0*(6*8) + 0*8 + 0)
- * 	x[73]	->	x[2][4][1]	(1*(6*8) + 3*8 + 1)
+ * 	x[73]	->	x[2][4][2]	(1*(6*8) + 3*8 + 1)
  *
  * @param idx index of given structure in XIdxMapper one-dimensional array field that stores given element
- * @param groupDimensions list of upper bounds of dimensions
+ * @param groupDimensions dimension table of group
  * @return
  */
 template<typename Idx, typename DimIdx>
-const std::list<DimIdx> unlinearizeDimensionList(Idx idx,
-		const std::list<DimIdx>& groupDimensions) {
-	DimIdx dimensionIdx { };
-	DimIdx dimensionMultiplier { 1 };
-	std::list<DimIdx> variableDimensions { };
-	const typename std::list<DimIdx>::const_iterator itEnd =
-			groupDimensions.end();
-
-	for (typename std::list<DimIdx>::const_iterator itBegin =
-			++groupDimensions.begin(); itBegin != itEnd; ++itBegin) {
-		dimensionMultiplier *= *itBegin;
-	}
-	for (typename std::list<DimIdx>::const_iterator itBegin =
-			++groupDimensions.begin(); itBegin != itEnd; ++itBegin) {
-		dimensionIdx = 1;
-		while (idx >= dimensionMultiplier) {
-			dimensionIdx += 1;
-			idx -= dimensionMultiplier;
-		}
-		variableDimensions.push_back(dimensionIdx);
-		dimensionMultiplier /= *itBegin;
-	}
+const IndexTuple<DimIdx> unlinearizeDimensionList(Idx idx,
+		const DimensionTable<Idx, DimIdx>& groupDimensions) {
+	IndexTuple<DimIdx> variableDimensions { };
+	groupDimensions.unlinearize(idx, variableDimensions);
 	return variableDimensions;
 }
 
+/** Reconstruct lists of dimensions of many elements of the same group at once.
+ *
+ * Batched version of unlinearizeDimensionList() e.g. for mapping every column of solution back to its indexes.
+ * Indexes of element idx[k] will be stored in flat buffer at positions [k * d, k * d + d) where d is
+ * a number of dimensions of given group (@see DimensionTable::unlinearize()).
+ *
+ * Example on group of variables 'x[4][5]':
+ * 	unlinearizeDimensionList({0, 7}, 2, d, indexes)	->	indexes = {1, 1, 2, 3}
+ *
+ * @param idx array of indexes of elements in XIdxMapper one-dimensional array
+ * @param count number of elements in idx array
+ * @param groupDimensions dimension table of group
+ * @param dimensions output buffer that can hold count * d elements
+ */
+template<typename Idx, typename DimIdx>
+void unlinearizeDimensionList(const Idx* idx, const size_t count,
+		const DimensionTable<Idx, DimIdx>& groupDimensions,
+		DimIdx* dimensions) {
+	groupDimensions.unlinearize(idx, count, dimensions);
+}
+
 /** Return full name of element based on its index in one-dimensional array in XIdxMapper class
  * where "X" is either: Parameter, Variable or Row and given list of bounds of dimensions of that group's element.
  *
@@ -166,26 +149,26 @@ const std::list<DimIdx> unlinearizeDimensionList(Idx idx,
  * - MapUtils::getVariableName<RowIdx,RowDimIdx>(i, n, d) - for RowdxMapper,
  *
  * where "i" is an index of given structure in XIdxMapper one-dimensional array field that stores given element,
- * "n" states for name of given group of elements and "d" is dimension list of element which name we want to generate.
+ * "n" states for name of given group of elements and "d" is dimension table of group which element name we want to generate.
  *
- * Example on group of parameters 'p[4][5]' (group name - 'p'; list<ParamDimIdx> - {4,5}):
+ * Example on group of parameters 'p[4][5]' (group name - 'p'; extents - {4,5}):
  * 	p[0]	->	p[1][1]	(0*5 + 0)
  * 	p[7]	->	p[2][3]	(1*5 + 2)
  *
- * Example on group of variables 'x[12][6][8]' (group name - 'x'; list<VarDimIdx> - {12,6,8}):
+ * Example on group of variables 'x[12][6][8]' (group name - 'x'; extents - {12,6,8}):
  * 	x[0]	->	x[1][1][1]	(0*(6*8) + 0*8 + 0)
- * 	x[73]	->	x[2][4][1]	(1*(6*8) + 3*8 + 1)
+ * 	x[73]	->	x[2][4][2]	(1*(6*8) + 3*8 + 1)
  *
  * @param idx index of given structure in XIdxMapper one-dimensional array field that stores given element
  * @param groupName name of group to which given element belongs
- * @param groupDimensions list of upper bounds of dimensions
+ * @param groupDimensions dimension table of group
  * @return
  */
 template<typename Idx, typename DimIdx>
 const std::string getVariableName(Idx idx, const std::string& groupName,
-		const std::list<DimIdx>& groupDimensions) {
+		const DimensionTable<Idx, DimIdx>& groupDimensions) {
 	return groupName
-			+ (groupDimensions.empty() ?
+			+ (groupDimensions.getNumberOfDimensions() == 0 ?
 					"" :
 					Utils::getStringDimensions(
 							unlinearizeDimensionList<Idx, DimIdx>(idx,
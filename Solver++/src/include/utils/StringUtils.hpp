@@ -8,12 +8,17 @@
 #ifndef STRING_UTILS_HPP_
 #define STRING_UTILS_HPP_
 
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
 #include <iostream>
 #include <list>
 #include <string>
 #include <sstream>
 
-#include "../Solver.hpp"
+#include "../DimensionTable.hpp"
 
 namespace StringUtils {
 
@@ -32,7 +37,7 @@ namespace Impl {
  *  	std::cout << DIM_GROUP_DELIMETERS[1];	// will print ']'
  *  @endcode
  *
- *  This characters is widely used i.e. by StringUtils::variableDimensionTokenize()
+ *  This characters is widely used i.e. by StringUtils::parseDefinition()
  */
 const static char* DIM_GROUP_DELIMETERS { "[]" };
 
@@ -61,29 +66,218 @@ std::list<T> tokenize(const std::string& inputString,
 	return tokens;
 }
 
-/** Extracts from dimensional part of definition of group of variables information about its' dimensions.
+/** Result of parsing of definition of variable (or group of variables) e.g. "x[2][3]".
  *
- * Example:
+ * Name is not copied - it points into parsed string (and it is not null-terminated),
+ * so it is valid only as long as parsed string is.
+ *
+ */
+template<class T>
+struct Definition {
+
+	/** First character of name of definition.
+	 *
+	 */
+	const char* name;
+
+	/** Number of characters of name of definition.
+	 *
+	 */
+	size_t nameLength;
+
+	/** Indexes enclosed in brackets that follow name of definition.
+	 *
+	 */
+	IndexTuple<T> indexes;
+
+};
+
+namespace Impl {
+
+inline bool isNameCharacter(const char c) {
+	return ('a' <= c && c <= 'z') || ('A' <= c && c <= 'Z')
+			|| ('0' <= c && c <= '9') || c == '_';
+}
+
+}
+
+/** Parses definition of variable (or group of variables) in a single pass without any allocation.
+ *
+ * Valid definition consists of name (at least one English letter, digit or underscore)
+ * followed by any number of positive indexes without leading zeros enclosed
+ * in given delimiters, by default StringUtils::Impl::DIM_GROUP_DELIMETERS (regular expression: "^(\w+)((\[[1-9][0-9]*\])*)$").
  *
- * 	variableDimensionTokenize("[1][2][3]") result in list of integer values of type T: 1, 2 and 3.
+ * Example:
+ * @code
+ * 	Definition<VarDimIdx> d { };
+ * 	parseDefinition("x[2][3]", 7, d);	// true, name: "x", indexes: {2, 3}
+ * 	parseDefinition("x", 1, d);			// true, name: "x", indexes: {}
+ * 	parseDefinition("x[0]", 4, d);		// false
+ * 	parseDefinition("x[2]y", 5, d);		// false
+ * @endcode
  *
- * @param inputString
- * @return
+ * @param inputString definition to be parsed
+ * @param length number of characters of definition
+ * @param definition structure that will be filled with name and indexes of definition
+ * @param delimiters opening and closing delimiter of indexes (e.g. "()" for names of CPLEX LP files)
+ * @return false if given string is not a valid definition, has more than MAX_NUMBER_OF_DIMENSIONS indexes
+ * or one of its indexes does not fit in type T, true otherwise.
  */
 template<class T>
-std::list<T> variableDimensionTokenize(const char* inputString) {
+bool parseDefinition(const char* inputString, const size_t length,
+		Definition<T>& definition, const char* delimiters =
+				StringUtils::Impl::DIM_GROUP_DELIMETERS) {
+	const char left_bracket = delimiters[0];
+	const char right_bracket = delimiters[1];
+	const T maxValue = (T) -1;
+	size_t pos { 0 };
 	T value { };
-	std::list<T> tokens { };
-	std::istringstream ss(inputString);
-	char left_bracket = StringUtils::Impl::DIM_GROUP_DELIMETERS[0];
-	char right_bracket = StringUtils::Impl::DIM_GROUP_DELIMETERS[1];
+	T digit { };
 
-	while (ss >> left_bracket >> value >> right_bracket) {
-		tokens.push_back(value);
+	while (pos < length && StringUtils::Impl::isNameCharacter(inputString[pos])) {
+		pos += 1;
+	}
+	if (pos == 0) {
+		return false;
 	}
+	definition.name = inputString;
+	definition.nameLength = pos;
+	definition.indexes.clear();
 
-	return tokens;
+	while (pos < length) {
+		if (inputString[pos] != left_bracket || pos + 1 == length
+				|| inputString[pos + 1] < '1' || inputString[pos + 1] > '9') {
+			return false;
+		}
+		pos += 1;
+		value = 0;
+		while (pos < length && '0' <= inputString[pos] && inputString[pos] <= '9') {
+			digit = (T) (inputString[pos] - '0');
+			if (value > (maxValue - digit) / 10) {
+				return false;
+			}
+			value = (T) (value * 10 + digit);
+			pos += 1;
+		}
+		if (pos == length || inputString[pos] != right_bracket
+				|| !definition.indexes.push_back(value)) {
+			return false;
+		}
+		pos += 1;
+	}
+
+	return true;
+
+}
+
+/** Parses unsigned decimal integer at the beginning of [begin, end) without any allocation.
+ *
+ * @param begin first character to be parsed
+ * @param end character after the last one that can be parsed
+ * @param value parsed number
+ * @return pointer to the first character after parsed number or nullptr if there is no number
+ * or it does not fit in type T.
+ */
+template<class T>
+const char* parseUnsigned(const char* begin, const char* end, T& value) {
+	const T maxValue = (T) -1;
+	const char* pos { begin };
+	T digit { };
+	value = 0;
+	while (pos < end && '0' <= *pos && *pos <= '9') {
+		digit = (T) (*pos - '0');
+		if (value > (maxValue - digit) / 10) {
+			return nullptr;
+		}
+		value = (T) (value * 10 + digit);
+		pos += 1;
+	}
+	return pos == begin ? nullptr : pos;
+}
+
+/** Parses decimal floating-point number (e.g. "-12", "3.25", "1e-3") at the beginning of [begin, end).
+ *
+ * Numbers with at most 15 significant digits and decimal exponent within [-22, 22] (almost every number
+ * written by other programs) are converted exactly by a single multiplication or division.
+ * Any other number (including "inf" and "nan") is passed to strtod().
+ *
+ * @param begin first character to be parsed
+ * @param end character after the last one that can be parsed
+ * @param value parsed number
+ * @return pointer to the first character after parsed number or nullptr if there is no number.
+ */
+inline const char* parseNumber(const char* begin, const char* end,
+		double& value) {
+	const static double POWERS_OF_TEN[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6,
+			1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18,
+			1e19, 1e20, 1e21, 1e22 };
+	const char* pos { begin };
+	const char* digits { };
+	bool negative { false };
+	uint64_t mantissa { 0 };
+	int numberOfDigits { 0 }, exponent { 0 }, exponentValue { 0 };
+	bool negativeExponent { false };
+	char buffer[64] { };
+	char* parsedEnd { };
+
+	if (pos < end && (*pos == '-' || *pos == '+')) {
+		negative = *pos == '-';
+		pos += 1;
+	}
+	digits = pos;
+	while (pos < end && *pos == '0') {
+		pos += 1;
+	}
+	while (pos < end && '0' <= *pos && *pos <= '9') {
+		mantissa = mantissa * 10 + (*pos - '0');
+		numberOfDigits += 1;
+		pos += 1;
+	}
+	if (pos < end && *pos == '.') {
+		pos += 1;
+		if (mantissa == 0) {
+			while (pos < end && *pos == '0') {
+				exponent -= 1;
+				pos += 1;
+			}
+		}
+		while (pos < end && '0' <= *pos && *pos <= '9') {
+			mantissa = mantissa * 10 + (*pos - '0');
+			numberOfDigits += 1;
+			exponent -= 1;
+			pos += 1;
+		}
+	}
+	if (pos == digits || (pos == digits + 1 && *digits == '.')) {
+		numberOfDigits = 100;
+	} else if (pos < end && (*pos == 'e' || *pos == 'E')) {
+		pos += 1;
+		if (pos < end && (*pos == '-' || *pos == '+')) {
+			negativeExponent = *pos == '-';
+			pos += 1;
+		}
+		if (pos == end || *pos < '0' || *pos > '9') {
+			return nullptr;
+		}
+		while (pos < end && '0' <= *pos && *pos <= '9') {
+			exponentValue = std::min(exponentValue * 10 + (*pos - '0'), 10000);
+			pos += 1;
+		}
+		exponent += negativeExponent ? -exponentValue : exponentValue;
+	}
+
+	if (numberOfDigits <= 15 && -22 <= exponent && exponent <= 22) {
+		value = (double) mantissa;
+		value = exponent < 0 ?
+				value / POWERS_OF_TEN[-exponent] :
+				value * POWERS_OF_TEN[exponent];
+		value = negative ? -value : value;
+		return pos;
+	}
 
+	memcpy(buffer, begin, std::min((size_t) (end - begin), sizeof(buffer) - 1));
+	value = strtod(buffer, &parsedEnd);
+	return parsedEnd == buffer ? nullptr : begin + (parsedEnd - buffer);
 }
 
 }
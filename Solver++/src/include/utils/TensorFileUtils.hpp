@@ -0,0 +1,187 @@
+/*
+ * TensorFileUtils.hpp
+ *
+ *  Created on: 17 paź 2026
+ *      Author: tomasz
+ */
+
+#ifndef TENSOR_FILE_UTILS_HPP_
+#define TENSOR_FILE_UTILS_HPP_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+
+#include "../DimensionTable.hpp"
+#include "../exp/ParameterModelExeptions.hpp"
+#include "../Typedefs.hpp"
+
+/** @brief Binary tensor format of groups of parameters.
+ *
+ * @details File consists of header, list of dimensions, name and raw data (every number is little-endian):
+ * @code
+ * 	offset	size			field
+ * 	0		8				magic "SPPTNSR\0"
+ * 	8		4 (uint32)		version (1)
+ * 	12		4 (uint32)		type of data (@see DataType)
+ * 	16		4 (uint32)		number of dimensions n (not greater than MAX_NUMBER_OF_DIMENSIONS)
+ * 	20		4 (uint32)		length of name l (in bytes, without terminating '\0')
+ * 	24		8 (uint64)		offset of data d (multiple of DATA_ALIGNMENT)
+ * 	32		4 * n (uint32)	sizes of dimensions, from the highest dimension to the lowest
+ * 	32 + 4n	l				name of group of parameters
+ * 	...						zero padding up to d
+ * 	d		size of type * product of sizes of dimensions	values in row-major order (the last dimension changes the fastest)
+ * @endcode
+ *
+ * Data is aligned to #DATA_ALIGNMENT bytes within file, so when file is mapped into memory
+ * (@see map()) values of type DataType::FLOAT64 can be used in place, without copying or parsing.
+ *
+ */
+namespace TensorFileUtils {
+
+/** @brief Type of values stored in tensor file.
+ *
+ */
+enum DataType {
+	FLOAT64 = 1, //!< IEEE 754 double (used in place, the same as ParamValue)
+	FLOAT32 = 2, //!< IEEE 754 float (converted while loading)
+	INT64 = 3,   //!< signed 64-bit integer (converted while loading)
+	INT32 = 4    //!< signed 32-bit integer (converted while loading)
+};
+
+/** @brief Magic bytes at the beginning of every tensor file.
+ *
+ */
+extern const char MAGIC[8];
+
+/** @brief Version of format written by write().
+ *
+ */
+const static uint32_t VERSION { 1 };
+
+/** @brief Alignment of data within tensor file.
+ *
+ */
+const static uint64_t DATA_ALIGNMENT { 64 };
+
+/** @brief Fixed-size part of header of tensor file.
+ *
+ */
+struct Header {
+	char magic[8];
+	uint32_t version;
+	uint32_t dataType;
+	uint32_t numberOfDimensions;
+	uint32_t nameLength;
+	uint64_t dataOffset;
+};
+
+/** @brief Contents of header of tensor file.
+ *
+ */
+struct Description {
+
+	/** @brief Name of group of parameters stored in file.
+	 *
+	 */
+	std::string name;
+
+	/** @brief Type of stored values.
+	 *
+	 */
+	DataType dataType;
+
+	/** @brief Sizes of dimensions of stored group of parameters.
+	 *
+	 */
+	ParamIndexTuple extents;
+
+	/** @brief Offset of the first value from the beginning of file.
+	 *
+	 */
+	uint64_t dataOffset;
+
+	/** @brief Number of stored values.
+	 *
+	 */
+	size_t numberOfElements;
+
+};
+
+/** @brief Memory mapping of the whole file.
+ *
+ */
+struct Mapping {
+
+	/** @brief Address of the first byte of file (nullptr if nothing is mapped).
+	 *
+	 */
+	void* address;
+
+	/** @brief Size of mapped file.
+	 *
+	 */
+	size_t size;
+
+};
+
+/** @brief Maps given file into memory.
+ *
+ * @details File is mapped privately (copy-on-write) - values may be changed in memory
+ * but changes never reach the file. Pages are read from disk only when they are touched.
+ *
+ * @param fileName
+ * @return
+ *
+ * @throw ParameterModelExceptions::TensorFileException if file cannot be opened or mapped.
+ */
+Mapping map(const std::string& fileName)
+		throw (ParameterModelExceptions::TensorFileException);
+
+/** @brief Unmaps memory mapped by map().
+ *
+ * @param mapping
+ */
+void unmap(Mapping& mapping);
+
+/** @brief Reads and validates header of tensor file mapped into memory.
+ *
+ * @param mapping
+ * @param description description of file
+ * @return true if mapping contains valid header and the whole data described by it, false otherwise.
+ */
+bool readDescription(const Mapping& mapping, Description& description);
+
+/** @brief Returns true if values of given type can be used in place (without conversion) on this machine.
+ *
+ * @param dataType
+ * @return
+ */
+bool isNative(const DataType dataType);
+
+/** @brief Converts values stored in file into ParamValue values.
+ *
+ * @param mapping
+ * @param description
+ * @param values array of description.numberOfElements values
+ */
+void convert(const Mapping& mapping, const Description& description,
+		ParamValue* values);
+
+/** @brief Writes group of parameters into tensor file (DataType::FLOAT64).
+ *
+ * @param fileName
+ * @param name name of group of parameters
+ * @param dimensions dimensions of group of parameters
+ * @param values values of group in row-major order
+ *
+ * @throw ParameterModelExceptions::TensorFileException if file cannot be written
+ * or name is longer than the format allows (2^32 - 1 bytes).
+ */
+void write(const std::string& fileName, const std::string& name,
+		const ParamDimensionTable& dimensions, const ParamValue* values)
+				throw (ParameterModelExceptions::TensorFileException);
+
+}
+
+#endif /* TENSOR_FILE_UTILS_HPP_ */
@@ -0,0 +1,47 @@
+/*
+ * ThreadUtils.hpp
+ *
+ *  Created on: 17 paź 2026
+ *      Author: tomasz
+ */
+
+#ifndef THREAD_UTILS_HPP_
+#define THREAD_UTILS_HPP_
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+namespace ThreadUtils {
+
+/** Returns given number of threads or number of hardware threads if 0 is given.
+ *
+ * @param numberOfThreads
+ * @return
+ */
+inline unsigned int getNumberOfThreads(const unsigned int numberOfThreads) {
+	return numberOfThreads != 0 ?
+			numberOfThreads : std::max(1u, std::thread::hardware_concurrency());
+}
+
+/** Runs worker(t) for t = 0, ..., numberOfThreads - 1 - each in separate thread (worker 0 runs in calling thread).
+ *
+ * @param numberOfThreads
+ * @param worker
+ */
+template<typename Worker>
+void runWorkers(const unsigned int numberOfThreads, Worker worker) {
+	std::vector<std::thread> threads { };
+	threads.reserve(numberOfThreads - 1);
+	for (unsigned int t = 1; t < numberOfThreads; t += 1) {
+		threads.emplace_back(worker, t);
+	}
+	worker(0);
+	for (std::thread& thread : threads) {
+		thread.join();
+	}
+}
+
+}
+
+#endif /* THREAD_UTILS_HPP_ */
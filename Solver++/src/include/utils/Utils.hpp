@@ -8,10 +8,10 @@
 #ifndef UTILS_HPP_
 #define UTILS_HPP_
 
-#include <list>
+#include <stddef.h>
 #include <string>
-#include <unordered_map>
 
+#include "../DimensionTable.hpp"
 #include "../Typedefs.hpp"
 
 class Variable;
@@ -21,50 +21,27 @@ namespace Utils {
 namespace impl {
 void storeInfinityValues(const VarValue infinity);
 
-/** Reconstruct list of dimensions of given variable based on its index in variables array in VariableIdxMapper class.
- *
- * Example on group of variables 'x[4][5]':
- * 	x[0] -> x[1][1]	(0*4 + 0)
- * 	x[7] -> x[2][3]	(1*5 + 2)
+}
+
+/** Returns string that contains pairs of row index and coefficient that is corresponding to it.
  *
- * @param variableIdx
- * @param groupDimensions
+ * @param rowIdx array of rows in which variable has coefficient
+ * @param rowCoefficients array of coefficients of variable in corresponding rows
+ * @param count number of coefficients
  * @return
  */
-template<typename DimIdx, typename Idx>
-const std::list<DimIdx> unlinearizeDimensionList(Idx& variableIdx,
-		const std::list<DimIdx>& groupDimensions) {
-	DimIdx dimensionIdx { };
-	DimIdx dimensionMultiplier { 1 };
-	std::list<DimIdx> variableDimensions { };
-	const typename std::list<DimIdx>::const_iterator itEnd = groupDimensions.end();
-
-	for (typename std::list<DimIdx>::const_iterator itBegin =
-			++groupDimensions.begin(); itBegin != itEnd; ++itBegin) {
-		dimensionMultiplier *= *itBegin;
-	}
-	for (typename std::list<DimIdx>::const_iterator itBegin =
-			++groupDimensions.begin(); itBegin != itEnd; ++itBegin) {
-		dimensionIdx = 1;
-		while (variableIdx >= dimensionMultiplier) {
-			dimensionIdx += 1;
-			variableIdx -= dimensionMultiplier;
-		}
-		variableDimensions.push_back(dimensionIdx);
-		dimensionMultiplier /= *itBegin;
-	}
-	return variableDimensions;
-}
-
-}
+const std::string getStringVariableRowCoefficients(const RowIdx* rowIdx,
+		const VarValue* rowCoefficients, const size_t count);
 
-/** Returns string that contains pairs of row index and coefficient that is corresponding to it.
+/** Returns string that contains pairs of column index and coefficient of that column in given row.
  *
- * @param rowCoefficients field of Variable class.
+ * @param columnIdx array of columns that have coefficient in row
+ * @param columnCoefficients array of coefficients of corresponding columns
+ * @param count number of coefficients
  * @return
  */
-const std::string getStringVariableRowCoefficients(
-		const std::unordered_map<RowIdx, VarValue>& rowCoefficients);
+const std::string getStringRowColumnCoefficients(const VarIdx* columnIdx,
+		const VarValue* columnCoefficients, const size_t count);
 
 /** Return exact same string that is passed as parameter or "no dimensions" in case passed string is empty.
  *
@@ -81,7 +58,7 @@ const std::string getStringDimensions(const std::string& dimensions);
  * If given list is empty (single variables are 0-dimensional) then "no dimensions" string will be returned.
  * @return
  */
-const std::string getStringDimensions(const std::list<VarDimIdx>& dimensions);
+const std::string getStringDimensions(const IndexTuple<VarDimIdx>& dimensions);
 
 /** Returns string representation of given bound.
  *
@@ -0,0 +1,223 @@
+/*
+ * Basis.cpp
+ *
+ *  Created on: 17 paź 2026
+ *      Author: tomasz
+ */
+
+#include "../include/Basis.hpp"
+
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <limits>
+
+namespace {
+
+/** Appends given value to given buffer as little-endian number.
+ *
+ */
+void writeUnsigned(std::vector<unsigned char>& buffer, uint32_t value) {
+	for (size_t i = 0; i < sizeof(value); i += 1) {
+		buffer.push_back(static_cast<unsigned char>(value & 0xFF));
+		value >>= 8;
+	}
+}
+
+/** Appends given size to given buffer as 32-bit little-endian number.
+ *
+ * @return false if size does not fit in 32 bits (nothing is appended)
+ */
+bool writeSize(std::vector<unsigned char>& buffer, const size_t value) {
+	if (value > std::numeric_limits<uint32_t>::max()) {
+		return false;
+	}
+	writeUnsigned(buffer, static_cast<uint32_t>(value));
+	return true;
+}
+
+/** Reads little-endian number at given position of given buffer and moves position behind it.
+ *
+ * @return false if buffer ends before number
+ */
+bool readUnsigned(const std::vector<unsigned char>& buffer, size_t& position,
+		uint32_t& value) {
+	if (buffer.size() - position < sizeof(value)) {
+		return false;
+	}
+	value = 0;
+	for (size_t i = sizeof(value); i-- > 0;) {
+		value = (value << 8) | buffer[position + i];
+	}
+	position += sizeof(value);
+	return true;
+}
+
+}
+
+//************************************ PRIVATE CONSTANT FIELDS *************************************//
+
+const char Basis::MAGIC[8] { 'S', 'P', 'P', 'B', 'A', 'S', 'I', 'S' };
+
+const uint32_t Basis::VERSION;
+
+//***************************************** CLASS FIELDS *******************************************//
+
+//*************************************** PRIVATE FUNCTIONS ****************************************//
+
+const Basis::Group* Basis::find(const std::vector<Group>& groups,
+		const std::string& name) {
+	for (const Group& group : groups) {
+		if (group.name == name) {
+			return &group;
+		}
+	}
+	return nullptr;
+}
+
+//************************************* PUBLIC CONSTANT FIELDS *************************************//
+
+//************************************ CONSTRUCTOR & DESTRUCTOR ************************************//
+
+Basis::Basis() {
+}
+
+Basis::~Basis() {
+}
+
+//*************************************** PUBLIC FUNCTIONS *****************************************//
+
+void Basis::clear() {
+	this->columnGroups.clear();
+	this->rowGroups.clear();
+}
+
+void Basis::save(const std::string& fileName) const
+		throw (ModelExceptions::BasisFileException) {
+	std::vector<unsigned char> buffer { };
+	bool written { }, valid { };
+	FILE* file { };
+
+	buffer.insert(buffer.end(), MAGIC, MAGIC + sizeof(MAGIC));
+	writeUnsigned(buffer, VERSION);
+	valid = writeSize(buffer, this->columnGroups.size())
+			&& writeSize(buffer, this->rowGroups.size());
+	for (const std::vector<Group>* groups : { &this->columnGroups,
+			&this->rowGroups }) {
+		for (const Group& group : *groups) {
+			valid = valid && writeSize(buffer, group.name.length());
+			buffer.insert(buffer.end(), group.name.begin(), group.name.end());
+			valid = valid && writeSize(buffer, group.extents.size());
+			for (const uint32_t extent : group.extents) {
+				writeUnsigned(buffer, extent);
+			}
+			buffer.insert(buffer.end(), group.status.begin(),
+					group.status.end());
+		}
+	}
+	if (!valid) {
+		// sizes are stored as 32-bit numbers
+		throw ModelExceptions::BasisFileException();
+	}
+
+	file = fopen(fileName.c_str(), "wb");
+	if (file == nullptr) {
+		throw ModelExceptions::BasisFileException();
+	}
+	written = fwrite(buffer.data(), 1, buffer.size(), file) == buffer.size();
+	written = fclose(file) == 0 && written;
+	if (!written) {
+		throw ModelExceptions::BasisFileException();
+	}
+}
+
+void Basis::load(const std::string& fileName)
+		throw (ModelExceptions::BasisFileException) {
+	std::vector<unsigned char> buffer { };
+	std::vector<Group> columnGroups { }, rowGroups { };
+	uint32_t version { }, numberOfColumnGroups { }, numberOfRowGroups { },
+			length { }, extent { };
+	size_t position { sizeof(MAGIC) }, numberOfElements { };
+	bool valid { };
+	long size { };
+	FILE* file { fopen(fileName.c_str(), "rb") };
+
+	if (file == nullptr) {
+		throw ModelExceptions::BasisFileException();
+	}
+	valid = fseek(file, 0, SEEK_END) == 0 && (size = ftell(file)) >= 0
+			&& fseek(file, 0, SEEK_SET) == 0;
+	if (valid) {
+		buffer.resize(size);
+		valid = fread(buffer.data(), 1, buffer.size(), file) == buffer.size();
+	}
+	fclose(file);
+
+	valid = valid && buffer.size() >= sizeof(MAGIC)
+			&& memcmp(buffer.data(), MAGIC, sizeof(MAGIC)) == 0
+			&& readUnsigned(buffer, position, version) && version == VERSION
+			&& readUnsigned(buffer, position, numberOfColumnGroups)
+			&& readUnsigned(buffer, position, numberOfRowGroups);
+	// sum of two 32-bit counts is computed in 64 bits, so it cannot wrap
+	for (uint64_t g = 0;
+			valid && g < (uint64_t) numberOfColumnGroups + numberOfRowGroups;
+			g += 1) {
+		Group group { };
+		valid = readUnsigned(buffer, position, length)
+				&& buffer.size() - position >= length;
+		if (valid) {
+			group.name.assign(buffer.begin() + position,
+					buffer.begin() + position + length);
+			position += length;
+			valid = readUnsigned(buffer, position, length)
+					&& length <= MAX_NUMBER_OF_DIMENSIONS;
+		}
+		numberOfElements = 1;
+		for (uint32_t d = 0; valid && d < length; d += 1) {
+			valid = readUnsigned(buffer, position, extent);
+			group.extents.push_back(extent);
+			numberOfElements *= extent;
+			valid = valid && numberOfElements <= buffer.size();
+		}
+		valid = valid && buffer.size() - position >= numberOfElements
+				&& std::all_of(buffer.begin() + position,
+						buffer.begin() + position + numberOfElements,
+						[](const unsigned char status) {
+							return status <= AT_LOWER_BOUND;
+						});
+		if (valid) {
+			group.status.assign(buffer.begin() + position,
+					buffer.begin() + position + numberOfElements);
+			position += numberOfElements;
+			(g < numberOfColumnGroups ? columnGroups : rowGroups).push_back(
+					std::move(group));
+		}
+	}
+	if (!valid || position != buffer.size()) {
+		throw ModelExceptions::BasisFileException();
+	}
+	this->columnGroups.swap(columnGroups);
+	this->rowGroups.swap(rowGroups);
+}
+
+//*************************************** GETTERS & SETTERS ****************************************//
+
+bool Basis::isEmpty() const {
+	return this->columnGroups.empty() && this->rowGroups.empty();
+}
+
+size_t Basis::getNumberOfColumns() const {
+	size_t numberOfColumns { 0 };
+	for (const Group& group : this->columnGroups) {
+		numberOfColumns += group.status.size();
+	}
+	return numberOfColumns;
+}
+
+size_t Basis::getNumberOfRows() const {
+	size_t numberOfRows { 0 };
+	for (const Group& group : this->rowGroups) {
+		numberOfRows += group.status.size();
+	}
+	return numberOfRows;
+}
@@ -0,0 +1,182 @@
+/*
+ * CoefficientMatrix.cpp
+ *
+ *  Created on: 17 paź 2026
+ *      Author: tomasz
+ */
+
+#include "../include/CoefficientMatrix.hpp"
+
+#include <log4cxx/helpers/messagebuffer.h>
+#include <log4cxx/logger.h>
+
+#include "../include/log/bundle/Bundle.hpp"
+#include "../include/log/utils/LogUtils.hpp"
+
+const log4cxx::LoggerPtr logger(
+		log4cxx::Logger::getLogger("CoefficientMatrix"));
+
+//************************************ PRIVATE CONSTANT FIELDS *************************************//
+
+const size_t CoefficientMatrix::CHUNK_SIZE;
+
+//***************************************** CLASS FIELDS *******************************************//
+
+//*************************************** PRIVATE FUNCTIONS ****************************************//
+
+void CoefficientMatrix::reserveChunks(const size_t numberOfElements) {
+	while (this->chunks.size() * CHUNK_SIZE < numberOfElements) {
+		TRACE(logger, BundleKey::ALLOCATE_CHUNK, this->chunks.size() + 1,
+				CHUNK_SIZE);
+		this->chunks.push_back(new Chunk);
+	}
+}
+
+//************************************* PUBLIC CONSTANT FIELDS *************************************//
+
+//************************************ CONSTRUCTOR & DESTRUCTOR ************************************//
+
+CoefficientMatrix::CoefficientMatrix() :
+		chunks { }, numberOfElements(0), columnMajor { }, rowMajor { } {
+}
+
+CoefficientMatrix::~CoefficientMatrix() {
+	for (Chunk* chunk : this->chunks) {
+		delete chunk;
+	}
+}
+
+//*************************************** PUBLIC FUNCTIONS *****************************************//
+
+void CoefficientMatrix::reserve(const size_t numberOfElements) {
+	reserveChunks(numberOfElements);
+}
+
+void CoefficientMatrix::add(const RowIdx rowIdx, const VarIdx* columnIdx,
+		const VarValue* value, const size_t count) {
+	Chunk* chunk { };
+	size_t i { }, n { };
+	size_t added { 0 };
+	reserveChunks(this->numberOfElements + count);
+	while (added < count) {
+		chunk = this->chunks[this->numberOfElements / CHUNK_SIZE];
+		i = this->numberOfElements % CHUNK_SIZE;
+		n = std::min(CHUNK_SIZE - i, count - added);
+		std::fill_n(chunk->row + i, n, rowIdx);
+		std::copy(columnIdx + added, columnIdx + added + n, chunk->column + i);
+		std::copy(value + added, value + added + n, chunk->value + i);
+		this->numberOfElements += n;
+		added += n;
+	}
+}
+
+size_t CoefficientMatrix::extend(const size_t count) {
+	const size_t position { this->numberOfElements };
+	reserveChunks(this->numberOfElements + count);
+	this->numberOfElements += count;
+	return position;
+}
+
+void CoefficientMatrix::assign(const size_t position, const RowIdx* rowIdx,
+		const VarIdx* columnIdx, const VarValue* value, const size_t count) {
+	Chunk* chunk { };
+	size_t i { }, n { };
+	size_t assigned { 0 };
+	while (assigned < count) {
+		chunk = this->chunks[(position + assigned) / CHUNK_SIZE];
+		i = (position + assigned) % CHUNK_SIZE;
+		n = std::min(CHUNK_SIZE - i, count - assigned);
+		std::copy(rowIdx + assigned, rowIdx + assigned + n, chunk->row + i);
+		std::copy(columnIdx + assigned, columnIdx + assigned + n,
+				chunk->column + i);
+		std::copy(value + assigned, value + assigned + n, chunk->value + i);
+		assigned += n;
+	}
+}
+
+size_t CoefficientMatrix::remove(const bool columnMajor,
+		const size_t firstIdx, const size_t count, const size_t position) {
+	const Chunk* source { };
+	Chunk* target { };
+	size_t i { }, k { 0 }, removedBefore { 0 };
+	VarIdx columnIdx { };
+	RowIdx rowIdx { };
+	for (size_t e = 0; e < this->numberOfElements; e += 1) {
+		source = this->chunks[e / CHUNK_SIZE];
+		i = e % CHUNK_SIZE;
+		columnIdx = source->column[i];
+		rowIdx = source->row[i];
+		const size_t idx { columnMajor ? (size_t) columnIdx : (size_t) rowIdx };
+		if (firstIdx <= idx && idx < firstIdx + count) {
+			removedBefore += e < position;
+			continue;
+		}
+		if (idx >= firstIdx + count) {
+			if (columnMajor) {
+				columnIdx -= (VarIdx) count;
+			} else {
+				rowIdx -= (RowIdx) count;
+			}
+		}
+		target = this->chunks[k / CHUNK_SIZE];
+		target->row[k % CHUNK_SIZE] = rowIdx;
+		target->column[k % CHUNK_SIZE] = columnIdx;
+		target->value[k % CHUNK_SIZE] = source->value[i];
+		k += 1;
+	}
+	DEBUG(logger, BundleKey::REMOVE_ELEMENTS, this->numberOfElements - k,
+			columnMajor ? "columns" : "rows", firstIdx, firstIdx + count);
+	this->numberOfElements = k;
+	while (this->chunks.size() * CHUNK_SIZE >= k + CHUNK_SIZE) {
+		delete this->chunks.back();
+		this->chunks.pop_back();
+	}
+	releaseCache();
+	return removedBefore;
+}
+
+void CoefficientMatrix::clear() {
+	for (Chunk* chunk : this->chunks) {
+		delete chunk;
+	}
+	this->chunks.clear();
+	this->numberOfElements = 0;
+	releaseCache();
+}
+
+ColumnView CoefficientMatrix::getColumn(const VarIdx columnIdx,
+		const VarIdx numberOfColumns, const RowIdx numberOfRows) const {
+	refresh(this->columnMajor, true, numberOfColumns, numberOfRows);
+	const size_t begin { this->columnMajor.start[columnIdx] };
+	return ColumnView { this->columnMajor.index.data() + begin,
+			this->columnMajor.value.data() + begin,
+			this->columnMajor.start[columnIdx + 1] - begin };
+}
+
+RowView CoefficientMatrix::getRow(const RowIdx rowIdx,
+		const VarIdx numberOfColumns, const RowIdx numberOfRows) const {
+	refresh(this->rowMajor, false, numberOfRows, numberOfColumns);
+	const size_t begin { this->rowMajor.start[rowIdx] };
+	return RowView { this->rowMajor.index.data() + begin,
+			this->rowMajor.value.data() + begin, this->rowMajor.start[rowIdx
+					+ 1] - begin };
+}
+
+void CoefficientMatrix::releaseCache() {
+	std::vector<size_t>().swap(this->columnMajor.start);
+	std::vector<RowIdx>().swap(this->columnMajor.index);
+	std::vector<VarValue>().swap(this->columnMajor.value);
+	std::vector<size_t>().swap(this->rowMajor.start);
+	std::vector<VarIdx>().swap(this->rowMajor.index);
+	std::vector<VarValue>().swap(this->rowMajor.value);
+	this->columnMajor.numberOfElements = 0;
+	this->columnMajor.majorSize = 0;
+	this->rowMajor.numberOfElements = 0;
+	this->rowMajor.majorSize = 0;
+}
+
+//*************************************** GETTERS & SETTERS ****************************************//
+
+size_t CoefficientMatrix::getNumberOfElements() const {
+	return this->numberOfElements;
+}
@@ -0,0 +1,86 @@
+/*
+ * LinearExpr.cpp
+ *
+ *  Created on: 17 paź 2026
+ *      Author: tomasz
+ */
+
+#include "../include/LinearExpr.hpp"
+
+#include <algorithm>
+
+#include "../include/utils/Utils.hpp"
+
+//************************************ PRIVATE CONSTANT FIELDS *************************************//
+
+//***************************************** CLASS FIELDS *******************************************//
+
+//*************************************** PRIVATE FUNCTIONS ****************************************//
+
+//************************************* PUBLIC CONSTANT FIELDS *************************************//
+
+//************************************ CONSTRUCTOR & DESTRUCTOR ************************************//
+
+LinearExprBuffer::LinearExprBuffer() :
+		terms { }, columnIdx { }, value { }, constant(0) {
+}
+
+LinearExprBuffer::~LinearExprBuffer() {
+}
+
+//*************************************** PUBLIC FUNCTIONS *****************************************//
+
+LinearExprBuffer& LinearExprBuffer::getThreadLocal() {
+	thread_local LinearExprBuffer buffer { };
+	buffer.clear();
+	return buffer;
+}
+
+void LinearExprBuffer::clear() {
+	this->terms.clear();
+	this->columnIdx.clear();
+	this->value.clear();
+	this->constant = 0;
+}
+
+void LinearExprBuffer::mergeDuplicates() {
+	std::sort(this->terms.begin(), this->terms.end(),
+			[](const Term& a, const Term& b) {
+				return a.columnIdx < b.columnIdx;
+			});
+	this->columnIdx.clear();
+	this->value.clear();
+	for (const Term& term : this->terms) {
+		if (!this->columnIdx.empty()
+				&& this->columnIdx.back() == term.columnIdx) {
+			this->value.back() += term.value;
+		} else {
+			this->columnIdx.push_back(term.columnIdx);
+			this->value.push_back(term.value);
+		}
+	}
+}
+
+//*************************************** GETTERS & SETTERS ****************************************//
+
+const VarIdx* LinearExprBuffer::getColumnIdx() const {
+	return this->columnIdx.data();
+}
+
+const VarValue* LinearExprBuffer::getValues() const {
+	return this->value.data();
+}
+
+size_t LinearExprBuffer::getNumberOfTerms() const {
+	return this->columnIdx.size();
+}
+
+VarValue LinearExprBuffer::getConstant() const {
+	return this->constant;
+}
+
+VarValue LinearExprBuffer::getRowBound(const VarValue bound) const {
+	return bound == Utils::getUnbounded(Bounds::LOWER)
+			|| bound == Utils::getUnbounded(Bounds::UPPER) ?
+			bound : bound - this->constant;
+}
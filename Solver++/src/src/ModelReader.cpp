@@ -0,0 +1,1371 @@
+/*
+ * ModelReader.cpp
+ *
+ *  Created on: 17 paź 2026
+ *      Author: tomasz
+ */
+
+#include "../include/ModelReader.hpp"
+
+#include <log4cxx/helpers/messagebuffer.h>
+#include <log4cxx/logger.h>
+#include <strings.h>
+#include <zlib.h>
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <exception>
+#include <limits>
+
+#include "../include/log/bundle/Bundle.hpp"
+#include "../include/log/utils/LogUtils.hpp"
+#include "../include/OsiProblemInstance.hpp"
+#include "../include/utils/ThreadUtils.hpp"
+
+const log4cxx::LoggerPtr logger(log4cxx::Logger::getLogger("ModelReader"));
+
+namespace {
+
+inline bool isBlank(const char c) {
+	return c == ' ' || c == '\t' || c == '\r';
+}
+
+inline bool isSeparator(const char c) {
+	return isBlank(c) || c == '\n';
+}
+
+inline const char* skipBlanks(const char* pos, const char* end) {
+	while (pos < end && isBlank(*pos)) {
+		pos += 1;
+	}
+	return pos;
+}
+
+/** Returns the first character of the next line (or end).
+ *
+ */
+inline const char* nextLine(const char* pos, const char* end) {
+	const char* newLine { static_cast<const char*>(memchr(pos, '\n',
+			end - pos)) };
+	return newLine != nullptr ? newLine + 1 : end;
+}
+
+/** Skips blanks, new lines and comments of LP file (from '\' to the end of line).
+ *
+ */
+inline const char* skipSpaces(const char* pos, const char* end) {
+	while (pos < end) {
+		if (isBlank(*pos) || *pos == '\n') {
+			pos += 1;
+		} else if (*pos == '\\') {
+			pos = nextLine(pos, end);
+		} else {
+			break;
+		}
+	}
+	return pos;
+}
+
+/** Checks if given character may be a part of name of LP file.
+ *
+ */
+inline bool isLpNameCharacter(const char c) {
+	return c > ' ' && c != '+' && c != '-' && c != '<' && c != '>' && c != '='
+			&& c != ':' && c != '\\' && c != '*' && c != '^';
+}
+
+/** Returns the first character after name of LP file that begins at given position (pos if there is no name).
+ *
+ */
+inline const char* skipLpName(const char* pos, const char* end) {
+	const char* nameEnd { pos };
+	if (pos < end && (('0' <= *pos && *pos <= '9') || *pos == '.')) {
+		return pos;
+	}
+	while (nameEnd < end && isLpNameCharacter(*nameEnd)) {
+		nameEnd += 1;
+	}
+	return nameEnd;
+}
+
+inline bool equals(const char* text, const size_t length,
+		const char* keyword) {
+	return strlen(keyword) == length && memcmp(text, keyword, length) == 0;
+}
+
+inline bool equalsIgnoreCase(const char* text, const size_t length,
+		const char* keyword) {
+	return strlen(keyword) == length && strncasecmp(text, keyword, length) == 0;
+}
+
+/** Parses comparison operator of LP file ("<", "<=", "=<", ">", ">=", "=>" or "="),
+ * returns nullptr if there is none.
+ *
+ * @param op '<', '>' or '='
+ */
+inline const char* parseComparison(const char* pos, const char* end,
+		char& op) {
+	if (pos == end || (*pos != '<' && *pos != '>' && *pos != '=')) {
+		return nullptr;
+	}
+	op = *pos;
+	pos += 1;
+	if (pos < end && op == '=' && (*pos == '<' || *pos == '>')) {
+		op = *pos;
+		pos += 1;
+	} else if (pos < end && op != '=' && *pos == '=') {
+		pos += 1;
+	}
+	return pos;
+}
+
+/** Parses signed number of LP file (also "inf" and "infinity"), returns nullptr if there is none.
+ *
+ */
+inline const char* parseLpValue(const char* pos, const char* end,
+		double& value, const double infinity) {
+	bool negative { false };
+	const char* wordEnd { };
+	while (pos < end && (*pos == '+' || *pos == '-')) {
+		negative = negative != (*pos == '-');
+		pos = skipSpaces(pos + 1, end);
+	}
+	if (pos < end && (('0' <= *pos && *pos <= '9') || *pos == '.')) {
+		pos = StringUtils::parseNumber(pos, end, value);
+	} else {
+		wordEnd = skipLpName(pos, end);
+		if (!equalsIgnoreCase(pos, wordEnd - pos, "inf")
+				&& !equalsIgnoreCase(pos, wordEnd - pos, "infinity")) {
+			return nullptr;
+		}
+		value = infinity;
+		pos = wordEnd;
+	}
+	value = negative ? -value : value;
+	return pos;
+}
+
+/** Bounds given value by infinity of the solver.
+ *
+ */
+inline double limit(const double value, const double infinity) {
+	return value >= infinity ? infinity : (value <= -infinity ? -infinity : value);
+}
+
+}
+
+//************************************ PRIVATE CONSTANT FIELDS *************************************//
+
+const size_t ModelReader::MIN_PIECE_SIZE;
+
+const VarIdx ModelReader::MAX_GROUP_SPARSITY;
+
+const VarIdx ModelReader::MIN_SPARSE_GROUP;
+
+const char* const ModelReader::UNNAMED_ROWS { "c" };
+
+//***************************************** CLASS FIELDS *******************************************//
+
+//*************************************** PRIVATE FUNCTIONS ****************************************//
+
+void ModelReader::fail(const char* position) const
+		throw (ModelExceptions::ModelFileException) {
+	const char* lineBegin { position };
+	size_t lineNumber { 1 };
+	std::string line { };
+	while (lineBegin > this->begin && *(lineBegin - 1) != '\n') {
+		lineBegin -= 1;
+	}
+	lineNumber += std::count(this->begin, lineBegin, '\n');
+	line.assign(lineBegin,
+			std::min(nextLine(lineBegin, this->end), lineBegin + 80));
+	while (!line.empty() && (line.back() == '\n' || isBlank(line.back()))) {
+		line.pop_back();
+	}
+	FATAL(logger, BundleKey::READ_MODEL_INVALID_LINE, lineNumber,
+			this->fileName.c_str(), line.c_str());
+	throw ModelExceptions::ModelFileException();
+}
+
+size_t ModelReader::tokenize(const char* position, const char* end,
+		Token* tokens, const size_t maxNumberOfTokens) {
+	size_t numberOfTokens { 0 };
+	const char* tokenBegin { };
+	while (true) {
+		while (position < end && isSeparator(*position)) {
+			position += 1;
+		}
+		if (position == end) {
+			return numberOfTokens;
+		} else if (numberOfTokens == maxNumberOfTokens) {
+			return maxNumberOfTokens + 1;
+		}
+		tokenBegin = position;
+		while (position < end && !isSeparator(*position)) {
+			position += 1;
+		}
+		tokens[numberOfTokens++] = Token { tokenBegin, (size_t) (position
+				- tokenBegin) };
+	}
+}
+
+void ModelReader::open(const std::string& fileName)
+		throw (ModelExceptions::ModelFileException) {
+	const static size_t BLOCK_SIZE { 1 << 20 };
+	gzFile compressedFile { };
+	size_t size { 0 };
+	int count { };
+
+	try {
+		this->mapping = TensorFileUtils::map(fileName);
+	} catch (const ParameterModelExceptions::TensorFileException& e) {
+		throw ModelExceptions::ModelFileException();
+	}
+	this->begin = static_cast<const char*>(this->mapping.address);
+	this->end = this->begin + this->mapping.size;
+
+	// gzip stream (e.g. written by Solver::writeModel()) cannot be parsed in place
+	if (this->mapping.size >= 2 && (unsigned char) this->begin[0] == 0x1f
+			&& (unsigned char) this->begin[1] == 0x8b) {
+		TensorFileUtils::unmap(this->mapping);
+		compressedFile = gzopen(fileName.c_str(), "rb");
+		if (compressedFile == nullptr) {
+			throw ModelExceptions::ModelFileException();
+		}
+		gzbuffer(compressedFile, BLOCK_SIZE);
+		do {
+			this->content.resize(size + BLOCK_SIZE);
+			count = gzread(compressedFile, this->content.data() + size,
+					BLOCK_SIZE);
+			size += count > 0 ? count : 0;
+		} while (count > 0);
+		gzclose(compressedFile);
+		if (count < 0) {
+			throw ModelExceptions::ModelFileException();
+		}
+		this->content.resize(size);
+		this->begin = this->content.data();
+		this->end = this->begin + size;
+	}
+}
+
+void ModelReader::close() {
+	TensorFileUtils::unmap(this->mapping);
+	std::vector<char>().swap(this->content);
+}
+
+const char* ModelReader::parseHeader(const char* line,
+		SectionType& type) const {
+	const static struct {
+		const char* keyword;
+		SectionType type;
+	} MPS_KEYWORDS[] = { { "NAME", SectionType::NAME }, { "OBJSENSE",
+			SectionType::OBJSENSE }, { "ROWS", SectionType::ROWS }, { "COLUMNS",
+			SectionType::COLUMNS }, { "RHS", SectionType::RHS }, { "RANGES",
+			SectionType::RANGES }, { "BOUNDS", SectionType::BOUNDS }, {
+			"ENDATA", SectionType::END } }, LP_KEYWORDS[] = { { "minimize",
+			SectionType::MINIMIZE }, { "minimise", SectionType::MINIMIZE }, {
+			"minimum", SectionType::MINIMIZE }, { "min", SectionType::MINIMIZE }, {
+			"maximize", SectionType::MAXIMIZE }, { "maximise",
+			SectionType::MAXIMIZE }, { "maximum", SectionType::MAXIMIZE }, {
+			"max", SectionType::MAXIMIZE }, { "subject", SectionType::CONSTRAINTS },
+			{ "such", SectionType::CONSTRAINTS }, { "st",
+					SectionType::CONSTRAINTS }, { "s.t.",
+					SectionType::CONSTRAINTS }, { "st.",
+					SectionType::CONSTRAINTS }, { "bounds", SectionType::BOUNDS }, {
+					"bound", SectionType::BOUNDS }, { "general",
+					SectionType::GENERAL }, { "generals", SectionType::GENERAL }, {
+					"gen", SectionType::GENERAL }, { "integer",
+					SectionType::GENERAL }, { "integers", SectionType::GENERAL }, {
+					"binary", SectionType::BINARY }, { "binaries",
+					SectionType::BINARY }, { "bin", SectionType::BINARY }, {
+					"semi-continuous", SectionType::UNSUPPORTED }, { "semis",
+					SectionType::UNSUPPORTED }, { "semi",
+					SectionType::UNSUPPORTED }, { "sos", SectionType::UNSUPPORTED },
+			{ "end", SectionType::END } };
+	const char* wordBegin { line };
+	const char* wordEnd { };
+	const char* nextWordEnd { };
+
+	if (this->format == ModelFormat::MPS) {
+		// data lines of MPS file begin with blank, comments with '*'
+		if (line == this->end || isBlank(*line) || *line == '\n'
+				|| *line == '*') {
+			return nullptr;
+		}
+		wordEnd = line;
+		while (wordEnd < this->end && !isSeparator(*wordEnd)) {
+			wordEnd += 1;
+		}
+		type = SectionType::UNSUPPORTED;
+		for (const auto& keyword : MPS_KEYWORDS) {
+			if (equals(line, wordEnd - line, keyword.keyword)) {
+				type = keyword.type;
+			}
+		}
+		return wordEnd;
+	}
+
+	wordBegin = skipBlanks(line, this->end);
+	wordEnd = wordBegin;
+	while (wordEnd < this->end
+			&& (isalpha(*wordEnd) || *wordEnd == '.' || *wordEnd == '-')) {
+		wordEnd += 1;
+	}
+	// "name:" begins constraint, even if name is a keyword
+	if (wordEnd == wordBegin
+			|| (skipBlanks(wordEnd, this->end) < this->end
+					&& *skipBlanks(wordEnd, this->end) == ':')
+			|| (wordEnd < this->end && isLpNameCharacter(*wordEnd))) {
+		return nullptr;
+	}
+	for (const auto& keyword : LP_KEYWORDS) {
+		if (equalsIgnoreCase(wordBegin, wordEnd - wordBegin, keyword.keyword)) {
+			type = keyword.type;
+			if (equalsIgnoreCase(wordBegin, wordEnd - wordBegin, "subject")
+					|| equalsIgnoreCase(wordBegin, wordEnd - wordBegin, "such")) {
+				wordBegin = skipBlanks(wordEnd, this->end);
+				nextWordEnd = wordBegin;
+				while (nextWordEnd < this->end && isalpha(*nextWordEnd)) {
+					nextWordEnd += 1;
+				}
+				if (!equalsIgnoreCase(wordBegin, nextWordEnd - wordBegin, "to")
+						&& !equalsIgnoreCase(wordBegin,
+								nextWordEnd - wordBegin, "that")) {
+					return nullptr;
+				}
+				wordEnd = nextWordEnd;
+			}
+			return wordEnd;
+		}
+	}
+	return nullptr;
+}
+
+std::vector<ModelReader::Section> ModelReader::findSections() const {
+	const size_t size = this->end - this->begin;
+	const unsigned int threads { (unsigned int) std::min(
+			(size_t) this->numberOfThreads, size / MIN_PIECE_SIZE + 1) };
+	std::vector<std::vector<Section>> found(threads);
+	std::vector<Section> sections { };
+
+	ThreadUtils::runWorkers(threads,
+			[&](const unsigned int t) {
+				const char* line {this->begin + size * t / threads};
+				const char* rangeEnd {this->begin + size * (t + 1) / threads};
+				const char* contentBegin {};
+				SectionType type {};
+				if (line != this->begin && *(line - 1) != '\n') {
+					line = nextLine(line, this->end);
+				}
+				while (line < rangeEnd) {
+					contentBegin = parseHeader(line, type);
+					if (contentBegin != nullptr) {
+						found[t].push_back(Section {type, line, contentBegin, this->end});
+					}
+					line = nextLine(line, this->end);
+				}
+			});
+
+	for (std::vector<Section>& part : found) {
+		for (Section& section : part) {
+			if (!sections.empty()) {
+				sections.back().end = section.header;
+			}
+			sections.push_back(section);
+		}
+	}
+	return sections;
+}
+
+template<typename Predicate>
+void ModelReader::split(const char* begin, const char* end,
+		Predicate isPieceBegin) {
+	const size_t size = end - begin;
+	const size_t numberOfPieces { std::min((size_t) this->numberOfThreads,
+			size / MIN_PIECE_SIZE + 1) };
+	const char* pieceBegin { begin };
+	const char* pieceEnd { };
+
+	this->pieces.assign(this->numberOfThreads, Piece { });
+	for (size_t p = 0; p < this->numberOfThreads; p += 1) {
+		pieceEnd = end;
+		if (p + 1 < numberOfPieces) {
+			pieceEnd = std::max(pieceBegin, begin + size * (p + 1) / numberOfPieces);
+			if (pieceEnd != begin && *(pieceEnd - 1) != '\n') {
+				pieceEnd = nextLine(pieceEnd, end);
+			}
+			while (pieceEnd < end && !isPieceBegin(pieceEnd)) {
+				pieceEnd = nextLine(pieceEnd, end);
+			}
+		}
+		this->pieces[p].begin = pieceBegin;
+		this->pieces[p].end = pieceEnd;
+		this->pieces[p].marker = -1;
+		pieceBegin = pieceEnd;
+	}
+}
+
+template<typename Worker>
+void ModelReader::forEachPiece(Worker worker) {
+	std::vector<std::exception_ptr> exceptions(this->pieces.size());
+	if (this->pieces.empty()) {
+		return;
+	}
+	// there are at most numberOfThreads pieces (@see split())
+	ThreadUtils::runWorkers(static_cast<unsigned int>(this->pieces.size()),
+			[&](const unsigned int p) {
+		try {
+			worker(this->pieces[p], p);
+		} catch (...) {
+			exceptions[p] = std::current_exception();
+		}
+	});
+	for (std::exception_ptr& exception : exceptions) {
+		if (exception) {
+			std::rethrow_exception(exception);
+		}
+	}
+}
+
+void ModelReader::parseName(const Token& name,
+		StringUtils::Definition<VarDimIdx>& definition) const {
+	if (this->format == ModelFormat::LP
+			&& StringUtils::parseDefinition(name.begin, name.length, definition,
+					"()")) {
+		return;
+	}
+	if (!StringUtils::parseDefinition(name.begin, name.length, definition)) {
+		definition.name = name.begin;
+		definition.nameLength = name.length;
+		definition.indexes.clear();
+	}
+}
+
+void ModelReader::addName(Folder& folder,
+		const StringUtils::Definition<VarDimIdx>& definition)
+				throw (ModelExceptions::ModelFileException) {
+	thread_local std::string groupName { };
+	Group* group { };
+	std::unordered_map<std::string, size_t>::const_iterator it { };
+
+	if (folder.hint < folder.groups.size()
+			&& folder.groups[folder.hint].name.length() == definition.nameLength
+			&& memcmp(folder.groups[folder.hint].name.data(), definition.name,
+					definition.nameLength) == 0) {
+		group = &folder.groups[folder.hint];
+	} else {
+		groupName.assign(definition.name, definition.nameLength);
+		it = folder.positions.find(groupName);
+		if (it != folder.positions.end()) {
+			folder.hint = it->second;
+		} else {
+			folder.hint = folder.groups.size();
+			folder.positions.emplace(groupName, folder.hint);
+			folder.groups.push_back(Group { groupName, definition.indexes, 0, 0,
+					VarDimensionTable { }, ValueType::DOUBLE });
+		}
+		group = &folder.groups[folder.hint];
+	}
+
+	if (group->extents.size() != definition.indexes.size()) {
+		FATAL(logger, BundleKey::READ_MODEL_INVALID_GROUP,
+				group->name.c_str());
+		throw ModelExceptions::ModelFileException();
+	}
+	for (VarDimIdx d = 0; d < definition.indexes.size(); d += 1) {
+		group->extents[d] = std::max(group->extents[d], definition.indexes[d]);
+	}
+	group->numberOfNames += 1;
+}
+
+void ModelReader::addName(Folder& folder, const Token& name)
+		throw (ModelExceptions::ModelFileException) {
+	StringUtils::Definition<VarDimIdx> definition { };
+	parseName(name, definition);
+	addName(folder, definition);
+}
+
+void ModelReader::fold(Folder& folder)
+		throw (ModelExceptions::ModelFileException) {
+	const uint64_t maxNumberOfElements { std::numeric_limits<VarIdx>::max() };
+	uint64_t numberOfElements { 0 }, groupSize { };
+
+	for (Group& group : folder.groups) {
+		groupSize = 1;
+		for (VarDimIdx d = 0; d < group.extents.size()
+				&& groupSize <= maxNumberOfElements; d += 1) {
+			groupSize *= group.extents[d];
+		}
+		if (groupSize > maxNumberOfElements - numberOfElements) {
+			FATAL(logger, BundleKey::READ_MODEL_INVALID_GROUP,
+					group.name.c_str());
+			throw ModelExceptions::ModelFileException();
+		} else if (groupSize > MIN_SPARSE_GROUP
+				&& groupSize / MAX_GROUP_SPARSITY > group.numberOfNames) {
+			WARN(logger, BundleKey::READ_MODEL_SPARSE_GROUP, group.name.c_str(),
+					(size_t) groupSize, group.numberOfNames);
+		}
+		group.beginIdx = (VarIdx) numberOfElements;
+		group.dimensions = VarDimensionTable { group.extents };
+		numberOfElements += groupSize;
+	}
+	folder.numberOfElements = (VarIdx) numberOfElements;
+}
+
+bool ModelReader::findName(const Folder& folder, const Token& name,
+		VarIdx& idx, size_t& hint) const {
+	thread_local std::string groupName { };
+	StringUtils::Definition<VarDimIdx> definition { };
+	std::unordered_map<std::string, size_t>::const_iterator it { };
+	const Group* group { };
+
+	parseName(name, definition);
+	if (hint < folder.groups.size()
+			&& folder.groups[hint].name.length() == definition.nameLength
+			&& memcmp(folder.groups[hint].name.data(), definition.name,
+					definition.nameLength) == 0) {
+		group = &folder.groups[hint];
+	} else {
+		groupName.assign(definition.name, definition.nameLength);
+		it = folder.positions.find(groupName);
+		if (it == folder.positions.end()) {
+			return false;
+		}
+		hint = it->second;
+		group = &folder.groups[hint];
+	}
+	if (group->dimensions.isOutOfBounds(definition.indexes)) {
+		return false;
+	}
+	idx = group->beginIdx + group->dimensions.linearize(definition.indexes);
+	return true;
+}
+
+void ModelReader::initializeColumns() {
+	this->columnLowerBounds.assign(this->columns.numberOfElements, 0);
+	this->columnUpperBounds.assign(this->columns.numberOfElements,
+			this->infinity);
+	this->columnObjective.assign(this->columns.numberOfElements, 0);
+	this->columnTypes.assign(this->columns.numberOfElements, -1);
+}
+
+void ModelReader::finishColumns() {
+	signed char type { };
+	bool mixed { };
+	for (Group& group : this->columns.groups) {
+		type = -1;
+		mixed = false;
+		for (VarIdx j = group.beginIdx;
+				j < group.beginIdx + group.dimensions.getNumberOfElements(); j +=
+						1) {
+			if (this->columnTypes[j] < 0) {
+				continue;
+			} else if (type < 0) {
+				type = this->columnTypes[j];
+			} else if (this->columnTypes[j] != type) {
+				mixed = true;
+			}
+		}
+		group.type = type < 0 ? ValueType::DOUBLE : (ValueType) type;
+		if (mixed) {
+			WARN(logger, BundleKey::READ_MODEL_MIXED_TYPES, group.name.c_str());
+		}
+	}
+	if (this->maximize) {
+		WARN(logger, BundleKey::READ_MODEL_MAXIMIZE,
+				this->columnObjective.size());
+		for (VarValue& coefficient : this->columnObjective) {
+			coefficient = -coefficient;
+		}
+	}
+}
+
+void ModelReader::resolveColumns() {
+	auto resolve = [this](Piece& piece, const size_t) {
+		size_t hint {0};
+		piece.columnIdx.resize(piece.columnNames.size());
+		for (size_t k = 0; k < piece.columnNames.size(); k += 1) {
+			if (!findName(this->columns, piece.columnNames[k], piece.columnIdx[k], hint)) {
+				fail(piece.columnNames[k].begin);
+			}
+		}
+		for (VarIdx& columnIdx : piece.elementColumnIdx) {
+			columnIdx = piece.columnIdx[columnIdx];
+		}
+	};
+
+	forEachPiece(resolve);
+	resolve(this->objectivePiece, 0);
+
+	this->pieces.push_back(std::move(this->objectivePiece));
+	for (const Piece& piece : this->pieces) {
+		for (size_t k = 0; k < piece.columnIdx.size(); k += 1) {
+			if (this->columnTypes[piece.columnIdx[k]] < 0) {
+				this->columnTypes[piece.columnIdx[k]] =
+						!piece.columnMarkers.empty()
+								&& piece.columnMarkers[k] == 1 ?
+								ValueType::INTEGER : ValueType::DOUBLE;
+			}
+		}
+		for (const std::pair<VarIdx, VarValue>& coefficient : piece.objective) {
+			this->columnObjective[piece.columnIdx[coefficient.first]] +=
+					coefficient.second;
+		}
+	}
+	this->objectivePiece = std::move(this->pieces.back());
+	this->pieces.pop_back();
+}
+
+void ModelReader::parseMpsRows(const Section& section) {
+	Token tokens[2] { };
+	std::vector<std::pair<Token, char>> entries { };
+	size_t hint { 0 };
+	VarIdx rowIdx { };
+	char type { };
+
+	for (const char* line = section.begin; line < section.end;
+			line = nextLine(line, section.end)) {
+		const size_t numberOfTokens { tokenize(line,
+				nextLine(line, section.end), tokens, 2) };
+		if (numberOfTokens == 0 || *tokens[0].begin == '*') {
+			continue;
+		}
+		type = (char) toupper(*tokens[0].begin);
+		if (numberOfTokens != 2 || tokens[0].length != 1
+				|| (type != 'N' && type != 'E' && type != 'L' && type != 'G')) {
+			fail(line);
+		}
+		if (type == 'N' && this->objectiveName.begin == nullptr) {
+			this->objectiveName = tokens[1];
+		} else {
+			addName(this->rows, tokens[1]);
+			entries.push_back(std::make_pair(tokens[1], type));
+		}
+	}
+
+	fold(this->rows);
+	this->rowTypes.assign(this->rows.numberOfElements, 'N');
+	this->rowRhs.assign(this->rows.numberOfElements, 0);
+	this->rowRanges.assign(this->rows.numberOfElements, NAN);
+	for (const std::pair<Token, char>& entry : entries) {
+		findName(this->rows, entry.first, rowIdx, hint);
+		this->rowTypes[rowIdx] = entry.second;
+	}
+}
+
+void ModelReader::parseMpsColumns(Piece& piece) const {
+	Token tokens[5] { };
+	Token previous { nullptr, 0 };
+	size_t hint { 0 }, numberOfTokens { };
+	VarIdx rowIdx { };
+	VarValue value { };
+	signed char marker { -1 };
+
+	for (const char* line = piece.begin; line < piece.end;
+			line = nextLine(line, piece.end)) {
+		numberOfTokens = tokenize(line, nextLine(line, piece.end), tokens, 5);
+		if (numberOfTokens == 0 || *tokens[0].begin == '*') {
+			continue;
+		}
+		if (numberOfTokens == 3
+				&& equals(tokens[1].begin, tokens[1].length, "'MARKER'")) {
+			if (equals(tokens[2].begin, tokens[2].length, "'INTORG'")) {
+				marker = 1;
+			} else if (equals(tokens[2].begin, tokens[2].length, "'INTEND'")) {
+				marker = 0;
+			} else {
+				fail(line);
+			}
+			piece.marker = marker;
+			continue;
+		}
+		if (numberOfTokens != 3 && numberOfTokens != 5) {
+			fail(line);
+		}
+		// lines of the same column follow each other - new name starts next run of column
+		if (previous.length != tokens[0].length
+				|| memcmp(previous.begin, tokens[0].begin, tokens[0].length) != 0) {
+			if (piece.columnNames.size() > std::numeric_limits<VarIdx>::max()) {
+				fail(line);
+			}
+			piece.columnNames.push_back(tokens[0]);
+			piece.columnMarkers.push_back(marker);
+			previous = tokens[0];
+		}
+		for (size_t k = 1; k < numberOfTokens; k += 2) {
+			if (StringUtils::parseNumber(tokens[k + 1].begin,
+					tokens[k + 1].begin + tokens[k + 1].length, value)
+					!= tokens[k + 1].begin + tokens[k + 1].length) {
+				fail(line);
+			}
+			if (tokens[k].length == this->objectiveName.length
+					&& memcmp(tokens[k].begin, this->objectiveName.begin,
+							tokens[k].length) == 0) {
+				piece.objective.push_back(
+						std::make_pair(
+								static_cast<VarIdx>(piece.columnNames.size() - 1),
+								value));
+			} else if (!findName(this->rows, tokens[k], rowIdx, hint)) {
+				fail(line);
+			} else if (value != 0) {
+				piece.elementRowIdx.push_back(rowIdx);
+				piece.elementColumnIdx.push_back(
+						static_cast<VarIdx>(piece.columnNames.size() - 1));
+				piece.elementValue.push_back(value);
+			}
+		}
+	}
+}
+
+void ModelReader::parseMpsValues(const Section& section,
+		std::vector<VarValue>& values) const {
+	Token tokens[5] { };
+	size_t hint { 0 }, numberOfTokens { };
+	VarIdx rowIdx { };
+	VarValue value { };
+
+	for (const char* line = section.begin; line < section.end;
+			line = nextLine(line, section.end)) {
+		numberOfTokens = tokenize(line, nextLine(line, section.end), tokens, 5);
+		if (numberOfTokens == 0 || *tokens[0].begin == '*') {
+			continue;
+		}
+		if (numberOfTokens > 5 || numberOfTokens < 2) {
+			fail(line);
+		}
+		// name of set of values is optional
+		for (size_t k = numberOfTokens % 2; k < numberOfTokens; k += 2) {
+			if (StringUtils::parseNumber(tokens[k + 1].begin,
+					tokens[k + 1].begin + tokens[k + 1].length, value)
+					!= tokens[k + 1].begin + tokens[k + 1].length) {
+				fail(line);
+			}
+			// constant of objective function is ignored
+			if (tokens[k].length == this->objectiveName.length
+					&& memcmp(tokens[k].begin, this->objectiveName.begin,
+							tokens[k].length) == 0) {
+				continue;
+			} else if (!findName(this->rows, tokens[k], rowIdx, hint)) {
+				fail(line);
+			}
+			values[rowIdx] = limit(value, this->infinity);
+		}
+	}
+}
+
+void ModelReader::parseMpsBounds(const Section& section) {
+	Token tokens[4] { };
+	size_t hint { 0 }, numberOfTokens { };
+	VarIdx columnIdx { };
+	VarValue value { };
+	bool hasValue { };
+	const Token* name { };
+	const Token* type { };
+
+	for (const char* line = section.begin; line < section.end;
+			line = nextLine(line, section.end)) {
+		numberOfTokens = tokenize(line, nextLine(line, section.end), tokens, 4);
+		if (numberOfTokens == 0 || *tokens[0].begin == '*') {
+			continue;
+		}
+		type = &tokens[0];
+		// name of set of bounds is optional, types FR, MI, PL (and sometimes BV) have no value
+		hasValue = !equals(type->begin, type->length, "FR")
+				&& !equals(type->begin, type->length, "MI")
+				&& !equals(type->begin, type->length, "PL");
+		if (equals(type->begin, type->length, "BV") && numberOfTokens == 3) {
+			hasValue = StringUtils::parseNumber(tokens[2].begin,
+					tokens[2].begin + tokens[2].length, value)
+					== tokens[2].begin + tokens[2].length;
+		} else if (equals(type->begin, type->length, "BV")) {
+			hasValue = numberOfTokens == 4;
+		}
+		if (numberOfTokens > 4 || numberOfTokens < 2u + hasValue) {
+			fail(line);
+		}
+		name = &tokens[numberOfTokens - 1 - hasValue];
+		if ((hasValue
+				&& StringUtils::parseNumber(tokens[numberOfTokens - 1].begin,
+						tokens[numberOfTokens - 1].begin
+								+ tokens[numberOfTokens - 1].length, value)
+						!= tokens[numberOfTokens - 1].begin
+								+ tokens[numberOfTokens - 1].length)
+				|| !findName(this->columns, *name, columnIdx, hint)) {
+			fail(line);
+		}
+		value = limit(value, this->infinity);
+
+		VarValue& lowerBound = this->columnLowerBounds[columnIdx];
+		VarValue& upperBound = this->columnUpperBounds[columnIdx];
+		signed char& columnType = this->columnTypes[columnIdx];
+		if (equals(type->begin, type->length, "UP")) {
+			// negative upper bound of column bounded by 0 makes column unbounded from below (as in CPLEX)
+			lowerBound = value < 0 && lowerBound == 0 ? -this->infinity : lowerBound;
+			upperBound = value;
+		} else if (equals(type->begin, type->length, "LO")) {
+			lowerBound = value;
+		} else if (equals(type->begin, type->length, "FX")) {
+			lowerBound = value;
+			upperBound = value;
+		} else if (equals(type->begin, type->length, "FR")) {
+			lowerBound = -this->infinity;
+			upperBound = this->infinity;
+		} else if (equals(type->begin, type->length, "MI")) {
+			lowerBound = -this->infinity;
+		} else if (equals(type->begin, type->length, "PL")) {
+			upperBound = this->infinity;
+		} else if (equals(type->begin, type->length, "BV")) {
+			lowerBound = 0;
+			upperBound = 1;
+			columnType = ValueType::BINARY;
+		} else if (equals(type->begin, type->length, "LI")
+				|| equals(type->begin, type->length, "UI")) {
+			(type->begin[0] == 'L' ? lowerBound : upperBound) = value;
+			columnType =
+					columnType == ValueType::BINARY ?
+							ValueType::BINARY : ValueType::INTEGER;
+		} else {
+			fail(line);
+		}
+	}
+}
+
+void ModelReader::readMps(const std::vector<Section>& sections) {
+	Token tokens[2] { };
+	signed char marker { 0 };
+
+	for (const Section& section : sections) {
+		switch (section.type) {
+		case SectionType::NAME:
+			break;
+		case SectionType::OBJSENSE:
+			// sense is given in the same line as header or in the following line
+			for (const char* line = section.begin; line < section.end;
+					line = nextLine(line, section.end)) {
+				if (tokenize(line, nextLine(line, section.end), tokens, 1) == 1) {
+					this->maximize = equals(tokens[0].begin, tokens[0].length,
+							"MAX")
+							|| equals(tokens[0].begin, tokens[0].length,
+									"MAXIMIZE");
+					if (!this->maximize
+							&& !equals(tokens[0].begin, tokens[0].length, "MIN")
+							&& !equals(tokens[0].begin, tokens[0].length,
+									"MINIMIZE")) {
+						fail(line);
+					}
+				}
+			}
+			break;
+		case SectionType::ROWS:
+			parseMpsRows(section);
+			break;
+		case SectionType::COLUMNS:
+			split(section.begin, section.end, [](const char*) {
+				return true;
+			});
+			forEachPiece([this](Piece& piece, const size_t) {
+				parseMpsColumns(piece);
+			});
+			// runs of columns that precede the first marker of piece are in section of previous marker
+			for (Piece& piece : this->pieces) {
+				for (signed char& columnMarker : piece.columnMarkers) {
+					columnMarker = columnMarker < 0 ? marker : columnMarker;
+				}
+				marker = piece.marker < 0 ? marker : piece.marker;
+				for (const Token& name : piece.columnNames) {
+					addName(this->columns, name);
+				}
+			}
+			fold(this->columns);
+			initializeColumns();
+			resolveColumns();
+			break;
+		case SectionType::RHS:
+			parseMpsValues(section, this->rowRhs);
+			break;
+		case SectionType::RANGES:
+			parseMpsValues(section, this->rowRanges);
+			break;
+		case SectionType::BOUNDS:
+			parseMpsBounds(section);
+			break;
+		case SectionType::END:
+			break;
+		default:
+			fail(section.header);
+		}
+		if (section.type == SectionType::END) {
+			break;
+		}
+	}
+
+	this->rowLowerBounds.assign(this->rows.numberOfElements, -this->infinity);
+	this->rowUpperBounds.assign(this->rows.numberOfElements, this->infinity);
+	for (RowIdx i = 0; i < this->rows.numberOfElements; i += 1) {
+		const VarValue rhs { this->rowRhs[i] };
+		const VarValue range { std::fabs(this->rowRanges[i]) };
+		const bool ranged { !std::isnan(this->rowRanges[i]) };
+		switch (this->rowTypes[i]) {
+		case 'E':
+			this->rowLowerBounds[i] =
+					ranged && this->rowRanges[i] < 0 ? rhs - range : rhs;
+			this->rowUpperBounds[i] =
+					ranged && this->rowRanges[i] > 0 ? rhs + range : rhs;
+			break;
+		case 'L':
+			this->rowLowerBounds[i] = ranged ? rhs - range : -this->infinity;
+			this->rowUpperBounds[i] = rhs;
+			break;
+		case 'G':
+			this->rowLowerBounds[i] = rhs;
+			this->rowUpperBounds[i] = ranged ? rhs + range : this->infinity;
+			break;
+		}
+	}
+	finishColumns();
+}
+
+bool ModelReader::parseLpExpression(const char*& position, const char* end,
+		Piece& piece,
+		std::vector<std::pair<VarIdx, VarValue>>& coefficients) const {
+	thread_local std::string columnName { };
+	const char* pos { position };
+	const char* nameEnd { };
+	VarValue coefficient { };
+	bool negative { }, hasSign { }, first { true };
+
+	while ((pos = skipSpaces(pos, end)) < end && *pos != '<' && *pos != '>'
+			&& *pos != '=') {
+		negative = false;
+		hasSign = false;
+		while (pos < end && (*pos == '+' || *pos == '-')) {
+			negative = negative != (*pos == '-');
+			hasSign = true;
+			pos = skipSpaces(pos + 1, end);
+		}
+		// terms are separated by signs
+		if (!hasSign && !first) {
+			return false;
+		}
+		coefficient = 1;
+		if (pos < end && (('0' <= *pos && *pos <= '9') || *pos == '.')) {
+			pos = StringUtils::parseNumber(pos, end, coefficient);
+			if (pos == nullptr) {
+				return false;
+			}
+			pos = skipSpaces(pos, end);
+		}
+		nameEnd = skipLpName(pos, end);
+		// constant term is ignored
+		if (nameEnd != pos) {
+			columnName.assign(pos, nameEnd - pos);
+			const auto ordinal = piece.columnOrdinals.emplace(columnName,
+					(VarIdx) piece.columnNames.size());
+			if (ordinal.second) {
+				piece.columnNames.push_back(Token { pos, (size_t) (nameEnd - pos) });
+			}
+			coefficients.push_back(std::make_pair(ordinal.first->second,
+					negative ? -coefficient : coefficient));
+		}
+		pos = nameEnd;
+		first = false;
+	}
+	position = pos;
+	return true;
+}
+
+void ModelReader::parseLpConstraints(Piece& piece) const {
+	std::vector<std::pair<VarIdx, VarValue>> terms { };
+	const char* pos { piece.begin };
+	const char* constraintBegin { };
+	const char* nameEnd { };
+	const char* next { };
+	Token name { };
+	VarValue prefixValue { }, rhs { }, lowerBound { }, upperBound { };
+	char prefixOp { }, op { };
+
+	while ((pos = skipSpaces(pos, piece.end)) < piece.end) {
+		constraintBegin = pos;
+		name = Token { nullptr, 0 };
+		nameEnd = skipLpName(pos, piece.end);
+		if (nameEnd != pos && skipSpaces(nameEnd, piece.end) < piece.end
+				&& *skipSpaces(nameEnd, piece.end) == ':') {
+			name = Token { pos, (size_t) (nameEnd - pos) };
+			pos = skipSpaces(nameEnd, piece.end) + 1;
+		}
+
+		// ranged constraint begins with bound and comparison (e.g. "-1 <= x + y <= 1")
+		prefixOp = 0;
+		next = parseLpValue(skipSpaces(pos, piece.end), piece.end, prefixValue,
+				this->infinity);
+		if (next != nullptr
+				&& (next = parseComparison(skipSpaces(next, piece.end),
+						piece.end, prefixOp)) != nullptr) {
+			pos = next;
+		} else {
+			prefixOp = 0;
+		}
+
+		terms.clear();
+		if (!parseLpExpression(pos, piece.end, piece, terms)
+				|| (pos = parseComparison(pos, piece.end, op)) == nullptr
+				|| (pos = parseLpValue(skipSpaces(pos, piece.end), piece.end,
+						rhs, this->infinity)) == nullptr
+				|| (prefixOp != 0 && (prefixOp != op || op == '='))) {
+			fail(constraintBegin);
+		}
+		rhs = limit(rhs, this->infinity);
+		lowerBound = op == '<' ? -this->infinity : rhs;
+		upperBound = op == '>' ? this->infinity : rhs;
+		if (prefixOp == '<') {
+			lowerBound = limit(prefixValue, this->infinity);
+		} else if (prefixOp == '>') {
+			upperBound = limit(prefixValue, this->infinity);
+		}
+
+		if (piece.rowNames.size() > std::numeric_limits<RowIdx>::max()) {
+			fail(constraintBegin);
+		}
+		piece.rowNames.push_back(name);
+		piece.rowLowerBounds.push_back(lowerBound);
+		piece.rowUpperBounds.push_back(upperBound);
+		for (const std::pair<VarIdx, VarValue>& term : terms) {
+			if (term.second != 0) {
+				piece.elementRowIdx.push_back(
+						static_cast<RowIdx>(piece.rowNames.size() - 1));
+				piece.elementColumnIdx.push_back(term.first);
+				piece.elementValue.push_back(term.second);
+			}
+		}
+	}
+}
+
+void ModelReader::parseLpBounds(const Section& section, const bool assign) {
+	const char* pos { section.begin };
+	const char* boundBegin { };
+	const char* nameEnd { };
+	const char* next { };
+	size_t hint { 0 };
+	VarIdx columnIdx { };
+	VarValue leftValue { }, rightValue { };
+	char leftOp { }, rightOp { };
+	bool free { };
+	Token name { };
+
+	while ((pos = skipSpaces(pos, section.end)) < section.end) {
+		boundBegin = pos;
+		leftOp = 0;
+		rightOp = 0;
+		free = false;
+		// bound has form "[value op] name [op value]" or "name free"
+		next = parseLpValue(pos, section.end, leftValue, this->infinity);
+		if (next != nullptr) {
+			pos = parseComparison(skipSpaces(next, section.end), section.end,
+					leftOp);
+			if (pos == nullptr) {
+				fail(boundBegin);
+			}
+			pos = skipSpaces(pos, section.end);
+		}
+		nameEnd = skipLpName(pos, section.end);
+		if (nameEnd == pos) {
+			fail(boundBegin);
+		}
+		name = Token { pos, (size_t) (nameEnd - pos) };
+		pos = skipSpaces(nameEnd, section.end);
+		next = parseComparison(pos, section.end, rightOp);
+		if (next != nullptr) {
+			pos = parseLpValue(skipSpaces(next, section.end), section.end,
+					rightValue, this->infinity);
+			if (pos == nullptr) {
+				fail(boundBegin);
+			}
+		} else if (leftOp == 0) {
+			nameEnd = skipLpName(pos, section.end);
+			free = equalsIgnoreCase(pos, nameEnd - pos, "free");
+			if (!free) {
+				fail(boundBegin);
+			}
+			pos = nameEnd;
+		}
+
+		if (!assign) {
+			addName(this->columns, name);
+			continue;
+		}
+		findName(this->columns, name, columnIdx, hint);
+		VarValue& lowerBound = this->columnLowerBounds[columnIdx];
+		VarValue& upperBound = this->columnUpperBounds[columnIdx];
+		leftValue = limit(leftValue, this->infinity);
+		rightValue = limit(rightValue, this->infinity);
+		if (free) {
+			lowerBound = -this->infinity;
+			upperBound = this->infinity;
+		}
+		if (leftOp == '<' || leftOp == '=') {
+			lowerBound = leftValue;
+		}
+		if (leftOp == '>' || leftOp == '=') {
+			upperBound = leftValue;
+		}
+		if (rightOp == '<' || rightOp == '=') {
+			upperBound = rightValue;
+		}
+		if (rightOp == '>' || rightOp == '=') {
+			lowerBound = rightValue;
+		}
+		this->columnTypes[columnIdx] = std::max(this->columnTypes[columnIdx],
+				(signed char) ValueType::DOUBLE);
+	}
+}
+
+void ModelReader::parseLpTypes(const Section& section, const bool assign) {
+	const char* pos { section.begin };
+	const char* nameEnd { };
+	size_t hint { 0 };
+	VarIdx columnIdx { };
+	Token name { };
+
+	while ((pos = skipSpaces(pos, section.end)) < section.end) {
+		nameEnd = skipLpName(pos, section.end);
+		if (nameEnd == pos) {
+			fail(pos);
+		}
+		name = Token { pos, (size_t) (nameEnd - pos) };
+		pos = nameEnd;
+		if (!assign) {
+			addName(this->columns, name);
+			continue;
+		}
+		findName(this->columns, name, columnIdx, hint);
+		if (section.type == SectionType::BINARY) {
+			this->columnLowerBounds[columnIdx] = 0;
+			this->columnUpperBounds[columnIdx] = 1;
+			this->columnTypes[columnIdx] = ValueType::BINARY;
+		} else {
+			this->columnTypes[columnIdx] = ValueType::INTEGER;
+		}
+	}
+}
+
+void ModelReader::readLp(const std::vector<Section>& sections) {
+	const Section* objective { };
+	const Section* constraints { };
+	std::vector<const Section*> declarations { };
+	std::vector<RowIdx> firstUnnamedRow { };
+	StringUtils::Definition<VarDimIdx> unnamedRow { UNNAMED_ROWS, strlen(UNNAMED_ROWS),
+			VarIndexTuple { 0 } };
+	const char* pos { };
+	const char* nameEnd { };
+
+	for (const Section& section : sections) {
+		if (section.type == SectionType::END) {
+			break;
+		} else if ((section.type == SectionType::MINIMIZE
+				|| section.type == SectionType::MAXIMIZE) && objective == nullptr) {
+			objective = &section;
+			this->maximize = section.type == SectionType::MAXIMIZE;
+		} else if (section.type == SectionType::CONSTRAINTS
+				&& constraints == nullptr) {
+			constraints = &section;
+		} else if (section.type == SectionType::BOUNDS
+				|| section.type == SectionType::GENERAL
+				|| section.type == SectionType::BINARY) {
+			declarations.push_back(&section);
+		} else {
+			fail(section.header);
+		}
+	}
+
+	if (objective != nullptr) {
+		pos = skipSpaces(objective->begin, objective->end);
+		nameEnd = skipLpName(pos, objective->end);
+		if (nameEnd != pos && skipSpaces(nameEnd, objective->end) < objective->end
+				&& *skipSpaces(nameEnd, objective->end) == ':') {
+			pos = skipSpaces(nameEnd, objective->end) + 1;
+		}
+		if (!parseLpExpression(pos, objective->end, this->objectivePiece,
+				this->objectivePiece.objective) || pos != objective->end) {
+			fail(pos);
+		}
+	}
+	if (constraints != nullptr) {
+		// pieces begin at named constraints, so every constraint is parsed by single thread
+		split(constraints->begin, constraints->end, [this](const char* line) {
+			const char* nameBegin {skipBlanks(line, this->end)};
+			const char* nameEnd {skipLpName(nameBegin, this->end)};
+			return nameEnd != nameBegin && skipBlanks(nameEnd, this->end) < this->end
+					&& *skipBlanks(nameEnd, this->end) == ':';
+		});
+		forEachPiece([this](Piece& piece, const size_t) {
+			parseLpConstraints(piece);
+		});
+	}
+
+	// names are folded in order of their first appearance
+	for (const Token& name : this->objectivePiece.columnNames) {
+		addName(this->columns, name);
+	}
+	for (Piece& piece : this->pieces) {
+		for (const Token& name : piece.columnNames) {
+			addName(this->columns, name);
+		}
+		firstUnnamedRow.push_back(unnamedRow.indexes[0]);
+		for (const Token& name : piece.rowNames) {
+			if (name.length == 0) {
+				unnamedRow.indexes[0] += 1;
+				addName(this->rows, unnamedRow);
+			} else {
+				addName(this->rows, name);
+			}
+		}
+	}
+	for (const Section* declaration : declarations) {
+		if (declaration->type == SectionType::BOUNDS) {
+			parseLpBounds(*declaration, false);
+		} else {
+			parseLpTypes(*declaration, false);
+		}
+	}
+	fold(this->columns);
+	fold(this->rows);
+
+	initializeColumns();
+	resolveColumns();
+	forEachPiece([&](Piece& piece, const size_t p) {
+		size_t hint {0};
+		RowIdx unnamedIdx {firstUnnamedRow[p]};
+		piece.rowIdx.resize(piece.rowNames.size());
+		for (size_t r = 0; r < piece.rowNames.size(); r += 1) {
+			if (piece.rowNames[r].length == 0) {
+				piece.rowIdx[r] = this->rows.groups[this->rows.positions.at(UNNAMED_ROWS)].beginIdx
+						+ unnamedIdx;
+				unnamedIdx += 1;
+			} else {
+				findName(this->rows, piece.rowNames[r], piece.rowIdx[r], hint);
+			}
+		}
+		for (RowIdx& rowIdx : piece.elementRowIdx) {
+			rowIdx = piece.rowIdx[rowIdx];
+		}
+	});
+	this->rowLowerBounds.assign(this->rows.numberOfElements, -this->infinity);
+	this->rowUpperBounds.assign(this->rows.numberOfElements, this->infinity);
+	for (const Piece& piece : this->pieces) {
+		for (size_t r = 0; r < piece.rowIdx.size(); r += 1) {
+			this->rowLowerBounds[piece.rowIdx[r]] = piece.rowLowerBounds[r];
+			this->rowUpperBounds[piece.rowIdx[r]] = piece.rowUpperBounds[r];
+		}
+	}
+
+	for (const Section* declaration : declarations) {
+		if (declaration->type == SectionType::BOUNDS) {
+			parseLpBounds(*declaration, true);
+		} else {
+			parseLpTypes(*declaration, true);
+		}
+	}
+	finishColumns();
+}
+
+void ModelReader::read(const std::string& fileName)
+		throw (ModelExceptions::ModelFileException) {
+	const std::chrono::steady_clock::time_point start {
+			std::chrono::steady_clock::now() };
+	size_t numberOfElements { 0 };
+
+	this->fileName = fileName;
+	open(fileName);
+	INFO(logger, BundleKey::READ_MODEL,
+			this->format == ModelFormat::MPS ? "MPS" : "LP", fileName.c_str(),
+			(size_t) (this->end - this->begin), this->numberOfThreads);
+	try {
+		if (this->format == ModelFormat::MPS) {
+			readMps(findSections());
+		} else {
+			readLp(findSections());
+		}
+	} catch (...) {
+		close();
+		throw;
+	}
+	close();
+
+	for (Piece& piece : this->pieces) {
+		numberOfElements += piece.elementValue.size();
+		// names point into released content of file
+		std::vector<Token>().swap(piece.columnNames);
+		std::vector<Token>().swap(piece.rowNames);
+		std::unordered_map<std::string, VarIdx>().swap(piece.columnOrdinals);
+	}
+	INFO(logger, BundleKey::READ_MODEL_DONE, this->columns.groups.size(),
+			this->columns.numberOfElements, this->rows.groups.size(),
+			this->rows.numberOfElements, numberOfElements,
+			std::chrono::duration<double>(
+					std::chrono::steady_clock::now() - start).count());
+}
+
+void ModelReader::load(OsiProblemInstance* problemInstance,
+		const VarIdx firstColumnIdx, const RowIdx firstRowIdx) {
+	std::vector<size_t> piecePositions(this->pieces.size());
+	size_t numberOfElements { 0 }, position { };
+
+	for (VarIdx j = 0; j < this->columns.numberOfElements; j += 1) {
+		problemInstance->setColumnLowerBound(firstColumnIdx + j,
+				this->columnLowerBounds[j]);
+		problemInstance->setColumnUpperBound(firstColumnIdx + j,
+				this->columnUpperBounds[j]);
+		if (this->columnObjective[j] != 0) {
+			problemInstance->setColumnObjective(firstColumnIdx + j,
+					this->columnObjective[j]);
+		}
+	}
+	for (RowIdx i = 0; i < this->rows.numberOfElements; i += 1) {
+		problemInstance->setRowLowerBound(firstRowIdx + i,
+				this->rowLowerBounds[i]);
+		problemInstance->setRowUpperBound(firstRowIdx + i,
+				this->rowUpperBounds[i]);
+	}
+
+	for (size_t p = 0; p < this->pieces.size(); p += 1) {
+		piecePositions[p] = numberOfElements;
+		numberOfElements += this->pieces[p].elementValue.size();
+	}
+	position = problemInstance->extendElements(numberOfElements);
+	forEachPiece([&](Piece& piece, const size_t p) {
+		for (RowIdx& rowIdx : piece.elementRowIdx) {
+			rowIdx += firstRowIdx;
+		}
+		for (VarIdx& columnIdx : piece.elementColumnIdx) {
+			columnIdx += firstColumnIdx;
+		}
+		problemInstance->assignElements(position + piecePositions[p],
+				piece.elementRowIdx.data(), piece.elementColumnIdx.data(),
+				piece.elementValue.data(), piece.elementValue.size());
+	});
+}
+
+//************************************ CONSTRUCTOR & DESTRUCTOR ************************************//
+
+ModelReader::ModelReader(const ModelFormat format,
+		const unsigned int numberOfThreads, const VarValue infinity) :
+		format(format), numberOfThreads(numberOfThreads), fileName { }, mapping {
+				nullptr, 0 }, content { }, begin { }, end { }, infinity(infinity), maximize(
+				false), objectiveName { nullptr, 0 }, columns { }, rows { }, pieces { }, objectivePiece { }, columnLowerBounds { }, columnUpperBounds { }, columnObjective { }, columnTypes { }, rowLowerBounds { }, rowUpperBounds { }, rowTypes { }, rowRhs { }, rowRanges { } {
+	this->columns.numberOfElements = 0;
+	this->columns.hint = 0;
+	this->rows.numberOfElements = 0;
+	this->rows.hint = 0;
+	this->objectivePiece.marker = -1;
+}
+
+ModelReader::~ModelReader() {
+	close();
+}
+
+//*************************************** PUBLIC FUNCTIONS *****************************************//
+
+//*************************************** GETTERS & SETTERS ****************************************//
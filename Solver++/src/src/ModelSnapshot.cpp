@@ -0,0 +1,440 @@
+/*
+ * ModelSnapshot.cpp
+ *
+ *  Created on: 17 paź 2026
+ *      Author: tomasz
+ */
+
+#include "../include/ModelSnapshot.hpp"
+
+#include <stdio.h>
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <unordered_set>
+
+#include "../include/OsiProblemInstance.hpp"
+#include "../include/utils/ThreadUtils.hpp"
+
+static_assert(sizeof(bool) == 1, "flags of fixed columns are stored as single bytes");
+static_assert(sizeof(RowIdx) == sizeof(uint32_t), "rows of coefficients are stored as uint32");
+
+namespace {
+
+/** Number of coefficients expanded at once by one thread (@see ModelSnapshot::load()).
+ *
+ */
+const size_t EXPANSION_BLOCK_SIZE { 4096 };
+
+inline uint64_t align(const uint64_t position, const uint64_t alignment) {
+	return (position + alignment - 1) / alignment * alignment;
+}
+
+/** Appends given bytes to given buffer.
+ *
+ */
+inline void append(std::vector<unsigned char>& buffer, const void* data,
+		const size_t size) {
+	buffer.insert(buffer.end(), static_cast<const unsigned char*>(data),
+			static_cast<const unsigned char*>(data) + size);
+}
+
+/** Writes zero bytes into given file until its position reaches given offset.
+ *
+ * @return false if bytes cannot be written
+ */
+bool pad(FILE* file, uint64_t& position, const uint64_t offset) {
+	static const char zeros[64] { };
+	size_t count { };
+	while (position < offset) {
+		count = std::min<uint64_t>(sizeof(zeros), offset - position);
+		if (fwrite(zeros, 1, count, file) != count) {
+			return false;
+		}
+		position += count;
+	}
+	return true;
+}
+
+}
+
+//************************************ PRIVATE CONSTANT FIELDS *************************************//
+
+const char ModelSnapshot::MAGIC[8] { 'S', 'P', 'P', 'S', 'N', 'A', 'P', '\0' };
+
+const uint32_t ModelSnapshot::VERSION;
+
+const uint32_t ModelSnapshot::BYTE_ORDER_MARK;
+
+const uint64_t ModelSnapshot::ALIGNMENT;
+
+//***************************************** CLASS FIELDS *******************************************//
+
+//*************************************** PRIVATE FUNCTIONS ****************************************//
+
+bool ModelSnapshot::validateHeader() const {
+	const uint64_t numberOfColumns { this->header->numberOfColumns },
+			numberOfRows { this->header->numberOfRows }, numberOfElements {
+					this->header->numberOfElements }, size { this->mapping.size };
+	uint64_t expectedSizes[NUMBER_OF_ARRAYS] { };
+	const bool* fixed { };
+
+	if (memcmp(this->header->magic, MAGIC, sizeof(MAGIC)) != 0
+			|| this->header->version != VERSION
+			|| this->header->byteOrderMark != BYTE_ORDER_MARK
+			|| this->header->fileSize != size
+			|| numberOfColumns > std::numeric_limits<VarIdx>::max()
+			|| numberOfRows > std::numeric_limits<RowIdx>::max()
+			|| numberOfElements > size || this->header->numberOfGroups > size
+			|| this->header->numberOfParameters > size) {
+		return false;
+	}
+
+	expectedSizes[OBJECTIVE] = numberOfColumns * sizeof(VarValue);
+	expectedSizes[COLUMN_LOWER_BOUNDS] = numberOfColumns * sizeof(VarValue);
+	expectedSizes[COLUMN_UPPER_BOUNDS] = numberOfColumns * sizeof(VarValue);
+	expectedSizes[COLUMN_FIXED] = numberOfColumns * sizeof(bool);
+	expectedSizes[COLUMN_VALUES] = numberOfColumns * sizeof(VarValue);
+	expectedSizes[ROW_LOWER_BOUNDS] = numberOfRows * sizeof(VarValue);
+	expectedSizes[ROW_UPPER_BOUNDS] = numberOfRows * sizeof(VarValue);
+	expectedSizes[COLUMN_STARTS] = (numberOfColumns + 1) * sizeof(uint64_t);
+	expectedSizes[ROW_INDEXES] = numberOfElements * sizeof(RowIdx);
+	expectedSizes[ELEMENT_VALUES] = numberOfElements * sizeof(VarValue);
+	expectedSizes[PARAMETER_VALUES] = this->header->numberOfParameters
+			* sizeof(ParamValue);
+	for (int a = 0; a < NUMBER_OF_ARRAYS; a += 1) {
+		const ArrayEntry& entry = this->header->arrays[a];
+		if (entry.offset % ALIGNMENT != 0 || entry.offset < sizeof(Header)
+				|| entry.offset > size || entry.size > size - entry.offset
+				|| (a != GROUPS && entry.size != expectedSizes[a])) {
+			return false;
+		}
+	}
+
+	fixed = getArray<bool>(COLUMN_FIXED);
+	for (uint64_t j = 0; j < numberOfColumns; j += 1) {
+		if (reinterpret_cast<const unsigned char*>(fixed)[j] > 1) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool ModelSnapshot::readGroups() {
+	const unsigned char* data { getArray<unsigned char>(GROUPS) };
+	const uint64_t size { this->header->arrays[GROUPS].size };
+	const uint64_t limits[] { 0, this->header->numberOfColumns,
+			this->header->numberOfRows, this->header->numberOfParameters };
+	std::unordered_set<std::string> names[3] { };
+	uint64_t position { 0 }, numberOfElements { };
+	GroupRecord record { };
+	uint32_t extent { };
+	Group group { };
+
+	this->groups.clear();
+	this->groups.reserve(this->header->numberOfGroups);
+	for (uint64_t g = 0; g < this->header->numberOfGroups; g += 1) {
+		if (size - position < sizeof(GroupRecord)) {
+			return false;
+		}
+		memcpy(&record, data + position, sizeof(GroupRecord));
+		position += sizeof(GroupRecord);
+		if (record.kind < VARIABLES || record.kind > PARAMETERS
+				|| record.type > BINARY
+				|| record.numberOfDimensions > MAX_NUMBER_OF_DIMENSIONS
+				|| record.nameLength == 0
+				|| (size - position) / sizeof(uint32_t)
+						< record.numberOfDimensions) {
+			return false;
+		}
+
+		group.kind = static_cast<GroupKind>(record.kind);
+		group.type = static_cast<ValueType>(record.type);
+		group.beginIdx = record.beginIdx;
+		group.lowerBound = record.lowerBound;
+		group.upperBound = record.upperBound;
+		group.extents.clear();
+		numberOfElements = 1;
+		for (uint32_t d = 0; d < record.numberOfDimensions; d += 1) {
+			memcpy(&extent, data + position, sizeof(extent));
+			position += sizeof(extent);
+			if (extent == 0
+					|| numberOfElements
+							> std::numeric_limits<VarIdx>::max() / extent) {
+				return false;
+			}
+			numberOfElements *= extent;
+			group.extents.push_back(extent);
+		}
+		if (size - position < record.nameLength) {
+			return false;
+		}
+		group.name.assign(reinterpret_cast<const char*>(data + position),
+				record.nameLength);
+		position = std::min(size, align(position + record.nameLength, 8));
+
+		if (group.beginIdx > limits[group.kind]
+				|| numberOfElements > limits[group.kind] - group.beginIdx
+				|| !names[group.kind - 1].insert(group.name).second) {
+			return false;
+		}
+		group.values =
+				group.kind == PARAMETERS ?
+						getArray<ParamValue>(PARAMETER_VALUES) + group.beginIdx :
+						nullptr;
+		this->groups.push_back(group);
+	}
+	return true;
+}
+
+bool ModelSnapshot::validateCoefficients() const {
+	const uint64_t numberOfColumns { this->header->numberOfColumns },
+			numberOfElements { this->header->numberOfElements };
+	const uint64_t* starts { getArray<uint64_t>(COLUMN_STARTS) };
+	const RowIdx* rowIdx { getArray<RowIdx>(ROW_INDEXES) };
+	std::vector<char> valid(this->numberOfThreads, true);
+
+	if (starts[0] != 0 || starts[numberOfColumns] != numberOfElements) {
+		return false;
+	}
+	ThreadUtils::runWorkers(this->numberOfThreads, [&](const unsigned int t) {
+		const uint64_t beginColumn {numberOfColumns * t / this->numberOfThreads},
+				endColumn {numberOfColumns * (t + 1) / this->numberOfThreads},
+				beginElement {numberOfElements * t / this->numberOfThreads},
+				endElement {numberOfElements * (t + 1) / this->numberOfThreads};
+		for (uint64_t j = beginColumn; j < endColumn; j += 1) {
+			if (starts[j] > starts[j + 1]) {
+				valid[t] = false;
+			}
+		}
+		for (uint64_t e = beginElement; e < endElement; e += 1) {
+			if (rowIdx[e] >= this->header->numberOfRows) {
+				valid[t] = false;
+			}
+		}
+	});
+	return std::find(valid.begin(), valid.end(), false) == valid.end();
+}
+
+void ModelSnapshot::addVariableGroup(const std::string& name,
+		const VarDimensionTable& dimensions, const VarIdx beginIdx,
+		const ValueType type) {
+	this->groups.push_back( { VARIABLES, name, dimensions.getExtents(),
+			beginIdx, type, 0, 0, nullptr });
+}
+
+void ModelSnapshot::addRowGroup(const std::string& name,
+		const RowDimensionTable& dimensions, const RowIdx beginIdx) {
+	this->groups.push_back( { ROWS, name, dimensions.getExtents(), beginIdx,
+			ValueType::DOUBLE, 0, 0, nullptr });
+}
+
+void ModelSnapshot::addParamGroup(const std::string& name,
+		const ParamDimensionTable& dimensions, const ParamValue lowerBound,
+		const ParamValue upperBound, const ValueType type,
+		const ParamValue* values) {
+	this->groups.push_back( { PARAMETERS, name, dimensions.getExtents(),
+			this->numberOfParameters, type, lowerBound, upperBound, values });
+	this->numberOfParameters += dimensions.getNumberOfElements();
+}
+
+void ModelSnapshot::write(const std::string& fileName,
+		const OsiProblemInstance* problemInstance) const
+				throw (ModelExceptions::SnapshotFileException) {
+	const VarIdx numberOfColumns { problemInstance->numberOfColumns };
+	const RowIdx numberOfRows { problemInstance->numberOfRows };
+	const std::string temporaryFileName { fileName + ".tmp" };
+	std::vector<uint64_t> starts(numberOfColumns + 1);
+	std::vector<RowIdx> rowIdx(problemInstance->getNumberOfElements());
+	std::vector<VarValue> values(problemInstance->getNumberOfElements());
+	std::vector<unsigned char> groupRecords { };
+	const void* arrays[NUMBER_OF_ARRAYS] { };
+	Header header { };
+	GroupRecord record { };
+	uint64_t offset { }, position { };
+	uint32_t extent { };
+	size_t count { };
+	bool written { };
+	FILE* file { };
+
+	header.numberOfElements = problemInstance->coefficients->compress(true,
+			numberOfColumns, numberOfRows, starts.data(), rowIdx.data(),
+			values.data());
+
+	for (const Group& group : this->groups) {
+		record = { static_cast<uint32_t>(group.kind),
+				static_cast<uint32_t>(group.type), group.extents.size(),
+				static_cast<uint32_t>(group.name.length()), group.beginIdx,
+				group.lowerBound, group.upperBound };
+		append(groupRecords, &record, sizeof(record));
+		for (VarDimIdx d = 0; d < group.extents.size(); d += 1) {
+			extent = group.extents[d];
+			append(groupRecords, &extent, sizeof(extent));
+		}
+		append(groupRecords, group.name.data(), group.name.length());
+		groupRecords.resize(align(groupRecords.size(), 8), 0);
+	}
+
+	memcpy(header.magic, MAGIC, sizeof(MAGIC));
+	header.version = VERSION;
+	header.byteOrderMark = BYTE_ORDER_MARK;
+	header.numberOfColumns = numberOfColumns;
+	header.numberOfRows = numberOfRows;
+	header.numberOfGroups = this->groups.size();
+	header.numberOfParameters = this->numberOfParameters;
+	arrays[GROUPS] = groupRecords.data();
+	arrays[OBJECTIVE] = problemInstance->objective;
+	arrays[COLUMN_LOWER_BOUNDS] = problemInstance->col_lb;
+	arrays[COLUMN_UPPER_BOUNDS] = problemInstance->col_ub;
+	arrays[COLUMN_FIXED] = problemInstance->col_fixed;
+	arrays[COLUMN_VALUES] = problemInstance->col_value;
+	arrays[ROW_LOWER_BOUNDS] = problemInstance->row_lb;
+	arrays[ROW_UPPER_BOUNDS] = problemInstance->row_ub;
+	arrays[COLUMN_STARTS] = starts.data();
+	arrays[ROW_INDEXES] = rowIdx.data();
+	arrays[ELEMENT_VALUES] = values.data();
+	header.arrays[GROUPS].size = groupRecords.size();
+	header.arrays[OBJECTIVE].size = numberOfColumns * sizeof(VarValue);
+	header.arrays[COLUMN_LOWER_BOUNDS].size = numberOfColumns
+			* sizeof(VarValue);
+	header.arrays[COLUMN_UPPER_BOUNDS].size = numberOfColumns
+			* sizeof(VarValue);
+	header.arrays[COLUMN_FIXED].size = numberOfColumns * sizeof(bool);
+	header.arrays[COLUMN_VALUES].size = numberOfColumns * sizeof(VarValue);
+	header.arrays[ROW_LOWER_BOUNDS].size = numberOfRows * sizeof(VarValue);
+	header.arrays[ROW_UPPER_BOUNDS].size = numberOfRows * sizeof(VarValue);
+	header.arrays[COLUMN_STARTS].size = starts.size() * sizeof(uint64_t);
+	header.arrays[ROW_INDEXES].size = header.numberOfElements
+			* sizeof(RowIdx);
+	header.arrays[ELEMENT_VALUES].size = header.numberOfElements
+			* sizeof(VarValue);
+	header.arrays[PARAMETER_VALUES].size = this->numberOfParameters
+			* sizeof(ParamValue);
+	offset = sizeof(Header);
+	for (int a = 0; a < NUMBER_OF_ARRAYS; a += 1) {
+		offset = align(offset, ALIGNMENT);
+		header.arrays[a].offset = offset;
+		offset += header.arrays[a].size;
+	}
+	header.fileSize = offset;
+
+	file = fopen(temporaryFileName.c_str(), "wb");
+	if (file == nullptr) {
+		throw ModelExceptions::SnapshotFileException();
+	}
+	written = fwrite(&header, sizeof(header), 1, file) == 1;
+	position = sizeof(header);
+	for (int a = 0; a < NUMBER_OF_ARRAYS && written; a += 1) {
+		written = pad(file, position, header.arrays[a].offset);
+		if (a == PARAMETER_VALUES) {
+			// values of parameters are kept by their groups
+			for (const Group& group : this->groups) {
+				if (group.kind == PARAMETERS && written) {
+					count = VarDimensionTable { group.extents }.getNumberOfElements();
+					written = fwrite(group.values, sizeof(ParamValue), count,
+							file) == count;
+				}
+			}
+		} else if (header.arrays[a].size != 0) {
+			written = written
+					&& fwrite(arrays[a], 1, header.arrays[a].size, file)
+							== header.arrays[a].size;
+		}
+		position += header.arrays[a].size;
+	}
+	written = fclose(file) == 0 && written;
+	if (!written || rename(temporaryFileName.c_str(), fileName.c_str()) != 0) {
+		remove(temporaryFileName.c_str());
+		throw ModelExceptions::SnapshotFileException();
+	}
+}
+
+void ModelSnapshot::read(const std::string& fileName)
+		throw (ModelExceptions::SnapshotFileException) {
+	try {
+		this->mapping = TensorFileUtils::map(fileName);
+	} catch (const ParameterModelExceptions::TensorFileException& e) {
+		throw ModelExceptions::SnapshotFileException();
+	}
+	this->header = static_cast<const Header*>(this->mapping.address);
+	if (this->mapping.size < sizeof(Header) || !validateHeader()
+			|| !readGroups() || !validateCoefficients()) {
+		TensorFileUtils::unmap(this->mapping);
+		this->header = nullptr;
+		this->groups.clear();
+		throw ModelExceptions::SnapshotFileException();
+	}
+	this->numberOfParameters = this->header->numberOfParameters;
+}
+
+void ModelSnapshot::load(OsiProblemInstance* problemInstance) const {
+	// sizes have been checked against limits of index types by validateHeader()
+	const VarIdx numberOfColumns = static_cast<VarIdx>(this->header->numberOfColumns);
+	const RowIdx numberOfRows = static_cast<RowIdx>(this->header->numberOfRows);
+	const size_t numberOfElements = this->header->numberOfElements;
+	const uint64_t* starts { getArray<uint64_t>(COLUMN_STARTS) };
+	const RowIdx* rowIdx { getArray<RowIdx>(ROW_INDEXES) };
+	const VarValue* values { getArray<VarValue>(ELEMENT_VALUES) };
+	size_t position { };
+
+	problemInstance->addNumberOfVariables(numberOfColumns, 0, 0, false);
+	std::copy_n(getArray<VarValue>(OBJECTIVE), numberOfColumns,
+			problemInstance->objective);
+	std::copy_n(getArray<VarValue>(COLUMN_LOWER_BOUNDS), numberOfColumns,
+			problemInstance->col_lb);
+	std::copy_n(getArray<VarValue>(COLUMN_UPPER_BOUNDS), numberOfColumns,
+			problemInstance->col_ub);
+	std::copy_n(getArray<bool>(COLUMN_FIXED), numberOfColumns,
+			problemInstance->col_fixed);
+	std::copy_n(getArray<VarValue>(COLUMN_VALUES), numberOfColumns,
+			problemInstance->col_value);
+	for (const Group& group : this->groups) {
+		if (group.kind == VARIABLES && group.type != ValueType::DOUBLE) {
+			std::fill_n(problemInstance->col_integer + group.beginIdx,
+					VarDimensionTable { group.extents }.getNumberOfElements(),
+					true);
+		}
+	}
+	problemInstance->addNumberOfRows(numberOfRows, 0, 0);
+	std::copy_n(getArray<VarValue>(ROW_LOWER_BOUNDS), numberOfRows,
+			problemInstance->row_lb);
+	std::copy_n(getArray<VarValue>(ROW_UPPER_BOUNDS), numberOfRows,
+			problemInstance->row_ub);
+
+	// every thread expands its own range of coefficients (columns are generated, rows and values are copied)
+	position = problemInstance->extendElements(numberOfElements);
+	ThreadUtils::runWorkers(this->numberOfThreads, [&](const unsigned int t) {
+		const size_t beginElement {numberOfElements * t / this->numberOfThreads},
+				endElement {numberOfElements * (t + 1) / this->numberOfThreads};
+		std::vector<VarIdx> columnIdx(std::min(EXPANSION_BLOCK_SIZE, endElement - beginElement));
+		VarIdx j = static_cast<VarIdx>(std::upper_bound(starts, starts + numberOfColumns + 1,
+				beginElement) - starts - 1);
+		size_t count { };
+		for (size_t e = beginElement; e < endElement; e += count) {
+			count = std::min(EXPANSION_BLOCK_SIZE, endElement - e);
+			for (size_t k = 0; k < count; k += 1) {
+				while (starts[j + 1] <= e + k) {
+					j += 1;
+				}
+				columnIdx[k] = j;
+			}
+			problemInstance->assignElements(position + e, rowIdx + e, columnIdx.data(),
+					values + e, count);
+		}
+	});
+}
+
+//************************************ CONSTRUCTOR & DESTRUCTOR ************************************//
+
+ModelSnapshot::ModelSnapshot(const unsigned int numberOfThreads) :
+		groups { }, numberOfParameters(0), mapping { nullptr, 0 }, header(
+				nullptr), numberOfThreads(numberOfThreads) {
+}
+
+ModelSnapshot::~ModelSnapshot() {
+	TensorFileUtils::unmap(this->mapping);
+}
+
+//*************************************** PUBLIC FUNCTIONS *****************************************//
+
+//*************************************** GETTERS & SETTERS ****************************************//
@@ -0,0 +1,595 @@
+/*
+ * ModelWriter.cpp
+ *
+ *  Created on: 17 paź 2026
+ *      Author: tomasz
+ */
+
+#include "../include/ModelWriter.hpp"
+
+#include <log4cxx/helpers/messagebuffer.h>
+#include <log4cxx/logger.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+
+#include "../include/CoefficientMatrix.hpp"
+#include "../include/log/bundle/Bundle.hpp"
+#include "../include/log/utils/LogUtils.hpp"
+#include "../include/OsiProblemInstance.hpp"
+#include "../include/utils/Utils.hpp"
+
+const log4cxx::LoggerPtr logger(log4cxx::Logger::getLogger("ModelWriter"));
+
+namespace {
+
+/** Writes decimal digits of given value backwards, ending just before given address.
+ *
+ * @return number of written digits
+ */
+size_t formatUnsigned(unsigned long long value, char* end) {
+	size_t length { 0 };
+	do {
+		*(end - 1 - length) = (char) ('0' + value % 10);
+		value /= 10;
+		length += 1;
+	} while (value != 0);
+	return length;
+}
+
+}
+
+//************************************ PRIVATE CONSTANT FIELDS *************************************//
+
+const size_t ModelWriter::BUFFER_SIZE;
+
+const size_t ModelWriter::LINE_LENGTH;
+
+const size_t ModelWriter::MAX_DECIMAL_DIGITS;
+
+const char* const ModelWriter::OBJECTIVE_NAME { "_obj" };
+
+//***************************************** CLASS FIELDS *******************************************//
+
+//*************************************** PRIVATE FUNCTIONS ****************************************//
+
+void ModelWriter::flush() {
+	if (this->position == 0) {
+		return;
+	}
+	if (this->compressedFile != nullptr) {
+		this->failed |= gzwrite(this->compressedFile, this->buffer,
+				(unsigned int) this->position) != (int) this->position;
+	} else if (this->file != nullptr) {
+		this->failed |= fwrite(this->buffer, 1, this->position, this->file)
+				!= this->position;
+	}
+	this->numberOfBytes += this->position;
+	this->position = 0;
+}
+
+void ModelWriter::put(const char* text, const size_t length) {
+	size_t written { 0 }, n { };
+	while (written < length) {
+		if (this->position == BUFFER_SIZE) {
+			flush();
+		}
+		n = std::min(BUFFER_SIZE - this->position, length - written);
+		memcpy(this->buffer + this->position, text + written, n);
+		this->position += n;
+		written += n;
+	}
+	this->lineLength += length;
+}
+
+void ModelWriter::put(const char* text) {
+	put(text, strlen(text));
+}
+
+void ModelWriter::putUnsigned(unsigned long long value) {
+	char digits[24];
+	const size_t length { formatUnsigned(value, digits + sizeof(digits)) };
+	put(digits + sizeof(digits) - length, length);
+}
+
+void ModelWriter::putNumber(const VarValue value) {
+	char text[32];
+	int length { };
+	VarValue scale { 1 }, scaled { };
+	unsigned long long digits { };
+	size_t numberOfDigits { };
+	// most coefficients and bounds of real models are integers or short decimals - they are written without printf;
+	// value is written as integer with k decimal digits only if that decimal is read back as exactly the same value
+	for (size_t k = 0; k <= MAX_DECIMAL_DIGITS; k += 1, scale *= 10) {
+		scaled = value * scale;
+		if (scaled != std::floor(scaled) || std::fabs(scaled) >= 1e15) {
+			continue;
+		}
+		if (scaled / scale != value) {
+			break;
+		}
+		digits = (unsigned long long) std::fabs(scaled);
+		if (value < 0) {
+			put('-');
+		}
+		if (k == 0) {
+			putUnsigned(digits);
+			return;
+		}
+		numberOfDigits = 0;
+		do {
+			text[sizeof(text) - 1 - numberOfDigits] = (char) ('0' + digits % 10);
+			digits /= 10;
+			numberOfDigits += 1;
+			if (numberOfDigits == k) {
+				text[sizeof(text) - 1 - numberOfDigits] = '.';
+				numberOfDigits += 1;
+			}
+		} while (digits != 0 || numberOfDigits <= k + 1);
+		put(text + sizeof(text) - numberOfDigits, numberOfDigits);
+		return;
+	}
+	length = snprintf(text, sizeof(text), "%.15g", value);
+	if (strtod(text, nullptr) != value) {
+		length = snprintf(text, sizeof(text), "%.17g", value);
+	}
+	put(text, (size_t) length);
+}
+
+bool ModelWriter::findGroup(const std::vector<NameGroup>& groups,
+		const VarIdx idx, size_t& hint) const {
+	if (hint < groups.size() && idx >= groups[hint].beginIdx
+			&& idx < groups[hint].endIdx) {
+		return true;
+	}
+	hint = (size_t) (std::upper_bound(groups.begin(), groups.end(), idx,
+			[](const VarIdx i, const NameGroup& group) {
+				return i < group.beginIdx;
+			}) - groups.begin());
+	if (hint == 0 || idx >= groups[hint - 1].endIdx) {
+		hint = groups.size();
+		return false;
+	}
+	hint -= 1;
+	return true;
+}
+
+void ModelWriter::formatName(const std::vector<NameGroup>& groups,
+		const VarIdx idx, size_t& hint, const char prefix,
+		std::string& name) const {
+	const char open { this->format == ModelFormat::LP ? '(' : '[' };
+	const char close { this->format == ModelFormat::LP ? ')' : ']' };
+	char digits[24];
+	size_t length { };
+	VarIdx offset { };
+	name.clear();
+	if (!findGroup(groups, idx, hint)) {
+		length = formatUnsigned(idx, digits + sizeof(digits));
+		name.push_back(prefix);
+		name.append(digits + sizeof(digits) - length, length);
+		return;
+	}
+	const NameGroup& group = groups[hint];
+	offset = idx - group.beginIdx;
+	name.append(*group.name);
+	for (VarDimIdx d = 0; d < group.dimensions->getNumberOfDimensions(); d +=
+			1) {
+		length = formatUnsigned(offset / group.dimensions->getStride(d) + 1,
+				digits + sizeof(digits));
+		name.push_back(open);
+		name.append(digits + sizeof(digits) - length, length);
+		name.push_back(close);
+		offset %= group.dimensions->getStride(d);
+	}
+}
+
+void ModelWriter::putName(const std::vector<NameGroup>& groups,
+		const VarIdx idx, size_t& hint, const char prefix) {
+	formatName(groups, idx, hint, prefix, this->name);
+	put(this->name.data(), this->name.length());
+}
+
+void ModelWriter::putTerm(const VarValue coefficient, const VarIdx columnIdx) {
+	if (this->lineLength > LINE_LENGTH) {
+		newLine();
+	}
+	put(coefficient < 0 ? " - " : " + ");
+	putNumber(std::fabs(coefficient));
+	put(' ');
+	putColumnName(columnIdx);
+}
+
+ValueType ModelWriter::getColumnType(const VarIdx columnIdx) {
+	return findGroup(this->columnGroups, columnIdx, this->columnHint) ?
+			this->columnGroups[this->columnHint].type : ValueType::DOUBLE;
+}
+
+void ModelWriter::getColumnBounds(const VarIdx columnIdx,
+		VarValue& lowerBound, VarValue& upperBound) const {
+	if (this->problemInstance->isColumnFixed(columnIdx)) {
+		lowerBound = upperBound = this->problemInstance->getColumnValue(
+				columnIdx);
+	} else {
+		lowerBound = this->problemInstance->getColumnLowerBound(columnIdx);
+		upperBound = this->problemInstance->getColumnUpperBound(columnIdx);
+	}
+}
+
+void ModelWriter::writeMps() {
+	const VarIdx numberOfColumns { this->problemInstance->getNumberOfColumns() };
+	const RowIdx numberOfRows { this->problemInstance->getNumberOfRows() };
+	VarValue lowerBound { }, upperBound { }, objective { };
+	ColumnView column { };
+	ValueType type { };
+	bool integerSection { false };
+	std::string columnName { };
+
+	put("NAME model");
+	newLine();
+	put("ROWS");
+	newLine();
+	put(" N ");
+	put(OBJECTIVE_NAME);
+	newLine();
+	for (RowIdx i = 0; i < numberOfRows; i += 1) {
+		lowerBound = this->problemInstance->getRowLowerBound(i);
+		upperBound = this->problemInstance->getRowUpperBound(i);
+		if (isFinite(lowerBound) && isFinite(upperBound)) {
+			put(lowerBound == upperBound ? " E " : " L ");
+		} else if (isFinite(upperBound)) {
+			put(" L ");
+		} else if (isFinite(lowerBound)) {
+			put(" G ");
+		} else {
+			put(" N ");
+		}
+		putRowName(i);
+		newLine();
+	}
+
+	put("COLUMNS");
+	newLine();
+	for (VarIdx j = 0; j < numberOfColumns; j += 1) {
+		type = getColumnType(j);
+		if ((type != ValueType::DOUBLE) != integerSection) {
+			integerSection = !integerSection;
+			put(integerSection ?
+					" MARKER 'MARKER' 'INTORG'" : " MARKER 'MARKER' 'INTEND'");
+			newLine();
+		}
+		column = this->problemInstance->getColumnCoefficients(j);
+		objective = this->problemInstance->getColumnObjective(j);
+		// name of column is repeated in every line of column, so it is formatted only once
+		formatName(this->columnGroups, j, this->columnHint, 'C', columnName);
+		// every column has to appear in COLUMNS section, even without any coefficient
+		if (objective != 0 || column.size == 0) {
+			put(' ');
+			put(columnName.data(), columnName.length());
+			put(' ');
+			put(OBJECTIVE_NAME);
+			put(' ');
+			putNumber(objective);
+			newLine();
+		}
+		for (size_t k = 0; k < column.size; k += 1) {
+			put(' ');
+			put(columnName.data(), columnName.length());
+			put(' ');
+			putRowName(column.index[k]);
+			put(' ');
+			putNumber(column.value[k]);
+			newLine();
+		}
+	}
+	if (integerSection) {
+		put(" MARKER 'MARKER' 'INTEND'");
+		newLine();
+	}
+
+	put("RHS");
+	newLine();
+	for (RowIdx i = 0; i < numberOfRows; i += 1) {
+		lowerBound = this->problemInstance->getRowLowerBound(i);
+		upperBound = this->problemInstance->getRowUpperBound(i);
+		objective = isFinite(upperBound) ?
+				upperBound : (isFinite(lowerBound) ? lowerBound : 0);
+		if (objective != 0) {
+			put(" RHS ");
+			putRowName(i);
+			put(' ');
+			putNumber(objective);
+			newLine();
+		}
+	}
+
+	put("RANGES");
+	newLine();
+	for (RowIdx i = 0; i < numberOfRows; i += 1) {
+		lowerBound = this->problemInstance->getRowLowerBound(i);
+		upperBound = this->problemInstance->getRowUpperBound(i);
+		if (isFinite(lowerBound) && isFinite(upperBound)
+				&& lowerBound != upperBound) {
+			put(" RNG ");
+			putRowName(i);
+			put(' ');
+			putNumber(upperBound - lowerBound);
+			newLine();
+		}
+	}
+
+	put("BOUNDS");
+	newLine();
+	for (VarIdx j = 0; j < numberOfColumns; j += 1) {
+		getColumnBounds(j, lowerBound, upperBound);
+		type = getColumnType(j);
+		if (lowerBound == upperBound) {
+			put(" FX BND ");
+			putColumnName(j);
+			put(' ');
+			putNumber(lowerBound);
+			newLine();
+		} else if (type == ValueType::BINARY && lowerBound == 0
+				&& upperBound == 1) {
+			put(" BV BND ");
+			putColumnName(j);
+			newLine();
+		} else if (!isFinite(lowerBound) && !isFinite(upperBound)) {
+			put(" FR BND ");
+			putColumnName(j);
+			newLine();
+		} else {
+			if (!isFinite(lowerBound)) {
+				put(" MI BND ");
+				putColumnName(j);
+				newLine();
+			} else if (lowerBound != 0 || upperBound < 0) {
+				put(" LO BND ");
+				putColumnName(j);
+				put(' ');
+				putNumber(lowerBound);
+				newLine();
+			}
+			if (isFinite(upperBound)) {
+				put(" UP BND ");
+				putColumnName(j);
+				put(' ');
+				putNumber(upperBound);
+				newLine();
+			} else if (type != ValueType::DOUBLE) {
+				// some readers bound integer columns by 1 unless upper bound is given
+				put(" PL BND ");
+				putColumnName(j);
+				newLine();
+			}
+		}
+	}
+	put("ENDATA");
+	newLine();
+}
+
+void ModelWriter::writeLp() {
+	const VarIdx numberOfColumns { this->problemInstance->getNumberOfColumns() };
+	const RowIdx numberOfRows { this->problemInstance->getNumberOfRows() };
+	VarValue lowerBound { }, upperBound { }, objective { };
+	RowView row { };
+	bool empty { true };
+
+	put("\\ Model written by Solver++");
+	newLine();
+	put("Minimize");
+	newLine();
+	put(' ');
+	put(OBJECTIVE_NAME);
+	put(':');
+	for (VarIdx j = 0; j < numberOfColumns; j += 1) {
+		objective = this->problemInstance->getColumnObjective(j);
+		if (objective != 0) {
+			putTerm(objective, j);
+			empty = false;
+		}
+	}
+	if (empty && numberOfColumns != 0) {
+		putTerm(0, 0);
+	}
+	newLine();
+
+	put("Subject To");
+	newLine();
+	for (RowIdx i = 0; i < numberOfRows; i += 1) {
+		lowerBound = this->problemInstance->getRowLowerBound(i);
+		upperBound = this->problemInstance->getRowUpperBound(i);
+		row = this->problemInstance->getRowCoefficients(i);
+		put(' ');
+		putRowName(i);
+		put(':');
+		if (isFinite(lowerBound) && isFinite(upperBound)
+				&& lowerBound != upperBound) {
+			put(' ');
+			putNumber(lowerBound);
+			put(" <=");
+		}
+		for (size_t k = 0; k < row.size; k += 1) {
+			putTerm(row.value[k], row.index[k]);
+		}
+		if (row.size == 0 && numberOfColumns != 0) {
+			putTerm(0, 0);
+		}
+		if (isFinite(upperBound)) {
+			put(lowerBound == upperBound ? " = " : " <= ");
+			putNumber(upperBound);
+		} else if (isFinite(lowerBound)) {
+			put(" >= ");
+			putNumber(lowerBound);
+		} else {
+			// LP format has no free rows - row is bounded by infinity of the solver
+			put(" >= ");
+			putNumber(-this->infinity);
+		}
+		newLine();
+	}
+
+	put("Bounds");
+	newLine();
+	for (VarIdx j = 0; j < numberOfColumns; j += 1) {
+		getColumnBounds(j, lowerBound, upperBound);
+		if (lowerBound == upperBound) {
+			put(' ');
+			putColumnName(j);
+			put(" = ");
+			putNumber(lowerBound);
+		} else if (!isFinite(lowerBound) && !isFinite(upperBound)) {
+			put(' ');
+			putColumnName(j);
+			put(" free");
+		} else if (isFinite(upperBound)) {
+			if (getColumnType(j) == ValueType::BINARY && lowerBound == 0
+					&& upperBound == 1) {
+				continue;
+			}
+			put(' ');
+			if (isFinite(lowerBound)) {
+				putNumber(lowerBound);
+			} else {
+				put("-inf");
+			}
+			put(" <= ");
+			putColumnName(j);
+			put(" <= ");
+			putNumber(upperBound);
+		} else if (lowerBound != 0) {
+			put(' ');
+			putColumnName(j);
+			put(" >= ");
+			putNumber(lowerBound);
+		} else {
+			continue;
+		}
+		newLine();
+	}
+
+	for (const ValueType type : { ValueType::INTEGER, ValueType::BINARY }) {
+		empty = true;
+		for (VarIdx j = 0; j < numberOfColumns; j += 1) {
+			if (getColumnType(j) == ValueType::DOUBLE) {
+				continue;
+			}
+			getColumnBounds(j, lowerBound, upperBound);
+			// binary columns with bounds other than [0, 1] are written as general integers
+			if ((getColumnType(j) == ValueType::BINARY && lowerBound == 0
+					&& upperBound == 1) != (type == ValueType::BINARY)) {
+				continue;
+			}
+			if (empty) {
+				put(type == ValueType::BINARY ? "Binary" : "General");
+				newLine();
+				empty = false;
+			}
+			if (this->lineLength > LINE_LENGTH) {
+				newLine();
+			}
+			put(' ');
+			putColumnName(j);
+		}
+		if (!empty) {
+			newLine();
+		}
+	}
+	put("End");
+	newLine();
+}
+
+void ModelWriter::close() {
+	if (this->compressedFile != nullptr) {
+		this->failed |= gzclose(this->compressedFile) != Z_OK;
+		this->compressedFile = nullptr;
+	}
+	if (this->file != nullptr) {
+		this->failed |= fclose(this->file) != 0;
+		this->file = nullptr;
+	}
+}
+
+void ModelWriter::addColumnGroup(const std::string& name,
+		const VarDimensionTable& dimensions, const VarIdx beginIdx,
+		const ValueType type) {
+	this->columnGroups.push_back(NameGroup { beginIdx,
+			beginIdx + dimensions.getNumberOfElements(), &name, &dimensions,
+			type });
+}
+
+void ModelWriter::addRowGroup(const std::string& name,
+		const RowDimensionTable& dimensions, const RowIdx beginIdx) {
+	this->rowGroups.push_back(NameGroup { beginIdx,
+			beginIdx + dimensions.getNumberOfElements(), &name, &dimensions,
+			ValueType::DOUBLE });
+}
+
+void ModelWriter::write(const std::string& fileName, const bool compressed)
+		throw (ModelExceptions::ModelFileException) {
+	typedef std::chrono::steady_clock Clock;
+	const Clock::time_point start { Clock::now() };
+	const auto byBeginIdx = [](const NameGroup& a, const NameGroup& b) {
+		return a.beginIdx < b.beginIdx;
+	};
+
+	INFO(logger, BundleKey::WRITE_MODEL,
+			this->problemInstance->getNumberOfColumns(),
+			this->problemInstance->getNumberOfRows(),
+			this->problemInstance->getNumberOfElements(),
+			this->format == ModelFormat::LP ? "LP" : "MPS", fileName.c_str());
+
+	std::sort(this->columnGroups.begin(), this->columnGroups.end(),
+			byBeginIdx);
+	std::sort(this->rowGroups.begin(), this->rowGroups.end(), byBeginIdx);
+	this->columnHint = this->columnGroups.size();
+	this->rowHint = this->rowGroups.size();
+
+	if (compressed) {
+		this->compressedFile = gzopen(fileName.c_str(), "wb1");
+		if (this->compressedFile != nullptr) {
+			gzbuffer(this->compressedFile, BUFFER_SIZE);
+		}
+	} else {
+		this->file = fopen(fileName.c_str(), "wb");
+	}
+	if (this->compressedFile == nullptr && this->file == nullptr) {
+		throw ModelExceptions::ModelFileException();
+	}
+	this->buffer = new char[BUFFER_SIZE];
+
+	if (this->format == ModelFormat::LP) {
+		writeLp();
+	} else {
+		writeMps();
+	}
+	flush();
+	close();
+	if (this->failed) {
+		throw ModelExceptions::ModelFileException();
+	}
+	INFO(logger, BundleKey::WRITE_MODEL_DONE, this->numberOfBytes,
+			std::chrono::duration<double>(Clock::now() - start).count());
+}
+
+//************************************* PUBLIC CONSTANT FIELDS *************************************//
+
+//************************************ CONSTRUCTOR & DESTRUCTOR ************************************//
+
+ModelWriter::ModelWriter(const OsiProblemInstance* problemInstance,
+		const ModelFormat format) :
+		problemInstance(problemInstance), format(format), columnGroups { }, rowGroups { }, name { }, file(
+				nullptr), compressedFile(nullptr), buffer(nullptr), position(0), lineLength(
+				0), numberOfBytes(0), failed(false), infinity(
+				Utils::getUnbounded(UPPER)), columnHint(0), rowHint(0) {
+}
+
+ModelWriter::~ModelWriter() {
+	close();
+	delete[] this->buffer;
+}
+
+//*************************************** PUBLIC FUNCTIONS *****************************************//
+
+//*************************************** GETTERS & SETTERS ****************************************//
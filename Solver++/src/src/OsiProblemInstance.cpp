@@ -7,10 +7,118 @@
 
 #include "../include/OsiProblemInstance.hpp"
 
+#include <log4cxx/helpers/messagebuffer.h>
+#include <log4cxx/logger.h>
+#include <CoinPackedMatrix.hpp>
+#include <CoinTypes.hpp>
+#include <CoinWarmStartBasis.hpp>
+#include <OsiCbcSolverInterface.hpp>
+#include <OsiClpSolverInterface.hpp>
 #include <OsiGlpkSolverInterface.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <exception>
+
+#include "../include/log/bundle/Bundle.hpp"
+#include "../include/log/utils/LogUtils.hpp"
+#include "../include/Presolve.hpp"
+#include "../include/utils/ThreadUtils.hpp"
+
+const log4cxx::LoggerPtr logger(
+		log4cxx::Logger::getLogger("OsiProblemInstance"));
+
+namespace {
+
+/** Reallocates given array to newSize elements and copies first numberOfElements elements into it.
+ *
+ * @param array
+ * @param numberOfElements
+ * @param newSize
+ */
+template<typename T, typename Idx>
+void resizeArray(T*& array, const Idx numberOfElements, const Idx newSize) {
+	T* newArray = new T[newSize];
+	std::copy(array, array + numberOfElements, newArray);
+	delete[] array;
+	array = newArray;
+}
+
+/** Moves elements that follow count elements starting from firstIdx down by count.
+ *
+ * @param array
+ * @param numberOfElements
+ * @param firstIdx
+ * @param count
+ */
+template<typename T, typename Idx>
+void eraseRange(T* array, const Idx numberOfElements, const Idx firstIdx,
+		const Idx count) {
+	std::copy(array + firstIdx + count, array + numberOfElements,
+			array + firstIdx);
+}
+
+/** Removes indexes from [firstIdx, firstIdx + count) from given list and moves greater indexes down by count.
+ *
+ * @param indexes
+ * @param firstIdx
+ * @param count
+ */
+template<typename Idx>
+void eraseIndexes(std::vector<Idx>& indexes, const Idx firstIdx,
+		const Idx count) {
+	size_t k { 0 };
+	for (size_t i = 0; i < indexes.size(); i += 1) {
+		if (indexes[i] < firstIdx) {
+			indexes[k++] = indexes[i];
+		} else if (indexes[i] >= firstIdx + count) {
+			indexes[k++] = indexes[i] - count;
+		}
+	}
+	indexes.resize(k);
+}
+
+/** Adds indexes in the solver of count loaded elements starting from firstIdx to given sorted list of deleted elements.
+ *
+ * Solver still holds every listed element, so index of element in the solver is greater than its index
+ * in problem instance by number of listed elements that precede it.
+ *
+ * @param deleted indexes in the solver in increasing order
+ * @param firstIdx index in problem instance of the first deleted element
+ * @param count
+ */
+void addDeletedIndexes(std::vector<int>& deleted, const size_t firstIdx,
+		const size_t count) {
+	std::vector<int> merged { };
+	size_t k { 0 };
+	int solverIdx { (int) firstIdx };
+	if (count == 0) {
+		return;
+	}
+	merged.reserve(deleted.size() + count);
+	while (k < deleted.size() && deleted[k] <= solverIdx) {
+		merged.push_back(deleted[k++]);
+		solverIdx += 1;
+	}
+	for (size_t i = 0; i < count; i += 1) {
+		while (k < deleted.size() && deleted[k] == solverIdx) {
+			merged.push_back(deleted[k++]);
+			solverIdx += 1;
+		}
+		merged.push_back(solverIdx++);
+	}
+	merged.insert(merged.end(), deleted.begin() + k, deleted.end());
+	deleted.swap(merged);
+}
+
+}
 
 //************************************ PRIVATE CONSTANT FIELDS *************************************//
 
+const char* const OsiProblemInstance::SOLVER_INTERFACE_NAMES[] { "GLPK",
+		"CLP", "CBC" };
+
 //*************************************** PRIVATE FUNCTIONS ****************************************//
 
 OsiSolverInterface* OsiProblemInstance::getNewSolverInterface(
@@ -18,27 +126,911 @@ OsiSolverInterface* OsiProblemInstance::getNewSolverInterface(
 	switch (solverInterface) {
 	case GLPK:
 		return new OsiGlpkSolverInterface { };
+	case CLP:
+		return new OsiClpSolverInterface { };
+	case CBC:
+		return new OsiCbcSolverInterface { };
 	}
 	return NULL;
 }
 
+void OsiProblemInstance::reserveColumns(const VarIdx numberOfColumns) {
+	VarIdx newCapacity { };
+	if (numberOfColumns > this->columnsCapacity) {
+		newCapacity = std::max(numberOfColumns, 2 * this->columnsCapacity);
+		TRACE(logger, BundleKey::RESERVE_COLUMNS, this->columnsCapacity,
+				newCapacity);
+		resizeArray(this->objective, this->numberOfColumns, newCapacity);
+		resizeArray(this->col_lb, this->numberOfColumns, newCapacity);
+		resizeArray(this->col_ub, this->numberOfColumns, newCapacity);
+		resizeArray(this->col_fixed, this->numberOfColumns, newCapacity);
+		resizeArray(this->col_integer, this->numberOfColumns, newCapacity);
+		resizeArray(this->col_value, this->numberOfColumns, newCapacity);
+		resizeArray(this->col_dirty, this->numberOfColumns, newCapacity);
+		this->columnsCapacity = newCapacity;
+	}
+}
+
+void OsiProblemInstance::reserveRows(const RowIdx numberOfRows) {
+	RowIdx newCapacity { };
+	if (numberOfRows > this->rowsCapacity) {
+		newCapacity = std::max(numberOfRows, 2 * this->rowsCapacity);
+		TRACE(logger, BundleKey::RESERVE_ROWS, this->rowsCapacity,
+				newCapacity);
+		resizeArray(this->row_lb, this->numberOfRows, newCapacity);
+		resizeArray(this->row_ub, this->numberOfRows, newCapacity);
+		resizeArray(this->row_dirty, this->numberOfRows, newCapacity);
+		this->rowsCapacity = newCapacity;
+	}
+}
+
+void OsiProblemInstance::markColumnDirty(const VarIdx columnIdx) {
+	if (columnIdx < this->loadedColumns && !this->col_dirty[columnIdx]) {
+		this->col_dirty[columnIdx] = true;
+		this->dirtyColumns.push_back(columnIdx);
+	}
+}
+
+void OsiProblemInstance::markRowDirty(const RowIdx rowIdx) {
+	if (rowIdx < this->loadedRows && !this->row_dirty[rowIdx]) {
+		this->row_dirty[rowIdx] = true;
+		this->dirtyRows.push_back(rowIdx);
+	}
+}
+
+void OsiProblemInstance::getSolverColumnBounds(const VarIdx firstIdx,
+		const VarIdx count, double* collb, double* colub) const {
+	VarIdx j { };
+	for (VarIdx i = 0; i < count; i += 1) {
+		j = firstIdx + i;
+		collb[i] = this->col_fixed[j] ? this->col_value[j] : this->col_lb[j];
+		colub[i] = this->col_fixed[j] ? this->col_value[j] : this->col_ub[j];
+	}
+}
+
+void OsiProblemInstance::pushDeletions() {
+	if (!this->deletedColumns.empty()) {
+		this->si->deleteCols((int) this->deletedColumns.size(),
+				this->deletedColumns.data());
+	}
+	if (!this->deletedRows.empty()) {
+		this->si->deleteRows((int) this->deletedRows.size(),
+				this->deletedRows.data());
+	}
+}
+
+void OsiProblemInstance::pushDirtyColumns() {
+	const size_t count { this->dirtyColumns.size() };
+	if (count == 0) {
+		return;
+	}
+	int* index = new int[count];
+	double* bounds = new double[2 * count];
+	double* obj = new double[count];
+	VarIdx j { };
+	for (size_t i = 0; i < count; i += 1) {
+		j = this->dirtyColumns[i];
+		index[i] = (int) j;
+		getSolverColumnBounds(j, 1, bounds + 2 * i, bounds + 2 * i + 1);
+		obj[i] = this->objective[j];
+	}
+	this->si->setColSetBounds(index, index + count, bounds);
+	this->si->setObjCoeffSet(index, index + count, obj);
+	delete[] index;
+	delete[] bounds;
+	delete[] obj;
+}
+
+void OsiProblemInstance::pushDirtyRows() {
+	const size_t count { this->dirtyRows.size() };
+	if (count == 0) {
+		return;
+	}
+	int* index = new int[count];
+	double* bounds = new double[2 * count];
+	RowIdx r { };
+	for (size_t i = 0; i < count; i += 1) {
+		r = this->dirtyRows[i];
+		index[i] = (int) r;
+		bounds[2 * i] = this->row_lb[r];
+		bounds[2 * i + 1] = this->row_ub[r];
+	}
+	this->si->setRowSetBounds(index, index + count, bounds);
+	delete[] index;
+	delete[] bounds;
+}
+
+void OsiProblemInstance::pushNewColumns(const CoefficientMatrix& newColumns) {
+	const VarIdx count { this->numberOfColumns - this->loadedColumns };
+	if (count == 0) {
+		return;
+	}
+	CoinBigIndex* start = new CoinBigIndex[count + 1];
+	int* index = new int[newColumns.getNumberOfElements()];
+	double* element = new double[newColumns.getNumberOfElements()];
+	double* collb = new double[count];
+	double* colub = new double[count];
+	newColumns.compress(true, count, this->loadedRows, start, index, element);
+	getSolverColumnBounds(this->loadedColumns, count, collb, colub);
+	this->si->addCols((int) count, start, index, element, collb, colub,
+			this->objective + this->loadedColumns);
+	pushIntegerColumns(this->loadedColumns, count);
+	delete[] start;
+	delete[] index;
+	delete[] element;
+	delete[] collb;
+	delete[] colub;
+}
+
+void OsiProblemInstance::pushNewRows(const CoefficientMatrix& newRows) {
+	const RowIdx count { this->numberOfRows - this->loadedRows };
+	if (count == 0) {
+		return;
+	}
+	CoinBigIndex* start = new CoinBigIndex[count + 1];
+	int* index = new int[newRows.getNumberOfElements()];
+	double* element = new double[newRows.getNumberOfElements()];
+	newRows.compress(false, count, this->numberOfColumns, start, index,
+			element);
+	this->si->addRows((int) count, start, index, element,
+			this->row_lb + this->loadedRows, this->row_ub + this->loadedRows);
+	delete[] start;
+	delete[] index;
+	delete[] element;
+}
+
+void OsiProblemInstance::pushIntegerColumns(const VarIdx firstIdx,
+		const VarIdx count) {
+	std::vector<int> index { };
+	for (VarIdx j = firstIdx; j < firstIdx + count; j += 1) {
+		if (this->col_integer[j]) {
+			index.push_back((int) j);
+		}
+	}
+	if (!index.empty()) {
+		this->si->setInteger(index.data(), (int) index.size());
+	}
+}
+
+void OsiProblemInstance::clearChanges() {
+	for (VarIdx j : this->dirtyColumns) {
+		this->col_dirty[j] = false;
+	}
+	for (RowIdx r : this->dirtyRows) {
+		this->row_dirty[r] = false;
+	}
+	this->dirtyColumns.clear();
+	this->dirtyRows.clear();
+	this->deletedColumns.clear();
+	this->deletedRows.clear();
+	this->problemLoaded = true;
+	this->loadedColumns = this->numberOfColumns;
+	this->loadedRows = this->numberOfRows;
+	this->loadedElements = this->coefficients->getNumberOfElements();
+}
+
+void OsiProblemInstance::applyScenario(OsiSolverInterface* si,
+		const Scenario& scenario) const {
+	for (const Scenario::BoundsChange<VarIdx>& change : scenario.columnBounds) {
+		si->setColBounds((int) change.idx, change.lowerBound,
+				change.upperBound);
+	}
+	for (const Scenario::ObjectiveChange& change : scenario.objective) {
+		si->setObjCoeff((int) change.idx, change.coefficient);
+	}
+	for (const Scenario::BoundsChange<RowIdx>& change : scenario.rowBounds) {
+		si->setRowBounds((int) change.idx, change.lowerBound,
+				change.upperBound);
+	}
+}
+
+void OsiProblemInstance::revertScenario(OsiSolverInterface* si,
+		const Scenario& scenario) const {
+	double lowerBound { }, upperBound { };
+	for (const Scenario::BoundsChange<VarIdx>& change : scenario.columnBounds) {
+		getSolverColumnBounds(change.idx, 1, &lowerBound, &upperBound);
+		si->setColBounds((int) change.idx, lowerBound, upperBound);
+	}
+	for (const Scenario::ObjectiveChange& change : scenario.objective) {
+		si->setObjCoeff((int) change.idx, this->objective[change.idx]);
+	}
+	for (const Scenario::BoundsChange<RowIdx>& change : scenario.rowBounds) {
+		si->setRowBounds((int) change.idx, this->row_lb[change.idx],
+				this->row_ub[change.idx]);
+	}
+}
+
+SolveStatus OsiProblemInstance::solve(OsiSolverInterface* si,
+		const bool warmStart) {
+	if (si->getNumIntegers() > 0) {
+		si->branchAndBound();
+	} else if (warmStart) {
+		si->resolve();
+	} else {
+		si->initialSolve();
+	}
+
+	if (si->isProvenOptimal()) {
+		return SolveStatus::OPTIMAL;
+	} else if (si->isProvenPrimalInfeasible()) {
+		return SolveStatus::PRIMAL_INFEASIBLE;
+	} else if (si->isProvenDualInfeasible()) {
+		return SolveStatus::DUAL_INFEASIBLE;
+	} else if (si->isIterationLimitReached()) {
+		return SolveStatus::LIMIT_REACHED;
+	}
+	return SolveStatus::ABANDONED;
+}
+
+bool OsiProblemInstance::loadPresolvedProblem() {
+	double* collb = new double[this->numberOfColumns];
+	double* colub = new double[this->numberOfColumns];
+	std::vector<RowIdx> reducedRowIdx(this->numberOfRows, Presolve::NO_SOURCE);
+	std::vector<int> integerIdx { };
+	VarIdx numberOfColumns { };
+	RowIdx numberOfRows { };
+	size_t numberOfElements { 0 };
+	CoinBigIndex* start { };
+	int* length { };
+	int* index { };
+	double* element { };
+	double* obj { };
+	double* rowlb { };
+	double* rowub { };
+	CoinPackedMatrix* matrix { };
+
+	this->coefficients->releaseCache();
+	getSolverColumnBounds(0, this->numberOfColumns, collb, colub);
+	this->presolve = new Presolve { *this->coefficients, this->numberOfColumns,
+			this->numberOfRows, this->objective, collb, colub, this->row_lb,
+			this->row_ub, this->si->getInfinity() };
+	delete[] collb;
+	delete[] colub;
+	if (!this->presolve->run()) {
+		delete this->presolve;
+		this->presolve = nullptr;
+		return false;
+	}
+
+	const Presolve& presolve = *this->presolve;
+	numberOfColumns = presolve.getNumberOfReducedColumns();
+	numberOfRows = presolve.getNumberOfReducedRows();
+	for (RowIdx i = 0; i < numberOfRows; i += 1) {
+		reducedRowIdx[presolve.rowMap[i]] = i;
+	}
+	for (const VarIdx j : presolve.columnMap) {
+		for (size_t k = presolve.columnStart[j]; k < presolve.columnStart[j + 1];
+				k += 1) {
+			numberOfElements += reducedRowIdx[presolve.columnRowIdx[k]]
+					!= Presolve::NO_SOURCE;
+		}
+	}
+
+	INFO(logger, BundleKey::LOAD_PROBLEM, numberOfColumns, numberOfRows,
+			numberOfElements);
+	start = new CoinBigIndex[numberOfColumns + 1];
+	length = new int[numberOfColumns];
+	index = new int[numberOfElements];
+	element = new double[numberOfElements];
+	collb = new double[numberOfColumns];
+	colub = new double[numberOfColumns];
+	obj = new double[numberOfColumns];
+	rowlb = new double[numberOfRows];
+	rowub = new double[numberOfRows];
+	start[0] = 0;
+	for (VarIdx j = 0; j < numberOfColumns; j += 1) {
+		const VarIdx columnIdx { presolve.columnMap[j] };
+		start[j + 1] = start[j];
+		for (size_t k = presolve.columnStart[columnIdx];
+				k < presolve.columnStart[columnIdx + 1]; k += 1) {
+			if (reducedRowIdx[presolve.columnRowIdx[k]] != Presolve::NO_SOURCE) {
+				index[start[j + 1]] =
+						(int) reducedRowIdx[presolve.columnRowIdx[k]];
+				element[start[j + 1]] = presolve.columnElement[k];
+				start[j + 1] += 1;
+			}
+		}
+		length[j] = start[j + 1] - start[j];
+		collb[j] = presolve.columnLower[columnIdx];
+		colub[j] = presolve.columnUpper[columnIdx];
+		obj[j] = presolve.objective[columnIdx];
+	}
+	for (RowIdx i = 0; i < numberOfRows; i += 1) {
+		rowlb[i] = presolve.rowLower[presolve.rowMap[i]];
+		rowub[i] = presolve.rowUpper[presolve.rowMap[i]];
+	}
+
+	matrix = new CoinPackedMatrix { };
+	matrix->assignMatrix(true, (int) numberOfRows, (int) numberOfColumns,
+			(CoinBigIndex) numberOfElements, element, index, start, length);
+	this->si->assignProblem(matrix, collb, colub, obj, rowlb, rowub);
+	integerIdx.reserve(numberOfColumns);
+	for (VarIdx j = 0; j < numberOfColumns; j += 1) {
+		if (this->col_integer[presolve.columnMap[j]]) {
+			integerIdx.push_back((int) j);
+		}
+	}
+	if (!integerIdx.empty()) {
+		this->si->setInteger(integerIdx.data(), (int) integerIdx.size());
+	}
+	this->basisAvailable = false;
+	clearChanges();
+	return true;
+}
+
+VarValue OsiProblemInstance::getDualBound() const {
+	const double* rowPrice { this->si->getRowPrice() };
+	const double* reducedCost { this->si->getReducedCost() };
+	if (rowPrice == nullptr || reducedCost == nullptr) {
+		return NAN;
+	}
+	const double sense { this->si->getObjSense() };
+	const double infinity { this->si->getInfinity() };
+	double tolerance { }, objectiveOffset { };
+	this->si->getDblParam(OsiDualTolerance, tolerance);
+	this->si->getDblParam(OsiObjOffset, objectiveOffset);
+	VarValue bound { -objectiveOffset
+			+ (this->presolve != nullptr ? this->presolve->getObjectiveOffset() : 0) };
+	// adds minimum (maximum for maximization) of value * x over lower <= x <= upper
+	const auto addTerm = [&](const double value, const double lower, const double upper) {
+		if (sense * value > tolerance) {
+			bound += lower > -infinity ? value * lower : -sense * INFINITY;
+		} else if (sense * value < -tolerance) {
+			bound += upper < infinity ? value * upper : -sense * INFINITY;
+		}
+	};
+
+	const double* colLower { this->si->getColLower() };
+	const double* colUpper { this->si->getColUpper() };
+	for (int j = 0; j < this->si->getNumCols(); j += 1) {
+		addTerm(reducedCost[j], colLower[j], colUpper[j]);
+	}
+	const double* rowLower { this->si->getRowLower() };
+	const double* rowUpper { this->si->getRowUpper() };
+	for (int i = 0; i < this->si->getNumRows(); i += 1) {
+		addTerm(rowPrice[i], rowLower[i], rowUpper[i]);
+	}
+	return bound;
+}
+
 //************************************* PUBLIC CONSTANT FIELDS *************************************//
 
+const int OsiProblemInstance::ITERATIONS_PER_SLICE;
+
 //************************************ CONSTRUCTOR & DESTRUCTOR ************************************//
 
-OsiProblemInstance::OsiProblemInstance(SolverInterface solverInterface): numberOfColumns(0), numberOfRows(0) {
+OsiProblemInstance::OsiProblemInstance(SolverInterface solverInterface) :
+		solverInterface(solverInterface), numberOfColumns(0), columnsCapacity(0), objective(NULL), col_lb(
+		NULL), col_ub(NULL), col_fixed(NULL), col_integer(NULL), col_value(NULL), col_dirty(
+		NULL), numberOfRows(0), rowsCapacity(0), row_lb(NULL), row_ub(NULL), row_dirty(
+		NULL), problemLoaded(false), loadedColumns(0), loadedRows(0), loadedElements(
+				0), basisAvailable(false), presolveEnabled(false), presolve(
+				nullptr) {
 	this->si = getNewSolverInterface(solverInterface);
+	DEBUG(logger, BundleKey::INIT_SOLVER_INTERFACE,
+			SOLVER_INTERFACE_NAMES[solverInterface]);
+	this->coefficients = new CoefficientMatrix { };
 }
 
 OsiProblemInstance::~OsiProblemInstance() {
 	delete this->si;
+	delete[] this->objective;
+	delete[] this->col_lb;
+	delete[] this->col_ub;
+	delete[] this->col_fixed;
+	delete[] this->col_integer;
+	delete[] this->col_value;
+	delete[] this->col_dirty;
+	delete[] this->row_lb;
+	delete[] this->row_ub;
+	delete[] this->row_dirty;
+	delete this->coefficients;
+	delete this->presolve;
 }
 
 //*************************************** PUBLIC FUNCTIONS *****************************************//
 
-void OsiProblemInstance::addNumberOfVariables(
-		const VarIdx numberOfNewVariables) {
+VarIdx OsiProblemInstance::addNumberOfVariables(
+		const VarIdx numberOfNewVariables, const VarValue lowerBound,
+		const VarValue upperBound, const bool integer) {
+	const VarIdx firstIdx { this->numberOfColumns };
+	DEBUG(logger, BundleKey::ADD_COLUMNS, numberOfNewVariables, firstIdx);
+	reserveColumns(this->numberOfColumns + numberOfNewVariables);
+	std::fill_n(this->objective + firstIdx, numberOfNewVariables, 0);
+	std::fill_n(this->col_lb + firstIdx, numberOfNewVariables, lowerBound);
+	std::fill_n(this->col_ub + firstIdx, numberOfNewVariables, upperBound);
+	std::fill_n(this->col_fixed + firstIdx, numberOfNewVariables, false);
+	std::fill_n(this->col_integer + firstIdx, numberOfNewVariables, integer);
+	std::fill_n(this->col_value + firstIdx, numberOfNewVariables, 0);
+	std::fill_n(this->col_dirty + firstIdx, numberOfNewVariables, false);
 	this->numberOfColumns += numberOfNewVariables;
+	return firstIdx;
+}
+
+RowIdx OsiProblemInstance::addNumberOfRows(const RowIdx numberOfNewRows,
+		const VarValue lowerBound, const VarValue upperBound) {
+	const RowIdx firstIdx { this->numberOfRows };
+	DEBUG(logger, BundleKey::ADD_ROWS, numberOfNewRows, firstIdx);
+	reserveRows(this->numberOfRows + numberOfNewRows);
+	std::fill_n(this->row_lb + firstIdx, numberOfNewRows, lowerBound);
+	std::fill_n(this->row_ub + firstIdx, numberOfNewRows, upperBound);
+	std::fill_n(this->row_dirty + firstIdx, numberOfNewRows, false);
+	this->numberOfRows += numberOfNewRows;
+	return firstIdx;
+}
+
+void OsiProblemInstance::deleteColumns(const VarIdx firstIdx,
+		const VarIdx count) {
+	const VarIdx loadedCount { firstIdx < this->loadedColumns ?
+			std::min(count, this->loadedColumns - firstIdx) : 0 };
+	DEBUG(logger, BundleKey::REMOVE_COLUMNS, count, firstIdx, loadedCount);
+	addDeletedIndexes(this->deletedColumns, firstIdx, loadedCount);
+	eraseRange(this->objective, this->numberOfColumns, firstIdx, count);
+	eraseRange(this->col_lb, this->numberOfColumns, firstIdx, count);
+	eraseRange(this->col_ub, this->numberOfColumns, firstIdx, count);
+	eraseRange(this->col_fixed, this->numberOfColumns, firstIdx, count);
+	eraseRange(this->col_integer, this->numberOfColumns, firstIdx, count);
+	eraseRange(this->col_value, this->numberOfColumns, firstIdx, count);
+	eraseRange(this->col_dirty, this->numberOfColumns, firstIdx, count);
+	eraseIndexes(this->dirtyColumns, firstIdx, count);
+	if (count == this->numberOfColumns) {
+		// every coefficient belongs to one of removed columns
+		this->coefficients->clear();
+		this->loadedElements = 0;
+	} else {
+		this->loadedElements -= this->coefficients->remove(true, firstIdx,
+				count, this->loadedElements);
+	}
+	this->numberOfColumns -= count;
+	this->loadedColumns -= loadedCount;
+}
+
+void OsiProblemInstance::deleteRows(const RowIdx firstIdx,
+		const RowIdx count) {
+	const RowIdx loadedCount { firstIdx < this->loadedRows ?
+			std::min(count, this->loadedRows - firstIdx) : 0 };
+	DEBUG(logger, BundleKey::REMOVE_ROWS, count, firstIdx, loadedCount);
+	addDeletedIndexes(this->deletedRows, firstIdx, loadedCount);
+	eraseRange(this->row_lb, this->numberOfRows, firstIdx, count);
+	eraseRange(this->row_ub, this->numberOfRows, firstIdx, count);
+	eraseRange(this->row_dirty, this->numberOfRows, firstIdx, count);
+	eraseIndexes(this->dirtyRows, firstIdx, count);
+	if (count == this->numberOfRows) {
+		// every coefficient belongs to one of removed rows
+		this->coefficients->clear();
+		this->loadedElements = 0;
+	} else {
+		this->loadedElements -= this->coefficients->remove(false, firstIdx,
+				count, this->loadedElements);
+	}
+	this->numberOfRows -= count;
+	this->loadedRows -= loadedCount;
+}
+
+void OsiProblemInstance::addElement(const RowIdx rowIdx,
+		const VarIdx columnIdx, const VarValue value) {
+	this->coefficients->add(rowIdx, columnIdx, value);
+}
+
+void OsiProblemInstance::addElements(const RowIdx rowIdx,
+		const VarIdx* columnIdx, const VarValue* value, const size_t count) {
+	this->coefficients->add(rowIdx, columnIdx, value, count);
+}
+
+void OsiProblemInstance::reserveElements(const size_t numberOfElements) {
+	this->coefficients->reserve(numberOfElements);
+}
+
+size_t OsiProblemInstance::extendElements(const size_t count) {
+	return this->coefficients->extend(count);
+}
+
+void OsiProblemInstance::assignElements(const size_t position,
+		const RowIdx* rowIdx, const VarIdx* columnIdx, const VarValue* value,
+		const size_t count) {
+	this->coefficients->assign(position, rowIdx, columnIdx, value, count);
+}
+
+void OsiProblemInstance::loadProblem() {
+	delete this->presolve;
+	this->presolve = nullptr;
+	if (this->presolveEnabled && loadPresolvedProblem()) {
+		return;
+	}
+
+	const size_t numberOfElements { this->coefficients->getNumberOfElements() };
+	CoinBigIndex* start = new CoinBigIndex[this->numberOfColumns + 1];
+	int* length = new int[this->numberOfColumns];
+	int* index = new int[numberOfElements];
+	double* element = new double[numberOfElements];
+	CoinPackedMatrix* matrix = new CoinPackedMatrix { };
+	double* collb = new double[this->numberOfColumns];
+	double* colub = new double[this->numberOfColumns];
+	double* obj = new double[this->numberOfColumns];
+	double* rowlb = new double[this->numberOfRows];
+	double* rowub = new double[this->numberOfRows];
+	CoinBigIndex numberOfCompressed { };
+
+	INFO(logger, BundleKey::LOAD_PROBLEM, this->numberOfColumns,
+			this->numberOfRows, numberOfElements);
+
+	// cached views are not needed any more and matrix of the same size is about to be handed over to the solver
+	this->coefficients->releaseCache();
+	numberOfCompressed = (CoinBigIndex) this->coefficients->compress(true,
+			this->numberOfColumns, this->numberOfRows, start, index, element);
+	for (VarIdx j = 0; j < this->numberOfColumns; j += 1) {
+		length[j] = start[j + 1] - start[j];
+	}
+
+	matrix->assignMatrix(true, (int) this->numberOfRows,
+			(int) this->numberOfColumns, numberOfCompressed, element, index,
+			start, length);
+
+	getSolverColumnBounds(0, this->numberOfColumns, collb, colub);
+	std::copy(this->objective, this->objective + this->numberOfColumns, obj);
+	std::copy(this->row_lb, this->row_lb + this->numberOfRows, rowlb);
+	std::copy(this->row_ub, this->row_ub + this->numberOfRows, rowub);
+
+	this->si->assignProblem(matrix, collb, colub, obj, rowlb, rowub);
+	pushIntegerColumns(0, this->numberOfColumns);
+	this->basisAvailable = false;
+	clearChanges();
+}
+
+void OsiProblemInstance::updateProblem() {
+	CoefficientMatrix newColumns { }, newRows { };
+	size_t numberOfChangedCoefficients { 0 };
+
+	if (!this->problemLoaded || this->presolveEnabled
+			|| this->presolve != nullptr) {
+		loadProblem();
+		return;
+	}
+
+	this->coefficients->forEachFrom(this->loadedElements,
+			[&](const RowIdx rowIdx, const VarIdx columnIdx, const VarValue value) {
+				if (rowIdx >= this->loadedRows) {
+					newRows.add(rowIdx - this->loadedRows, columnIdx, value);
+				} else if (columnIdx >= this->loadedColumns) {
+					newColumns.add(rowIdx, columnIdx - this->loadedColumns, value);
+				} else {
+					numberOfChangedCoefficients += 1;
+				}
+			});
+
+	if (numberOfChangedCoefficients > 0) {
+		INFO(logger, BundleKey::UPDATE_PROBLEM_RELOAD,
+				numberOfChangedCoefficients);
+		loadProblem();
+		return;
+	}
+
+	INFO(logger, BundleKey::UPDATE_PROBLEM, this->deletedColumns.size(),
+			this->deletedRows.size(), this->dirtyColumns.size(),
+			this->dirtyRows.size(), this->numberOfColumns - this->loadedColumns,
+			this->numberOfRows - this->loadedRows);
+
+	pushDeletions();
+	pushDirtyColumns();
+	pushDirtyRows();
+	pushNewColumns(newColumns);
+	pushNewRows(newRows);
+	clearChanges();
+}
+
+void OsiProblemInstance::releaseCoefficientsCache() {
+	this->coefficients->releaseCache();
+}
+
+SolveStatus OsiProblemInstance::solve(const SolveOptions& options,
+		const std::atomic<bool>* cancelled) {
+	typedef std::chrono::steady_clock Clock;
+	const Clock::time_point start { Clock::now() };
+	Clock::time_point lastProgress { start };
+	const int numberOfIntegers { this->si->getNumIntegers() };
+	const bool sliced { (options.timeLimit > 0 || options.progressCallback
+			|| cancelled != nullptr) && numberOfIntegers == 0 };
+	int maxIterations { }, numberOfIterations { 0 };
+	double elapsedTime { }, maximumSeconds { };
+	SolveStatus status { };
+	CbcModel* cbcModel { };
+
+	INFO(logger, BundleKey::SOLVE_PROBLEM, this->numberOfColumns,
+			this->numberOfRows, this->basisAvailable ? "warm" : "cold");
+	if (cancelled != nullptr && cancelled->load()) {
+		status = SolveStatus::CANCELLED;
+	} else if (!sliced) {
+		if (numberOfIntegers > 0 && options.timeLimit > 0) {
+			if (this->solverInterface == CBC) {
+				cbcModel = dynamic_cast<OsiCbcSolverInterface*>(this->si)->getModelPtr();
+				maximumSeconds = cbcModel->getMaximumSeconds();
+				cbcModel->setMaximumSeconds(options.timeLimit);
+			} else {
+				WARN(logger, BundleKey::SOLVE_MIP_TIME_LIMIT_IGNORED,
+						options.timeLimit, numberOfIntegers,
+						SOLVER_INTERFACE_NAMES[this->solverInterface]);
+			}
+		}
+		status = solve(this->si, this->basisAvailable);
+		numberOfIterations = this->si->getIterationCount();
+		this->basisAvailable = true;
+		if (cbcModel != nullptr) {
+			cbcModel->setMaximumSeconds(maximumSeconds);
+			if (cbcModel->isSecondsLimitReached()) {
+				status = SolveStatus::LIMIT_REACHED;
+			}
+		}
+		if (numberOfIntegers > 0 && cancelled != nullptr && cancelled->load()) {
+			WARN(logger, BundleKey::SOLVE_MIP_CANCEL_IGNORED, numberOfIntegers);
+		}
+	} else {
+		this->si->getIntParam(OsiMaxNumIteration, maxIterations);
+		while (true) {
+			this->si->setIntParam(OsiMaxNumIteration,
+					std::min(ITERATIONS_PER_SLICE,
+							maxIterations - numberOfIterations));
+			status = solve(this->si, this->basisAvailable);
+			this->basisAvailable = true;
+			numberOfIterations += this->si->getIterationCount();
+			elapsedTime = std::chrono::duration<double>(Clock::now() - start).count();
+			if (status != SolveStatus::LIMIT_REACHED
+					|| numberOfIterations >= maxIterations) {
+				break;
+			}
+			if (cancelled != nullptr && cancelled->load()) {
+				status = SolveStatus::CANCELLED;
+				break;
+			}
+			if (options.timeLimit > 0 && elapsedTime >= options.timeLimit) {
+				break;
+			}
+			if (options.progressCallback
+					&& std::chrono::duration<double>(Clock::now() - lastProgress).count()
+							>= options.progressInterval) {
+				options.progressCallback(SolveProgress { numberOfIterations,
+						getObjectiveValue(), getDualBound(), elapsedTime });
+				lastProgress = Clock::now();
+			}
+		}
+		this->si->setIntParam(OsiMaxNumIteration, maxIterations);
+	}
+	if (this->presolve != nullptr && status != SolveStatus::CANCELLED) {
+		this->presolve->postsolve(this->si);
+	}
+	INFO(logger, BundleKey::SOLVE_PROBLEM_DONE, status, numberOfIterations,
+			getObjectiveValue());
+	return status;
+}
+
+bool OsiProblemInstance::getBasis(std::vector<char>& columnStatus,
+		std::vector<char>& rowStatus) const {
+	if (this->presolve != nullptr || !this->deletedColumns.empty()
+			|| !this->deletedRows.empty()) {
+		return false;
+	}
+	CoinWarmStart* warmStart { this->si->getWarmStart() };
+	const CoinWarmStartBasis* basis {
+			dynamic_cast<const CoinWarmStartBasis*>(warmStart) };
+	const bool valid { basis != nullptr
+			&& basis->getNumStructural() == (int) this->numberOfColumns
+			&& basis->getNumArtificial() == (int) this->numberOfRows };
+	if (valid) {
+		columnStatus.resize(this->numberOfColumns);
+		rowStatus.resize(this->numberOfRows);
+		for (VarIdx j = 0; j < this->numberOfColumns; j += 1) {
+			columnStatus[j] = (char) basis->getStructStatus((int) j);
+		}
+		for (RowIdx i = 0; i < this->numberOfRows; i += 1) {
+			rowStatus[i] = (char) basis->getArtifStatus((int) i);
+		}
+	}
+	delete warmStart;
+	return valid;
+}
+
+void OsiProblemInstance::setBasis(const std::vector<char>& columnStatus,
+		const std::vector<char>& rowStatus) {
+	if (this->presolve != nullptr) {
+		return;
+	}
+	CoinWarmStartBasis basis { };
+	basis.setSize((int) this->numberOfColumns, (int) this->numberOfRows);
+	for (VarIdx j = 0; j < this->numberOfColumns; j += 1) {
+		basis.setStructStatus((int) j,
+				(CoinWarmStartBasis::Status) columnStatus[j]);
+	}
+	for (RowIdx i = 0; i < this->numberOfRows; i += 1) {
+		basis.setArtifStatus((int) i, (CoinWarmStartBasis::Status) rowStatus[i]);
+	}
+	this->basisAvailable = this->si->setWarmStart(&basis);
+}
+
+const VarValue* OsiProblemInstance::getSolution(
+		const Solution::Part part) const {
+	const bool columns { part != Solution::Part::ROW_PRICES };
+	if (this->presolve != nullptr) {
+		return this->presolve->numberOfColumns == this->numberOfColumns
+				&& this->deletedColumns.empty() && this->deletedRows.empty()
+				&& this->presolve->numberOfRows == this->numberOfRows ?
+				this->presolve->getSolution(part) : nullptr;
+	}
+	if (!this->problemLoaded || !this->deletedColumns.empty()
+			|| !this->deletedRows.empty()
+			|| (columns ?
+					this->si->getNumCols() != (int) this->numberOfColumns :
+					this->si->getNumRows() != (int) this->numberOfRows)) {
+		return nullptr;
+	}
+	switch (part) {
+	case Solution::Part::COLUMN_VALUES:
+		return this->si->getColSolution();
+	case Solution::Part::REDUCED_COSTS:
+		return this->si->getReducedCost();
+	default:
+		return this->si->getRowPrice();
+	}
+}
+
+void OsiProblemInstance::copySolution(Solution& solution) const {
+	const VarValue* values { };
+	for (const Solution::Part part : { Solution::Part::COLUMN_VALUES,
+			Solution::Part::REDUCED_COSTS, Solution::Part::ROW_PRICES }) {
+		values = getSolution(part);
+		if (values != nullptr) {
+			solution.parts[part].assign(values,
+					values
+							+ (part == Solution::Part::ROW_PRICES ?
+									this->numberOfRows : this->numberOfColumns));
+		} else {
+			solution.parts[part].clear();
+		}
+	}
+	solution.objectiveValue = this->problemLoaded ? getObjectiveValue() : 0;
+}
+
+void OsiProblemInstance::solveScenarios(const std::vector<Scenario>& scenarios,
+		std::vector<ScenarioResult>& results,
+		const unsigned int numberOfThreads) const {
+	const unsigned int numberOfWorkers { (unsigned int) std::min(
+			(size_t) ThreadUtils::getNumberOfThreads(numberOfThreads),
+			std::max((size_t) 1, scenarios.size())) };
+	std::vector<std::exception_ptr> exceptions(numberOfWorkers);
+	std::atomic<size_t> nextScenario { 0 };
+	size_t numberOfOptimal { 0 };
+
+	INFO(logger, BundleKey::SOLVE_SCENARIOS, scenarios.size(),
+			numberOfWorkers);
+	results.resize(scenarios.size());
+	ThreadUtils::runWorkers(numberOfWorkers, [&](const unsigned int t) {
+		OsiSolverInterface* si { };
+		bool warmStart {false};
+		size_t k { };
+		try {
+			si = this->si->clone(true);
+			si->messageHandler()->setLogLevel(0);
+			while ((k = nextScenario.fetch_add(1)) < scenarios.size()) {
+				applyScenario(si, scenarios[k]);
+				results[k].status = solve(si, warmStart);
+				results[k].objectiveValue = si->getObjValue();
+				results[k].numberOfIterations = si->getIterationCount();
+				results[k].columnValues.assign(si->getColSolution(),
+						si->getColSolution() + si->getNumCols());
+				revertScenario(si, scenarios[k]);
+				warmStart = true;
+			}
+		} catch (...) {
+			// e.g. CoinError of the solver - other workers stop after their current scenario
+			exceptions[t] = std::current_exception();
+			nextScenario.store(scenarios.size());
+		}
+		delete si;
+	});
+
+	for (std::exception_ptr& exception : exceptions) {
+		if (exception) {
+			std::rethrow_exception(exception);
+		}
+	}
+
+	for (const ScenarioResult& result : results) {
+		numberOfOptimal += result.status == SolveStatus::OPTIMAL;
+	}
+	INFO(logger, BundleKey::SOLVE_SCENARIOS_DONE, numberOfOptimal,
+			scenarios.size());
+}
+
+size_t OsiProblemInstance::checkColumnBounds(const VarIdx firstIdx,
+		const VarIdx count, const VarValue* lowerBounds,
+		const VarValue* upperBounds, const size_t stride,
+		BoundsReport& report) const {
+	const bool* fixed { this->col_fixed + firstIdx };
+	const VarValue* value { this->col_value + firstIdx };
+	size_t numberOfFailures { 0 };
+	VarValue lowerBound { }, upperBound { };
+
+	// rejected columns are counted without branches and described only if there are any
+	for (VarIdx i = 0; i < count; i += 1) {
+		lowerBound = lowerBounds[i * stride];
+		upperBound = upperBounds[i * stride];
+		numberOfFailures += (!(lowerBound <= upperBound))
+				| (fixed[i] & !((lowerBound <= value[i]) & (value[i] <= upperBound)));
+	}
+	for (VarIdx i = 0; i < count && numberOfFailures > 0
+					&& report.failures.size() < BoundsReport::MAX_NUMBER_OF_FAILURES;
+			i += 1) {
+		lowerBound = lowerBounds[i * stride];
+		upperBound = upperBounds[i * stride];
+		if (!(lowerBound <= upperBound)) {
+			report.failures.push_back( { BoundsFailure::INVALID_BOUNDS, firstIdx
+					+ i, lowerBound, upperBound, 0 });
+		} else if (fixed[i]
+				&& !(lowerBound <= value[i] && value[i] <= upperBound)) {
+			report.failures.push_back( {
+					BoundsFailure::FIXED_VALUE_OUT_OF_BOUNDS, firstIdx + i,
+					lowerBound, upperBound, value[i] });
+		}
+	}
+	report.numberOfFailures += numberOfFailures;
+	return numberOfFailures;
+}
+
+void OsiProblemInstance::setColumnBounds(const VarIdx firstIdx,
+		const VarIdx count, const VarValue* lowerBounds,
+		const VarValue* upperBounds, const size_t stride) {
+	for (VarIdx i = 0; i < count; i += 1) {
+		this->col_lb[firstIdx + i] = lowerBounds[i * stride];
+		this->col_ub[firstIdx + i] = upperBounds[i * stride];
+	}
+	for (VarIdx j = firstIdx; j < firstIdx + count; j += 1) {
+		markColumnDirty(j);
+	}
+}
+
+size_t OsiProblemInstance::checkColumnValues(const VarIdx firstIdx,
+		const VarIdx count, const VarValue* values, const size_t stride,
+		BoundsReport& report) const {
+	const VarValue* lowerBound { this->col_lb + firstIdx };
+	const VarValue* upperBound { this->col_ub + firstIdx };
+	size_t numberOfFailures { 0 };
+	VarValue value { };
+
+	for (VarIdx i = 0; i < count; i += 1) {
+		value = values[i * stride];
+		numberOfFailures += !((lowerBound[i] <= value)
+				& (value <= upperBound[i]));
+	}
+	for (VarIdx i = 0; i < count && numberOfFailures > 0
+					&& report.failures.size() < BoundsReport::MAX_NUMBER_OF_FAILURES;
+			i += 1) {
+		value = values[i * stride];
+		if (!(lowerBound[i] <= value && value <= upperBound[i])) {
+			report.failures.push_back( { BoundsFailure::VALUE_OUT_OF_BOUNDS,
+					firstIdx + i, lowerBound[i], upperBound[i], value });
+		}
+	}
+	report.numberOfFailures += numberOfFailures;
+	return numberOfFailures;
+}
+
+void OsiProblemInstance::fixColumnValues(const VarIdx firstIdx,
+		const VarIdx count, const VarValue* values, const size_t stride) {
+	for (VarIdx i = 0; i < count; i += 1) {
+		this->col_fixed[firstIdx + i] = true;
+		this->col_value[firstIdx + i] = values[i * stride];
+	}
+	for (VarIdx j = firstIdx; j < firstIdx + count; j += 1) {
+		markColumnDirty(j);
+	}
+}
+
+void OsiProblemInstance::unfixColumns(const VarIdx firstIdx,
+		const VarIdx count) {
+	for (VarIdx j = firstIdx; j < firstIdx + count; j += 1) {
+		if (this->col_fixed[j]) {
+			this->col_fixed[j] = false;
+			markColumnDirty(j);
+		}
+	}
 }
 
 //*************************************** GETTERS & SETTERS ****************************************//
@@ -47,7 +1039,111 @@ VarIdx OsiProblemInstance::getNumberOfColumns() const {
 	return this->numberOfColumns;
 }
 
+VarValue OsiProblemInstance::getColumnLowerBound(const VarIdx columnIdx) const {
+	return this->col_lb[columnIdx];
+}
+
+void OsiProblemInstance::setColumnLowerBound(const VarIdx columnIdx,
+		const VarValue lowerBound) {
+	this->col_lb[columnIdx] = lowerBound;
+	markColumnDirty(columnIdx);
+}
+
+VarValue OsiProblemInstance::getColumnUpperBound(const VarIdx columnIdx) const {
+	return this->col_ub[columnIdx];
+}
+
+void OsiProblemInstance::setColumnUpperBound(const VarIdx columnIdx,
+		const VarValue upperBound) {
+	this->col_ub[columnIdx] = upperBound;
+	markColumnDirty(columnIdx);
+}
+
+VarValue OsiProblemInstance::getColumnObjective(const VarIdx columnIdx) const {
+	return this->objective[columnIdx];
+}
+
+void OsiProblemInstance::setColumnObjective(const VarIdx columnIdx,
+		const VarValue coefficient) {
+	this->objective[columnIdx] = coefficient;
+	markColumnDirty(columnIdx);
+}
+
+bool OsiProblemInstance::isColumnFixed(const VarIdx columnIdx) const {
+	return this->col_fixed[columnIdx];
+}
+
+VarValue OsiProblemInstance::getColumnValue(const VarIdx columnIdx) const {
+	return this->col_value[columnIdx];
+}
+
+void OsiProblemInstance::fixColumnValue(const VarIdx columnIdx,
+		const VarValue value) {
+	this->col_fixed[columnIdx] = true;
+	this->col_value[columnIdx] = value;
+	markColumnDirty(columnIdx);
+}
+
+ColumnView OsiProblemInstance::getColumnCoefficients(
+		const VarIdx columnIdx) const {
+	return this->coefficients->getColumn(columnIdx, this->numberOfColumns,
+			this->numberOfRows);
+}
+
+RowIdx OsiProblemInstance::getNumberOfRows() const {
+	return this->numberOfRows;
+}
+
+VarValue OsiProblemInstance::getRowLowerBound(const RowIdx rowIdx) const {
+	return this->row_lb[rowIdx];
+}
+
+void OsiProblemInstance::setRowLowerBound(const RowIdx rowIdx,
+		const VarValue lowerBound) {
+	this->row_lb[rowIdx] = lowerBound;
+	markRowDirty(rowIdx);
+}
+
+VarValue OsiProblemInstance::getRowUpperBound(const RowIdx rowIdx) const {
+	return this->row_ub[rowIdx];
+}
+
+void OsiProblemInstance::setRowUpperBound(const RowIdx rowIdx,
+		const VarValue upperBound) {
+	this->row_ub[rowIdx] = upperBound;
+	markRowDirty(rowIdx);
+}
+
+RowView OsiProblemInstance::getRowCoefficients(const RowIdx rowIdx) const {
+	return this->coefficients->getRow(rowIdx, this->numberOfColumns,
+			this->numberOfRows);
+}
+
+size_t OsiProblemInstance::getNumberOfElements() const {
+	return this->coefficients->getNumberOfElements();
+}
+
 OsiSolverInterface* OsiProblemInstance::getOsiSolverInterface() const {
 	return this->si;
 }
 
+SolverInterface OsiProblemInstance::getSolverInterface() const {
+	return this->solverInterface;
+}
+
+VarValue OsiProblemInstance::getObjectiveValue() const {
+	return this->si->getObjValue()
+			+ (this->presolve != nullptr ? this->presolve->getObjectiveOffset() : 0);
+}
+
+void OsiProblemInstance::setPresolveEnabled(const bool presolveEnabled) {
+	this->presolveEnabled = presolveEnabled;
+}
+
+bool OsiProblemInstance::isPresolveEnabled() const {
+	return this->presolveEnabled;
+}
+
+const Presolve* OsiProblemInstance::getPresolve() const {
+	return this->presolve;
+}
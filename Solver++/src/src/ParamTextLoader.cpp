@@ -0,0 +1,353 @@
+/*
+ * ParamTextLoader.cpp
+ *
+ *  Created on: 17 paź 2026
+ *      Author: tomasz
+ */
+
+#include "../include/ParamTextLoader.hpp"
+
+#include <fcntl.h>
+#include <log4cxx/helpers/messagebuffer.h>
+#include <log4cxx/logger.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cstring>
+#include <exception>
+#include <thread>
+#include <unordered_map>
+
+#include "../include/log/bundle/Bundle.hpp"
+#include "../include/log/utils/LogUtils.hpp"
+#include "../include/ParameterIdxMapper.hpp"
+#include "../include/utils/StringUtils.hpp"
+#include "../include/utils/ThreadUtils.hpp"
+
+const log4cxx::LoggerPtr logger(log4cxx::Logger::getLogger("ParamTextLoader"));
+
+namespace {
+
+inline bool isBlank(const char c) {
+	return c == ' ' || c == '\t' || c == '\r';
+}
+
+inline const char* skipBlanks(const char* pos, const char* end) {
+	while (pos < end && isBlank(*pos)) {
+		pos += 1;
+	}
+	return pos;
+}
+
+/** Skips separator of fields (blanks with at most one comma or semicolon), returns nullptr if there is none.
+ *
+ */
+inline const char* skipSeparator(const char* pos, const char* end) {
+	const char* begin { pos };
+	pos = skipBlanks(pos, end);
+	if (pos < end && (*pos == ',' || *pos == ';')) {
+		pos = skipBlanks(pos + 1, end);
+	}
+	return pos == begin ? nullptr : pos;
+}
+
+/** Reads from file until given buffer is full or end of file is reached, returns number of bytes read.
+ *
+ */
+size_t readBlock(const int fd, char* buffer, const size_t size)
+		throw (ParameterModelExceptions::DataFileException) {
+	size_t position { 0 };
+	ssize_t count { };
+	while (position < size) {
+		count = read(fd, buffer + position, size - position);
+		if (count < 0) {
+			throw ParameterModelExceptions::DataFileException();
+		} else if (count == 0) {
+			break;
+		}
+		position += count;
+	}
+	return position;
+}
+
+}
+
+//************************************ PRIVATE CONSTANT FIELDS *************************************//
+
+//***************************************** CLASS FIELDS *******************************************//
+
+//*************************************** PRIVATE FUNCTIONS ****************************************//
+
+ParamTextLoader::LineKind ParamTextLoader::readLine(const char* begin,
+		const char* end, size_t& idx, ParamValue& value) const {
+	const ParamDimensionTable& dimensions =
+			this->parameterGroup->getDimensions();
+	const char* pos { skipBlanks(begin, end) };
+	ParamDimIdx index { };
+
+	if (pos == end || *pos == '#') {
+		return LineKind::BLANK;
+	}
+	idx = 0;
+	for (ParamDimIdx i = 0; i < dimensions.getNumberOfDimensions(); i += 1) {
+		pos = StringUtils::parseUnsigned<ParamDimIdx>(pos, end, index);
+		if (pos == nullptr || index == 0 || index > dimensions.getExtent(i)
+				|| (pos = skipSeparator(pos, end)) == nullptr) {
+			return LineKind::INVALID;
+		}
+		idx += (size_t) (index - 1) * dimensions.getStride(i);
+	}
+	pos = StringUtils::parseNumber(pos, end, value);
+	if (pos == nullptr || skipBlanks(pos, end) != end
+			|| this->parameterGroup->isValueOutOfBounds(value)) {
+		return LineKind::INVALID;
+	}
+	return LineKind::ENTRY;
+}
+
+bool ParamTextLoader::parseLine(const char* begin, const char* end,
+		Counters& counters) {
+	size_t idx { };
+	ParamValue value { };
+	uint64_t bit { };
+
+	counters.numberOfLines += 1;
+	switch (readLine(begin, end, idx, value)) {
+	case LineKind::BLANK:
+		return true;
+	case LineKind::INVALID:
+		return false;
+	case LineKind::ENTRY:
+		break;
+	}
+
+	bit = (uint64_t) 1 << (idx % 64);
+	if (this->assigned[idx / 64].fetch_or(bit, std::memory_order_relaxed)
+			& bit) {
+		counters.numberOfDuplicates += 1;
+		counters.firstDuplicate = std::min(counters.firstDuplicate, idx);
+		counters.duplicates.push_back(idx);
+	} else {
+		this->parameterGroup->getValues()[idx] = value;
+		counters.numberOfValues += 1;
+	}
+	return true;
+}
+
+void ParamTextLoader::parsePiece(const char* begin, const char* end,
+		bool header, Counters& counters) {
+	const char* lineEnd { };
+	while (begin < end) {
+		lineEnd = static_cast<const char*>(memchr(begin, '\n', end - begin));
+		lineEnd = lineEnd == nullptr ? end : lineEnd;
+		if (!parseLine(begin, lineEnd, counters) && !header) {
+			counters.numberOfInvalidLines += 1;
+		}
+		header = false;
+		begin = lineEnd + 1;
+	}
+}
+
+void ParamTextLoader::parseBlock(const char* begin, const char* end,
+		const bool header, std::vector<Counters>& counters) {
+	std::vector<const char*> pieces(this->numberOfThreads + 1, end);
+	const char* lineEnd { };
+	pieces[0] = begin;
+	for (unsigned int t = 1; t < this->numberOfThreads; t += 1) {
+		pieces[t] = std::max(pieces[t - 1],
+				begin + (end - begin) * t / this->numberOfThreads);
+		lineEnd = static_cast<const char*>(memchr(pieces[t], '\n',
+				end - pieces[t]));
+		pieces[t] = lineEnd == nullptr ? end : lineEnd + 1;
+	}
+	ThreadUtils::runWorkers(this->numberOfThreads,
+			[&](const unsigned int t) {
+				parsePiece(pieces[t], pieces[t + 1], header && t == 0, counters[t]);
+			});
+	for (const Counters& c : counters) {
+		if (!c.duplicates.empty()) {
+			resolveDuplicates(pieces, counters);
+			break;
+		}
+	}
+}
+
+void ParamTextLoader::resolveDuplicates(
+		const std::vector<const char*>& pieces,
+		std::vector<Counters>& counters) {
+	std::unordered_map<size_t, size_t> slots { };
+	std::vector<size_t> numberOfRejected { };
+	std::vector<std::vector<size_t>> numberOfFound(this->numberOfThreads);
+	std::vector<std::vector<ParamValue>> firstValue(this->numberOfThreads);
+	size_t numberOfFoundInBlock { };
+
+	for (Counters& c : counters) {
+		for (const size_t idx : c.duplicates) {
+			if (slots.emplace(idx, slots.size()).second) {
+				numberOfRejected.push_back(0);
+			}
+			numberOfRejected[slots[idx]] += 1;
+		}
+		c.duplicates.clear();
+	}
+
+	ThreadUtils::runWorkers(this->numberOfThreads,
+			[&](const unsigned int t) {
+				const char* begin {pieces[t]};
+				const char* lineEnd {};
+				size_t idx {};
+				ParamValue value {};
+				std::unordered_map<size_t, size_t>::const_iterator slot {};
+				numberOfFound[t].assign(slots.size(), 0);
+				firstValue[t].resize(slots.size());
+				while (begin < pieces[t + 1]) {
+					lineEnd = static_cast<const char*>(memchr(begin, '\n', pieces[t + 1] - begin));
+					lineEnd = lineEnd == nullptr ? pieces[t + 1] : lineEnd;
+					if (readLine(begin, lineEnd, idx, value) == LineKind::ENTRY
+							&& (slot = slots.find(idx)) != slots.end()
+							&& numberOfFound[t][slot->second]++ == 0) {
+						firstValue[t][slot->second] = value;
+					}
+					begin = lineEnd + 1;
+				}
+			});
+
+	for (const std::pair<const size_t, size_t>& slot : slots) {
+		numberOfFoundInBlock = 0;
+		for (unsigned int t = 0; t < this->numberOfThreads; t += 1) {
+			numberOfFoundInBlock += numberOfFound[t][slot.second];
+		}
+		if (numberOfFoundInBlock == numberOfRejected[slot.second]) {
+			// value has been read from previous block
+			continue;
+		}
+		for (unsigned int t = 0; t < this->numberOfThreads; t += 1) {
+			if (numberOfFound[t][slot.second] > 0) {
+				this->parameterGroup->getValues()[slot.first] =
+						firstValue[t][slot.second];
+				break;
+			}
+		}
+	}
+}
+
+//************************************* PUBLIC CONSTANT FIELDS *************************************//
+
+const size_t ParamTextLoader::DEFAULT_BLOCK_SIZE;
+
+//************************************ CONSTRUCTOR & DESTRUCTOR ************************************//
+
+ParamTextLoader::ParamTextLoader(ParamIdxMapper* parameterGroup,
+		const ParamValue defaultValue, const unsigned int numberOfThreads,
+		const size_t blockSize) :
+		parameterGroup(parameterGroup), defaultValue(defaultValue), numberOfThreads(
+				ThreadUtils::getNumberOfThreads(numberOfThreads)), blockSize(
+				std::max((size_t) 1, blockSize)), assigned(
+				(parameterGroup->getNumberOfParameters() + 63) / 64) {
+}
+
+ParamTextLoader::~ParamTextLoader() {
+}
+
+//*************************************** PUBLIC FUNCTIONS *****************************************//
+
+ParamLoadReport ParamTextLoader::load(const std::string& fileName)
+		throw (ParameterModelExceptions::DataFileException) {
+	const size_t numberOfParameters {
+			this->parameterGroup->getNumberOfParameters() };
+	std::vector<Counters> counters(this->numberOfThreads,
+			Counters { 0, 0, 0, 0, numberOfParameters, { } });
+	std::vector<char> current { }, next { };
+	size_t currentSize { }, nextSize { }, carry { }, lineEnd { };
+	bool endOfFile { false }, header { true };
+	std::exception_ptr readException { };
+	ParamLoadReport report { 0, 0, 0, 0, 0 };
+	const int fd { open(fileName.c_str(), O_RDONLY) };
+
+	if (fd < 0) {
+		FATAL(logger, BundleKey::LOAD_PARAM_TEXT_FAILED, fileName.c_str());
+		throw ParameterModelExceptions::DataFileException();
+	}
+	INFO(logger, BundleKey::LOAD_PARAM_TEXT,
+			this->parameterGroup->getGroupName().c_str(), fileName.c_str(),
+			this->numberOfThreads);
+
+	ThreadUtils::runWorkers(this->numberOfThreads,
+			[&](const unsigned int t) {
+				const size_t begin {numberOfParameters * t / this->numberOfThreads};
+				const size_t end {numberOfParameters * (t + 1) / this->numberOfThreads};
+				std::fill(this->parameterGroup->getValues() + begin,
+						this->parameterGroup->getValues() + end, this->defaultValue);
+				for (size_t w = begin / 64; w < std::min(this->assigned.size(), (end + 63) / 64); w += 1) {
+					this->assigned[w].store(0, std::memory_order_relaxed);
+				}
+			});
+
+	try {
+		current.resize(this->blockSize);
+		currentSize = readBlock(fd, current.data(), current.size());
+		endOfFile = currentSize < current.size();
+		while (currentSize > 0) {
+			lineEnd = currentSize;
+			if (!endOfFile) {
+				while (lineEnd > 0 && current[lineEnd - 1] != '\n') {
+					lineEnd -= 1;
+				}
+			}
+			carry = currentSize - lineEnd;
+			next.resize(std::max(this->blockSize, carry + this->blockSize));
+			std::copy(current.begin() + lineEnd, current.begin() + currentSize,
+					next.begin());
+			nextSize = carry;
+			std::thread reader { [&]() {
+				try {
+					if (!endOfFile) {
+						nextSize += readBlock(fd, next.data() + carry, next.size() - carry);
+						endOfFile = nextSize < next.size();
+					}
+				} catch (...) {
+					readException = std::current_exception();
+				}
+			} };
+			if (lineEnd > 0) {
+				parseBlock(current.data(), current.data() + lineEnd, header,
+						counters);
+				header = false;
+			}
+			reader.join();
+			if (readException) {
+				std::rethrow_exception(readException);
+			}
+			current.swap(next);
+			currentSize = nextSize;
+		}
+	} catch (const ParameterModelExceptions::DataFileException& e) {
+		close(fd);
+		FATAL(logger, BundleKey::LOAD_PARAM_TEXT_FAILED, fileName.c_str());
+		throw;
+	}
+	close(fd);
+
+	size_t firstDuplicate { numberOfParameters };
+	for (const Counters& c : counters) {
+		report.numberOfLines += c.numberOfLines;
+		report.numberOfValues += c.numberOfValues;
+		report.numberOfDuplicates += c.numberOfDuplicates;
+		report.numberOfInvalidLines += c.numberOfInvalidLines;
+		firstDuplicate = std::min(firstDuplicate, c.firstDuplicate);
+	}
+	report.numberOfMissing = numberOfParameters - report.numberOfValues;
+
+	INFO(logger, BundleKey::LOAD_PARAM_TEXT_DONE, report.numberOfLines,
+			report.numberOfValues, report.numberOfMissing);
+	if (report.numberOfDuplicates != 0 && firstDuplicate < numberOfParameters) {
+		WARN(logger, BundleKey::LOAD_PARAM_TEXT_DUPLICATES,
+				report.numberOfDuplicates,
+				this->parameterGroup->getParameterName(
+						static_cast<ParamIdx>(firstDuplicate)).c_str());
+	}
+	if (report.numberOfInvalidLines != 0) {
+		WARN(logger, BundleKey::LOAD_PARAM_TEXT_INVALID,
+				report.numberOfInvalidLines, fileName.c_str());
+	}
+	return report;
+}
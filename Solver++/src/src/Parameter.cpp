@@ -7,7 +7,14 @@
 
 #include "../include/Parameter.hpp"
 
+#include <log4cxx/helpers/messagebuffer.h>
 #include <log4cxx/logger.h>
+#include <sstream>
+
+#include "../include/log/bundle/Bundle.hpp"
+#include "../include/log/utils/LogUtils.hpp"
+#include "../include/ParameterIdxMapper.hpp"
+#include "../include/utils/Utils.hpp"
 
 const log4cxx::LoggerPtr logger(log4cxx::Logger::getLogger("Parameter"));
 
@@ -21,6 +28,58 @@ const log4cxx::LoggerPtr logger(log4cxx::Logger::getLogger("Parameter"));
 
 //************************************ CONSTRUCTOR & DESTRUCTOR ************************************//
 
+Parameter::Parameter(ParamIdxMapper* parameterGroup, const ParamIdx idx) :
+		parameterGroup(parameterGroup), idx(idx) {
+}
+
 //*************************************** PUBLIC FUNCTIONS *****************************************//
 
+bool Parameter::isParameterOutOfBounds(const ParamValue value) const {
+	return this->parameterGroup->isValueOutOfBounds(value);
+}
+
+std::string Parameter::toString() const {
+	std::ostringstream os { };
+	os << "\tName of parameter:\t\t" << this->getParameterName()
+			<< "\n\tParameter's lower bound\t\t:\t"
+			<< Utils::getStringBound(this->getLowerBound())
+			<< "\n\tParameter's upper bound\t\t:\t"
+			<< Utils::getStringBound(this->getUpperBound())
+			<< "\n\tParameter's value\t\t:\t" << this->getValue() << std::endl;
+	return os.str();
+}
+
 //*************************************** GETTERS & SETTERS ****************************************//
+
+ParamValue Parameter::getValue() const {
+	return this->parameterGroup->getValues()[this->idx];
+}
+
+void Parameter::setValue(const ParamValue value)
+		throw (ParameterModelExceptions::ValueOutOfBoundException) {
+	if (!this->isParameterOutOfBounds(value)) {
+		this->parameterGroup->getValues()[this->idx] = value;
+	} else {
+		FATAL(logger, BundleKey::SET_PARAM_VALUE_OUT_OF_BOUNDS, value,
+				this->getParameterName().c_str(),
+				Utils::getStringBound(this->getLowerBound()).c_str(),
+				Utils::getStringBound(this->getUpperBound()).c_str());
+		throw ParameterModelExceptions::ValueOutOfBoundException();
+	}
+}
+
+ParamValue Parameter::getLowerBound() const {
+	return this->parameterGroup->getLowerBound();
+}
+
+ParamValue Parameter::getUpperBound() const {
+	return this->parameterGroup->getUpperBound();
+}
+
+std::string Parameter::getParameterName() const {
+	return this->parameterGroup->getParameterName(this->idx);
+}
+
+ParamIdx Parameter::getIdx() const {
+	return this->idx;
+}
@@ -7,7 +7,18 @@
 
 #include "../include/ParameterIdxMapper.hpp"
 
+#include <log4cxx/helpers/messagebuffer.h>
 #include <log4cxx/logger.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <new>
+#include <sstream>
+
+#include "../include/log/bundle/Bundle.hpp"
+#include "../include/log/utils/LogUtils.hpp"
+#include "../include/Parameter.hpp"
+#include "../include/utils/MapperUtils.hpp"
+#include "../include/utils/Utils.hpp"
 
 const log4cxx::LoggerPtr logger(
 		log4cxx::Logger::getLogger("ParameterIdxMapper"));
@@ -18,11 +29,122 @@ const log4cxx::LoggerPtr logger(
 
 //*************************************** PRIVATE FUNCTIONS ****************************************//
 
+Parameter ParamIdxMapper::getParameter(const ParamIndexTuple& dimensions) {
+	return Parameter { this, MapUtils::linearizeDimensionList<ParamIdx,
+			ParamDimIdx>(this->dimensions, dimensions) };
+}
+
 //************************************* PUBLIC CONSTANT FIELDS *************************************//
 
+const size_t ParamIdxMapper::ALIGNMENT;
+
 //************************************ CONSTRUCTOR & DESTRUCTOR ************************************//
 
+ParamIdxMapper::ParamIdxMapper(const ParamDimensionTable& dimensions,
+		const ParamValue parameterLowerBound,
+		const ParamValue parameterUpperBound, const ValueType type,
+		const ParamValue value, const std::string& groupName) :
+		dimensions(dimensions), numberOfParameters(
+				dimensions.getNumberOfElements()), lowerBound(
+				parameterLowerBound), upperBound(parameterUpperBound), type(
+				type), values(nullptr), mapping { nullptr, 0 }, groupName(
+				groupName) {
+	void* memory { };
+	DEBUG(logger, BundleKey::INIT_PARAM_MAPPER_CONSTRUCTOR,
+			this->numberOfParameters,
+			Utils::getStringDimensions(this->dimensions.getExtents()).c_str(),
+			sizeof(ParamValue) * this->numberOfParameters);
+	if (posix_memalign(&memory, ALIGNMENT,
+			std::max((size_t) 1, (size_t) this->numberOfParameters)
+					* sizeof(ParamValue)) != 0) {
+		throw std::bad_alloc();
+	}
+	this->values = static_cast<ParamValue*>(memory);
+	std::fill_n(this->values, this->numberOfParameters, value);
+}
+
+ParamIdxMapper::ParamIdxMapper(const ParamDimensionTable& dimensions,
+		const TensorFileUtils::Mapping& mapping, const size_t dataOffset,
+		const std::string& groupName) :
+		dimensions(dimensions), numberOfParameters(
+				dimensions.getNumberOfElements()), lowerBound(
+				Utils::getUnbounded(Bounds::LOWER)), upperBound(
+				Utils::getUnbounded(Bounds::UPPER)), type(ValueType::DOUBLE), values(
+				reinterpret_cast<ParamValue*>(static_cast<char*>(mapping.address)
+						+ dataOffset)), mapping(mapping), groupName(groupName) {
+	DEBUG(logger, BundleKey::INIT_PARAM_MAPPER_MAPPED, this->numberOfParameters,
+			Utils::getStringDimensions(this->dimensions.getExtents()).c_str(),
+			this->mapping.size);
+}
+
+ParamIdxMapper::~ParamIdxMapper() {
+	if (this->mapping.address != nullptr) {
+		TensorFileUtils::unmap(this->mapping);
+	} else {
+		free(this->values);
+	}
+}
+
 //*************************************** PUBLIC FUNCTIONS *****************************************//
 
+bool ParamIdxMapper::isValueOutOfBounds(const ParamValue value) const {
+	return !(this->lowerBound <= value && value <= this->upperBound);
+}
+
+std::string ParamIdxMapper::toString() {
+	std::ostringstream os { };
+	os << "\tName of parameters:\t" << groupName
+			<< "\n\tParameters' dimensions:\t"
+			<< Utils::getStringDimensions(this->dimensions.getExtents())
+			<< "\n\tParameters' lower bound\t:\t"
+			<< Utils::getStringBound(this->lowerBound)
+			<< "\n\tParameters' upper bound\t:\t"
+			<< Utils::getStringBound(this->upperBound) << std::endl;
+	return os.str();
+}
+
+ParamDimIdx ParamIdxMapper::getDimensionsSize() {
+	return dimensions.getNumberOfDimensions();
+}
+
 //*************************************** GETTERS & SETTERS ****************************************//
 
+ParamIdx ParamIdxMapper::getNumberOfParameters() const {
+	return numberOfParameters;
+}
+
+std::string ParamIdxMapper::getParameterName(const ParamIdx idx) const {
+	return MapUtils::getVariableName(idx, this->groupName, this->dimensions);
+}
+
+const std::string& ParamIdxMapper::getGroupName() const {
+	return groupName;
+}
+
+const ParamDimensionTable& ParamIdxMapper::getDimensions() const {
+	return dimensions;
+}
+
+ParamValue ParamIdxMapper::getLowerBound() const {
+	return lowerBound;
+}
+
+ParamValue ParamIdxMapper::getUpperBound() const {
+	return upperBound;
+}
+
+ValueType ParamIdxMapper::getType() const {
+	return type;
+}
+
+ParamValue* ParamIdxMapper::getValues() {
+	return values;
+}
+
+const ParamValue* ParamIdxMapper::getValues() const {
+	return values;
+}
+
+ParamSpan ParamIdxMapper::getSpan() const {
+	return ParamSpan { this->values, this->numberOfParameters };
+}
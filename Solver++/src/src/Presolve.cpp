@@ -0,0 +1,547 @@
+/*
+ * Presolve.cpp
+ *
+ *  Created on: 17 paź 2026
+ *      Author: tomasz
+ */
+
+#include "../include/Presolve.hpp"
+
+#include <log4cxx/helpers/messagebuffer.h>
+#include <log4cxx/logger.h>
+#include <OsiSolverInterface.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <functional>
+#include <utility>
+
+#include "../include/CoefficientMatrix.hpp"
+#include "../include/log/bundle/Bundle.hpp"
+#include "../include/log/utils/LogUtils.hpp"
+
+const log4cxx::LoggerPtr logger(log4cxx::Logger::getLogger("Presolve"));
+
+//************************************ PRIVATE CONSTANT FIELDS *************************************//
+
+const unsigned int Presolve::MAX_NUMBER_OF_PASSES;
+
+const RowIdx Presolve::NO_SOURCE;
+
+const double Presolve::TOLERANCE { 1e-9 };
+
+const double Presolve::MIN_IMPROVEMENT { 1e-3 };
+
+//***************************************** CLASS FIELDS *******************************************//
+
+//*************************************** PRIVATE FUNCTIONS ****************************************//
+
+bool Presolve::exceeds(const VarValue value, const VarValue bound) {
+	return value - bound > TOLERANCE * (1 + std::fabs(bound));
+}
+
+void Presolve::setColumnLower(const VarIdx columnIdx,
+		const VarValue lowerBound, const RowIdx source) {
+	if (exceeds(lowerBound, this->columnUpper[columnIdx])) {
+		this->infeasible = true;
+		return;
+	}
+	this->columnLower[columnIdx] = std::min(lowerBound,
+			this->columnUpper[columnIdx]);
+	this->columnLowerSource[columnIdx] = source;
+}
+
+void Presolve::setColumnUpper(const VarIdx columnIdx,
+		const VarValue upperBound, const RowIdx source) {
+	if (exceeds(this->columnLower[columnIdx], upperBound)) {
+		this->infeasible = true;
+		return;
+	}
+	this->columnUpper[columnIdx] = std::max(upperBound,
+			this->columnLower[columnIdx]);
+	this->columnUpperSource[columnIdx] = source;
+}
+
+void Presolve::removeColumn(const VarIdx columnIdx, const VarValue value) {
+	RowIdx rowIdx { };
+	VarValue shift { };
+	this->columnRemoved[columnIdx] = true;
+	this->columnLower[columnIdx] = value;
+	this->columnUpper[columnIdx] = value;
+	this->objectiveOffset += this->objective[columnIdx] * value;
+	for (size_t k = this->columnStart[columnIdx];
+			k < this->columnStart[columnIdx + 1]; k += 1) {
+		rowIdx = this->columnRowIdx[k];
+		if (this->rowRemoved[rowIdx]) {
+			continue;
+		}
+		shift = this->columnElement[k] * value;
+		if (isFinite(this->rowLower[rowIdx])) {
+			this->rowLower[rowIdx] -= shift;
+		}
+		if (isFinite(this->rowUpper[rowIdx])) {
+			this->rowUpper[rowIdx] -= shift;
+		}
+		this->rowLength[rowIdx] -= 1;
+	}
+	this->numberOfFixedColumns += 1;
+}
+
+bool Presolve::removeFixedColumns() {
+	bool changed { false };
+	for (VarIdx j = 0; j < this->numberOfColumns; j += 1) {
+		if (!this->columnRemoved[j] && isFinite(this->columnLower[j])
+				&& !exceeds(this->columnUpper[j], this->columnLower[j])) {
+			removeColumn(j, this->columnLower[j]);
+			changed = true;
+		}
+	}
+	return changed;
+}
+
+bool Presolve::removeShortRows() {
+	bool changed { false };
+	VarIdx columnIdx { };
+	VarValue coefficient { }, lowerBound { }, upperBound { };
+	for (RowIdx i = 0; i < this->numberOfRows && !this->infeasible; i += 1) {
+		if (this->rowRemoved[i] || this->rowLength[i] > 1) {
+			continue;
+		}
+		if (this->rowLength[i] == 0) {
+			if (exceeds(this->rowLower[i], 0) || exceeds(0, this->rowUpper[i])) {
+				this->infeasible = true;
+			}
+			this->numberOfEmptyRows += 1;
+		} else {
+			for (size_t k = this->rowStart[i]; k < this->rowStart[i + 1]; k +=
+					1) {
+				if (!this->columnRemoved[this->rowColumnIdx[k]]) {
+					columnIdx = this->rowColumnIdx[k];
+					coefficient = this->rowElement[k];
+				}
+			}
+			lowerBound = coefficient > 0 ? this->rowLower[i] : this->rowUpper[i];
+			upperBound = coefficient > 0 ? this->rowUpper[i] : this->rowLower[i];
+			if (isFinite(lowerBound)
+					&& lowerBound / coefficient > this->columnLower[columnIdx]) {
+				setColumnLower(columnIdx, lowerBound / coefficient, i);
+			}
+			if (isFinite(upperBound)
+					&& upperBound / coefficient < this->columnUpper[columnIdx]) {
+				setColumnUpper(columnIdx, upperBound / coefficient, i);
+			}
+			this->reductions.push_back( { Reduction::SINGLETON_ROW, i,
+					columnIdx, coefficient });
+			this->numberOfSingletonRows += 1;
+		}
+		this->rowRemoved[i] = true;
+		changed = true;
+	}
+	return changed;
+}
+
+bool Presolve::tightenBounds() {
+	bool changed { false };
+	VarIdx columnIdx { };
+	VarValue coefficient { }, minActivity { }, maxActivity { },
+			minContribution { }, maxContribution { }, residual { }, bound { };
+	size_t minInfinite { }, maxInfinite { };
+	bool minInfiniteContribution { }, maxInfiniteContribution { };
+
+	for (RowIdx i = 0; i < this->numberOfRows && !this->infeasible; i += 1) {
+		if (this->rowRemoved[i]) {
+			continue;
+		}
+		minActivity = maxActivity = 0;
+		minInfinite = maxInfinite = 0;
+		for (size_t k = this->rowStart[i]; k < this->rowStart[i + 1]; k += 1) {
+			columnIdx = this->rowColumnIdx[k];
+			coefficient = this->rowElement[k];
+			if (this->columnRemoved[columnIdx]) {
+				continue;
+			}
+			minContribution = coefficient > 0 ?
+					this->columnLower[columnIdx] : this->columnUpper[columnIdx];
+			maxContribution = coefficient > 0 ?
+					this->columnUpper[columnIdx] : this->columnLower[columnIdx];
+			if (isFinite(minContribution)) {
+				minActivity += coefficient * minContribution;
+			} else {
+				minInfinite += 1;
+			}
+			if (isFinite(maxContribution)) {
+				maxActivity += coefficient * maxContribution;
+			} else {
+				maxInfinite += 1;
+			}
+		}
+
+		if ((isFinite(this->rowUpper[i]) && minInfinite == 0
+				&& exceeds(minActivity, this->rowUpper[i]))
+				|| (isFinite(this->rowLower[i]) && maxInfinite == 0
+						&& exceeds(this->rowLower[i], maxActivity))) {
+			this->infeasible = true;
+			break;
+		}
+		if ((!isFinite(this->rowLower[i])
+				|| (minInfinite == 0 && !exceeds(this->rowLower[i], minActivity)))
+				&& (!isFinite(this->rowUpper[i])
+						|| (maxInfinite == 0
+								&& !exceeds(maxActivity, this->rowUpper[i])))) {
+			this->rowRemoved[i] = true;
+			this->numberOfRedundantRows += 1;
+			changed = true;
+			continue;
+		}
+
+		// bound implied for column by row is computed from activity of the other columns of row
+		for (size_t k = this->rowStart[i];
+				k < this->rowStart[i + 1] && !this->infeasible; k += 1) {
+			columnIdx = this->rowColumnIdx[k];
+			coefficient = this->rowElement[k];
+			if (this->columnRemoved[columnIdx]) {
+				continue;
+			}
+			minContribution = coefficient > 0 ?
+					this->columnLower[columnIdx] : this->columnUpper[columnIdx];
+			maxContribution = coefficient > 0 ?
+					this->columnUpper[columnIdx] : this->columnLower[columnIdx];
+			minInfiniteContribution = !isFinite(minContribution);
+			maxInfiniteContribution = !isFinite(maxContribution);
+			for (const bool upperRow : { true, false }) {
+				if (upperRow) {
+					if (!isFinite(this->rowUpper[i])
+							|| minInfinite > (size_t) minInfiniteContribution) {
+						continue;
+					}
+					residual = minActivity
+							- (minInfiniteContribution ?
+									0 : coefficient * minContribution);
+					bound = (this->rowUpper[i] - residual) / coefficient;
+				} else {
+					if (!isFinite(this->rowLower[i])
+							|| maxInfinite > (size_t) maxInfiniteContribution) {
+						continue;
+					}
+					residual = maxActivity
+							- (maxInfiniteContribution ?
+									0 : coefficient * maxContribution);
+					bound = (this->rowLower[i] - residual) / coefficient;
+				}
+				// implied bound is relaxed by tolerance, so rounding errors never cut off feasible values
+				if ((coefficient > 0) == upperRow) {
+					bound += TOLERANCE * (1 + std::fabs(bound));
+					if (!isFinite(this->columnUpper[columnIdx])
+							|| this->columnUpper[columnIdx] - bound
+									> MIN_IMPROVEMENT * (1 + std::fabs(bound))) {
+						setColumnUpper(columnIdx, bound, i);
+						this->reductions.push_back( { Reduction::IMPLIED_BOUND, i,
+								columnIdx, coefficient });
+						this->numberOfTightenedBounds += 1;
+						changed = true;
+					}
+				} else {
+					bound -= TOLERANCE * (1 + std::fabs(bound));
+					if (!isFinite(this->columnLower[columnIdx])
+							|| bound - this->columnLower[columnIdx]
+									> MIN_IMPROVEMENT * (1 + std::fabs(bound))) {
+						setColumnLower(columnIdx, bound, i);
+						this->reductions.push_back( { Reduction::IMPLIED_BOUND, i,
+								columnIdx, coefficient });
+						this->numberOfTightenedBounds += 1;
+						changed = true;
+					}
+				}
+			}
+		}
+	}
+	return changed;
+}
+
+bool Presolve::isDuplicate(const RowIdx keptRowIdx, const RowIdx rowIdx,
+		VarValue& ratio) const {
+	size_t k { this->rowStart[keptRowIdx] }, l { this->rowStart[rowIdx] };
+	bool first { true };
+	while (true) {
+		while (k < this->rowStart[keptRowIdx + 1]
+				&& this->columnRemoved[this->rowColumnIdx[k]]) {
+			k += 1;
+		}
+		while (l < this->rowStart[rowIdx + 1]
+				&& this->columnRemoved[this->rowColumnIdx[l]]) {
+			l += 1;
+		}
+		if (k == this->rowStart[keptRowIdx + 1]
+				|| l == this->rowStart[rowIdx + 1]) {
+			return k == this->rowStart[keptRowIdx + 1]
+					&& l == this->rowStart[rowIdx + 1];
+		}
+		if (this->rowColumnIdx[k] != this->rowColumnIdx[l]) {
+			return false;
+		}
+		if (first) {
+			ratio = this->rowElement[l] / this->rowElement[k];
+			first = false;
+		} else if (std::fabs(this->rowElement[l] - ratio * this->rowElement[k])
+				> TOLERANCE * std::fabs(this->rowElement[l])) {
+			return false;
+		}
+		k += 1;
+		l += 1;
+	}
+}
+
+bool Presolve::removeDuplicateRows() {
+	std::vector<std::pair<size_t, RowIdx>> hashes { };
+	size_t hash { }, first { };
+	VarValue ratio { }, lowerBound { }, upperBound { };
+	bool changed { false };
+
+	// rows are hashed by their columns and coefficients divided by the first of them
+	for (RowIdx i = 0; i < this->numberOfRows; i += 1) {
+		if (this->rowRemoved[i] || this->rowLength[i] < 2) {
+			continue;
+		}
+		hash = this->rowLength[i];
+		first = this->rowStart[i + 1];
+		for (size_t k = this->rowStart[i]; k < this->rowStart[i + 1]; k += 1) {
+			if (this->columnRemoved[this->rowColumnIdx[k]]) {
+				continue;
+			}
+			first = std::min(first, k);
+			hash = hash * 31 + this->rowColumnIdx[k];
+			hash = hash * 31
+					+ std::hash<float> { }(
+							(float) (this->rowElement[k] / this->rowElement[first]));
+		}
+		hashes.push_back( { hash, i });
+	}
+	std::sort(hashes.begin(), hashes.end());
+
+	for (size_t a = 0; a < hashes.size() && !this->infeasible; a += 1) {
+		const RowIdx keptRowIdx { hashes[a].second };
+		if (this->rowRemoved[keptRowIdx]) {
+			continue;
+		}
+		for (size_t b = a + 1;
+				b < hashes.size() && hashes[b].first == hashes[a].first; b += 1) {
+			const RowIdx rowIdx { hashes[b].second };
+			if (this->rowRemoved[rowIdx]
+					|| !isDuplicate(keptRowIdx, rowIdx, ratio)) {
+				continue;
+			}
+			// bounds of duplicate row are expressed in terms of kept row
+			lowerBound = ratio > 0 ? this->rowLower[rowIdx] : this->rowUpper[rowIdx];
+			upperBound = ratio > 0 ? this->rowUpper[rowIdx] : this->rowLower[rowIdx];
+			if (isFinite(lowerBound)
+					&& lowerBound / ratio > this->rowLower[keptRowIdx]) {
+				this->rowLower[keptRowIdx] = lowerBound / ratio;
+				this->rowLowerSource[keptRowIdx] = rowIdx;
+			}
+			if (isFinite(upperBound)
+					&& upperBound / ratio < this->rowUpper[keptRowIdx]) {
+				this->rowUpper[keptRowIdx] = upperBound / ratio;
+				this->rowUpperSource[keptRowIdx] = rowIdx;
+			}
+			if (exceeds(this->rowLower[keptRowIdx], this->rowUpper[keptRowIdx])) {
+				this->infeasible = true;
+				break;
+			}
+			this->rowRemoved[rowIdx] = true;
+			this->reductions.push_back( { Reduction::DUPLICATE_ROW, rowIdx,
+					keptRowIdx, ratio });
+			this->numberOfDuplicateRows += 1;
+			changed = true;
+		}
+	}
+	return changed;
+}
+
+void Presolve::changeRowPrice(const RowIdx rowIdx, const VarValue change) {
+	std::vector<VarValue>& rowPrices = this->solution[Solution::ROW_PRICES];
+	std::vector<VarValue>& reducedCosts =
+			this->solution[Solution::REDUCED_COSTS];
+	rowPrices[rowIdx] += change;
+	for (size_t k = this->rowStart[rowIdx]; k < this->rowStart[rowIdx + 1]; k +=
+			1) {
+		reducedCosts[this->rowColumnIdx[k]] -= this->rowElement[k] * change;
+	}
+}
+
+bool Presolve::run() {
+	unsigned int numberOfPasses { 0 };
+	bool changed { true };
+
+	while (changed && !this->infeasible
+			&& numberOfPasses < MAX_NUMBER_OF_PASSES) {
+		changed = removeFixedColumns();
+		changed = removeShortRows() || changed;
+		changed = (!this->infeasible && tightenBounds()) || changed;
+		changed = (!this->infeasible && removeDuplicateRows()) || changed;
+		numberOfPasses += 1;
+	}
+	if (this->infeasible) {
+		WARN(logger, BundleKey::PRESOLVE_INFEASIBLE, numberOfPasses);
+		return false;
+	}
+
+	for (VarIdx j = 0; j < this->numberOfColumns; j += 1) {
+		if (!this->columnRemoved[j]) {
+			this->columnMap.push_back(j);
+		}
+	}
+	for (RowIdx i = 0; i < this->numberOfRows; i += 1) {
+		if (!this->rowRemoved[i]) {
+			this->rowMap.push_back(i);
+		}
+	}
+	INFO(logger, BundleKey::PRESOLVE_DONE,
+			this->numberOfColumns - getNumberOfReducedColumns(),
+			this->numberOfColumns, this->numberOfRows - getNumberOfReducedRows(),
+			this->numberOfRows, numberOfPasses, this->numberOfFixedColumns,
+			this->numberOfSingletonRows, this->numberOfEmptyRows,
+			this->numberOfRedundantRows, this->numberOfDuplicateRows,
+			this->numberOfTightenedBounds);
+	return true;
+}
+
+void Presolve::postsolve(const OsiSolverInterface* si) {
+	// solver may give no arrays for reduced problem without columns or rows
+	const VarValue* columnValues { this->columnMap.empty() ?
+			this->columnLower.data() : si->getColSolution() };
+	const VarValue* rowPrices { this->rowMap.empty() ?
+			this->columnLower.data() : si->getRowPrice() };
+	std::vector<VarValue>& values = this->solution[Solution::COLUMN_VALUES];
+	std::vector<VarValue>& reducedCosts =
+			this->solution[Solution::REDUCED_COSTS];
+	std::vector<VarValue>& prices = this->solution[Solution::ROW_PRICES];
+	VarValue reducedCost { }, change { };
+
+	for (std::vector<VarValue>& part : this->solution) {
+		part.clear();
+	}
+	if (columnValues == nullptr) {
+		return;
+	}
+	values.assign(this->columnLower.begin(), this->columnLower.end());
+	for (VarIdx j = 0; j < this->columnMap.size(); j += 1) {
+		values[this->columnMap[j]] = columnValues[j];
+	}
+	if (rowPrices == nullptr) {
+		return;
+	}
+
+	prices.assign(this->numberOfRows, 0);
+	for (RowIdx i = 0; i < this->rowMap.size(); i += 1) {
+		prices[this->rowMap[i]] = rowPrices[i];
+	}
+	reducedCosts.assign(this->objective.begin(), this->objective.end());
+	for (VarIdx j = 0; j < this->numberOfColumns; j += 1) {
+		for (size_t k = this->columnStart[j]; k < this->columnStart[j + 1]; k +=
+				1) {
+			reducedCosts[j] -= this->columnElement[k]
+					* prices[this->columnRowIdx[k]];
+		}
+	}
+
+	// row prices are given back to rows that gave active bounds, in reverse order of reductions
+	for (size_t r = this->reductions.size(); r-- > 0;) {
+		const Reduction& reduction = this->reductions[r];
+		if (reduction.type != Reduction::DUPLICATE_ROW) {
+			reducedCost = reducedCosts[reduction.idx];
+			if ((reducedCost > 0
+					&& this->columnLowerSource[reduction.idx] == reduction.rowIdx)
+					|| (reducedCost < 0
+							&& this->columnUpperSource[reduction.idx]
+									== reduction.rowIdx)) {
+				changeRowPrice(reduction.rowIdx,
+						reducedCost / reduction.coefficient);
+				reducedCosts[reduction.idx] = 0;
+			}
+		} else {
+			change = prices[reduction.idx];
+			if ((change > 0
+					&& this->rowLowerSource[reduction.idx] == reduction.rowIdx)
+					|| (change < 0
+							&& this->rowUpperSource[reduction.idx]
+									== reduction.rowIdx)) {
+				changeRowPrice(reduction.idx, -change);
+				changeRowPrice(reduction.rowIdx, change / reduction.coefficient);
+			}
+		}
+	}
+}
+
+const VarValue* Presolve::getSolution(const Solution::Part part) const {
+	return this->solution[part].empty() ? nullptr : this->solution[part].data();
+}
+
+//************************************ CONSTRUCTOR & DESTRUCTOR ************************************//
+
+Presolve::Presolve(const CoefficientMatrix& coefficients,
+		const VarIdx numberOfColumns, const RowIdx numberOfRows,
+		const VarValue* objective, const VarValue* columnLower,
+		const VarValue* columnUpper, const VarValue* rowLower,
+		const VarValue* rowUpper, const VarValue infinity) :
+		numberOfColumns(numberOfColumns), numberOfRows(numberOfRows), infinity(
+				infinity), columnStart(numberOfColumns + 1), columnRowIdx(
+				coefficients.getNumberOfElements()), columnElement(
+				coefficients.getNumberOfElements()), rowStart(numberOfRows + 1), rowColumnIdx { }, rowElement { }, objective(
+				objective, objective + numberOfColumns), columnLower(
+				columnLower, columnLower + numberOfColumns), columnUpper(
+				columnUpper, columnUpper + numberOfColumns), columnLowerSource(
+				numberOfColumns, NO_SOURCE), columnUpperSource(numberOfColumns,
+				NO_SOURCE), rowLower(rowLower, rowLower + numberOfRows), rowUpper(
+				rowUpper, rowUpper + numberOfRows), rowLowerSource(numberOfRows,
+				NO_SOURCE), rowUpperSource(numberOfRows, NO_SOURCE), columnRemoved(
+				numberOfColumns, false), rowRemoved(numberOfRows, false), rowLength(
+				numberOfRows, 0), reductions { }, objectiveOffset(0), infeasible(
+				false), numberOfFixedColumns(0), numberOfSingletonRows(0), numberOfEmptyRows(
+				0), numberOfRedundantRows(0), numberOfDuplicateRows(0), numberOfTightenedBounds(
+				0), columnMap { }, rowMap { } {
+	size_t numberOfElements { }, position { 0 }, begin { };
+
+	// zero coefficients (e.g. duplicates that have been summed up to 0) are dropped
+	coefficients.compress(true, numberOfColumns, numberOfRows,
+			this->columnStart.data(), this->columnRowIdx.data(),
+			this->columnElement.data());
+	for (VarIdx j = 0; j < numberOfColumns; j += 1) {
+		begin = this->columnStart[j];
+		this->columnStart[j] = position;
+		for (size_t k = begin; k < this->columnStart[j + 1]; k += 1) {
+			if (this->columnElement[k] != 0) {
+				this->columnRowIdx[position] = this->columnRowIdx[k];
+				this->columnElement[position] = this->columnElement[k];
+				this->rowLength[this->columnRowIdx[k]] += 1;
+				position += 1;
+			}
+		}
+	}
+	this->columnStart[numberOfColumns] = numberOfElements = position;
+	this->columnRowIdx.resize(numberOfElements);
+	this->columnElement.resize(numberOfElements);
+
+	// columns are visited in order, so columns of every row are sorted
+	this->rowColumnIdx.resize(numberOfElements);
+	this->rowElement.resize(numberOfElements);
+	for (RowIdx i = 0; i < numberOfRows; i += 1) {
+		this->rowStart[i + 1] = this->rowStart[i] + this->rowLength[i];
+	}
+	std::vector<size_t> rowPosition(this->rowStart.begin(),
+			this->rowStart.end() - 1);
+	for (VarIdx j = 0; j < numberOfColumns; j += 1) {
+		for (size_t k = this->columnStart[j]; k < this->columnStart[j + 1]; k +=
+				1) {
+			position = rowPosition[this->columnRowIdx[k]]++;
+			this->rowColumnIdx[position] = j;
+			this->rowElement[position] = this->columnElement[k];
+		}
+	}
+}
+
+Presolve::~Presolve() {
+}
+
+//*************************************** PUBLIC FUNCTIONS *****************************************//
+
+//*************************************** GETTERS & SETTERS ****************************************//
@@ -7,25 +7,118 @@
 
 #include "../include/Row.hpp"
 
+#include <log4cxx/helpers/messagebuffer.h>
+#include <log4cxx/logger.h>
+#include <sstream>
+
+#include "../include/log/bundle/Bundle.hpp"
+#include "../include/log/utils/LogUtils.hpp"
+#include "../include/OsiProblemInstance.hpp"
+#include "../include/RowIdxMapper.hpp"
+#include "../include/utils/Utils.hpp"
+#include "../include/Variable.hpp"
+
+const log4cxx::LoggerPtr logger(log4cxx::Logger::getLogger("Row"));
+
 //************************************ PRIVATE CONSTANT FIELDS *************************************//
 
 //***************************************** CLASS FIELDS *******************************************//
 
 //*************************************** PRIVATE FUNCTIONS ****************************************//
 
+void Row::throwColumnOutOfBounds(const VarIdx columnIdx) const
+		throw (VariableModelExceptions::IndexOutOfBoundException) {
+	FATAL(logger, BundleKey::ADD_ROW_ELEMENT_OUT_OF_BOUNDS, columnIdx,
+			this->getRowName().c_str(),
+			this->problemInstance->getNumberOfColumns());
+	throw VariableModelExceptions::IndexOutOfBoundException();
+}
+
+void Row::addTerms(const LinearExprBuffer& buffer, const VarValue lowerBound,
+		const VarValue upperBound) {
+	this->problemInstance->addElements(this->rowIdx, buffer.getColumnIdx(),
+			buffer.getValues(), buffer.getNumberOfTerms());
+	setLowerBound(buffer.getRowBound(lowerBound));
+	setUpperBound(buffer.getRowBound(upperBound));
+}
+
 //************************************* PUBLIC CONSTANT FIELDS *************************************//
 
 //************************************ CONSTRUCTOR & DESTRUCTOR ************************************//
 
-Row::Row() {
-	// TODO Auto-generated constructor stub
+Row::Row(OsiProblemInstance* problemInstance, const RowIdxMapper* rowGroup,
+		const RowIdx rowIdx) :
+		problemInstance(problemInstance), rowGroup(rowGroup), rowIdx(rowIdx) {
 }
 
-Row::~Row() {
-	// TODO Auto-generated destructor stub
+//*************************************** PUBLIC FUNCTIONS *****************************************//
+
+void Row::addElement(const Variable& variable, const VarValue coefficient) {
+	this->problemInstance->addElement(this->rowIdx, variable.getColumnIdx(),
+			coefficient);
 }
 
-//*************************************** PUBLIC FUNCTIONS *****************************************//
+void Row::addElement(const VarIdx columnIdx, const VarValue coefficient)
+		throw (VariableModelExceptions::IndexOutOfBoundException) {
+	if (columnIdx >= this->problemInstance->getNumberOfColumns()) {
+		throwColumnOutOfBounds(columnIdx);
+	}
+	this->problemInstance->addElement(this->rowIdx, columnIdx, coefficient);
+}
+
+void Row::addElements(const VarIdx* columnIdx, const VarValue* coefficient,
+		const size_t count)
+				throw (VariableModelExceptions::IndexOutOfBoundException) {
+	const VarIdx numberOfColumns = this->problemInstance->getNumberOfColumns();
+	for (size_t i = 0; i < count; i += 1) {
+		if (columnIdx[i] >= numberOfColumns) {
+			throwColumnOutOfBounds(columnIdx[i]);
+		}
+	}
+	this->problemInstance->addElements(this->rowIdx, columnIdx, coefficient,
+			count);
+}
+
+std::string Row::toString() const {
+	std::ostringstream os { };
+	const RowView row = this->problemInstance->getRowCoefficients(
+			this->rowIdx);
+	os << "\tName of row:\t\t" << this->getRowName()
+			<< "\n\tRow's lower bound\t:\t"
+			<< Utils::getStringBound(this->getLowerBound())
+			<< "\n\tRow's upper bound\t:\t"
+			<< Utils::getStringBound(this->getUpperBound())
+			<< "\n\tColumn coefficients (" << row.size << "):\n"
+			<< (row.size == 0 ?
+					"" :
+					Utils::getStringRowColumnCoefficients(row.index, row.value,
+							row.size)) << std::endl;
+	return os.str();
+}
 
 //*************************************** GETTERS & SETTERS ****************************************//
 
+VarValue Row::getLowerBound() const {
+	return this->problemInstance->getRowLowerBound(this->rowIdx);
+}
+
+void Row::setLowerBound(const VarValue lowerBound) {
+	this->problemInstance->setRowLowerBound(this->rowIdx, lowerBound);
+}
+
+VarValue Row::getUpperBound() const {
+	return this->problemInstance->getRowUpperBound(this->rowIdx);
+}
+
+void Row::setUpperBound(const VarValue upperBound) {
+	this->problemInstance->setRowUpperBound(this->rowIdx, upperBound);
+}
+
+RowIdx Row::getRowIdx() const {
+	return this->rowIdx;
+}
+
+std::string Row::getRowName() const {
+	return this->rowGroup->getRowName(
+			this->rowIdx - this->rowGroup->getBeginIdx());
+}
@@ -0,0 +1,62 @@
+/*
+ * RowBuffer.cpp
+ *
+ *  Created on: 17 paź 2026
+ *      Author: tomasz
+ */
+
+#include "../include/RowBuffer.hpp"
+
+//************************************ PRIVATE CONSTANT FIELDS *************************************//
+
+//***************************************** CLASS FIELDS *******************************************//
+
+//*************************************** PRIVATE FUNCTIONS ****************************************//
+
+RowBuffer::Segment RowBuffer::beginSegment() const {
+	return Segment { this->rowIdx.size(), 0, this->boundRowIdx.size(), 0 };
+}
+
+void RowBuffer::endSegment(Segment& segment) const {
+	segment.numberOfElements = this->rowIdx.size() - segment.elementsBegin;
+	segment.numberOfBounds = this->boundRowIdx.size() - segment.boundsBegin;
+}
+
+//************************************* PUBLIC CONSTANT FIELDS *************************************//
+
+//************************************ CONSTRUCTOR & DESTRUCTOR ************************************//
+
+RowBuffer::RowBuffer() {
+}
+
+RowBuffer::~RowBuffer() {
+}
+
+//*************************************** PUBLIC FUNCTIONS *****************************************//
+
+void RowBuffer::addElements(const RowIdx rowIdx, const VarIdx* columnIdx,
+		const VarValue* coefficient, const size_t count) {
+	this->rowIdx.insert(this->rowIdx.end(), count, rowIdx);
+	this->columnIdx.insert(this->columnIdx.end(), columnIdx,
+			columnIdx + count);
+	this->value.insert(this->value.end(), coefficient, coefficient + count);
+}
+
+void RowBuffer::setBounds(const RowIdx rowIdx, const VarValue lowerBound,
+		const VarValue upperBound) {
+	this->boundRowIdx.push_back(rowIdx);
+	this->lowerBound.push_back(lowerBound);
+	this->upperBound.push_back(upperBound);
+}
+
+void RowBuffer::reserve(const size_t numberOfElements) {
+	this->rowIdx.reserve(this->rowIdx.size() + numberOfElements);
+	this->columnIdx.reserve(this->columnIdx.size() + numberOfElements);
+	this->value.reserve(this->value.size() + numberOfElements);
+}
+
+//*************************************** GETTERS & SETTERS ****************************************//
+
+size_t RowBuffer::getNumberOfElements() const {
+	return this->rowIdx.size();
+}
@@ -7,25 +7,88 @@
 
 #include "../include/RowIdxMapper.hpp"
 
+#include <log4cxx/helpers/messagebuffer.h>
+#include <log4cxx/logger.h>
+#include <sstream>
+
+#include "../include/log/bundle/Bundle.hpp"
+#include "../include/log/utils/LogUtils.hpp"
+#include "../include/Row.hpp"
+#include "../include/utils/MapperUtils.hpp"
+#include "../include/utils/Utils.hpp"
+
+const log4cxx::LoggerPtr logger(log4cxx::Logger::getLogger("RowIdxMapper"));
+
 //************************************ PRIVATE CONSTANT FIELDS *************************************//
 
 //***************************************** CLASS FIELDS *******************************************//
 
 //*************************************** PRIVATE FUNCTIONS ****************************************//
 
+Row RowIdxMapper::getRow(const RowIndexTuple& dimensions) const {
+	return Row { this->problemInstance, this, this->beginIdx
+			+ MapUtils::linearizeDimensionList<RowIdx, RowDimIdx>(
+					this->dimensions, dimensions) };
+}
+
 //************************************* PUBLIC CONSTANT FIELDS *************************************//
 
 //************************************ CONSTRUCTOR & DESTRUCTOR ************************************//
 
-RowIdxMapper::RowIdxMapper() {
-	// TODO Auto-generated constructor stub
+RowIdxMapper::RowIdxMapper(OsiProblemInstance* problemInstance,
+		const RowIdx firstIdx, const RowDimensionTable& dimensions,
+		const std::string& groupName) :
+		problemInstance(problemInstance), beginIdx(firstIdx), dimensions(
+				dimensions), numberOfRows(dimensions.getNumberOfElements()), groupName(
+				groupName) {
+	DEBUG(logger, BundleKey::INIT_ROW_MAPPER_CONSTRUCTOR, numberOfRows,
+			Utils::getStringDimensions(this->dimensions.getExtents()).c_str(),
+			firstIdx);
 }
 
 RowIdxMapper::~RowIdxMapper() {
-	// TODO Auto-generated destructor stub
 }
 
 //*************************************** PUBLIC FUNCTIONS *****************************************//
 
+std::string RowIdxMapper::toString() {
+	std::ostringstream os { };
+	os << "\tName of rows:\t" << groupName << "\n\tRows' dimensions:\t"
+			<< Utils::getStringDimensions(this->dimensions.getExtents())
+			<< std::endl;
+	return os.str();
+}
+
+RowDimIdx RowIdxMapper::getDimensionsSize() {
+	return dimensions.getNumberOfDimensions();
+}
+
 //*************************************** GETTERS & SETTERS ****************************************//
 
+OsiProblemInstance* RowIdxMapper::getProblemInstance() const {
+	return problemInstance;
+}
+
+RowIdx RowIdxMapper::getBeginIdx() const {
+	return beginIdx;
+}
+
+void RowIdxMapper::setBeginIdx(const RowIdx beginIdx) {
+	this->beginIdx = beginIdx;
+}
+
+RowIdx RowIdxMapper::getNumberOfRows() const {
+	return numberOfRows;
+}
+
+std::string RowIdxMapper::getRowName(const RowIdx idx) const {
+	return MapUtils::getVariableName(idx, this->groupName, this->dimensions);
+}
+
+const std::string& RowIdxMapper::getGroupName() const {
+	return groupName;
+}
+
+const RowDimensionTable& RowIdxMapper::getDimensions() const {
+	return dimensions;
+}
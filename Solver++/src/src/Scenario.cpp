@@ -0,0 +1,70 @@
+/*
+ * Scenario.cpp
+ *
+ *  Created on: 17 paź 2026
+ *      Author: tomasz
+ */
+
+#include "../include/Scenario.hpp"
+
+//************************************ PRIVATE CONSTANT FIELDS *************************************//
+
+//***************************************** CLASS FIELDS *******************************************//
+
+//*************************************** PRIVATE FUNCTIONS ****************************************//
+
+//************************************* PUBLIC CONSTANT FIELDS *************************************//
+
+//************************************ CONSTRUCTOR & DESTRUCTOR ************************************//
+
+Scenario::Scenario() {
+}
+
+Scenario::~Scenario() {
+}
+
+//*************************************** PUBLIC FUNCTIONS *****************************************//
+
+void Scenario::setColumnBounds(const VarIdx columnIdx,
+		const VarValue lowerBound, const VarValue upperBound) {
+	this->columnBounds.push_back(BoundsChange<VarIdx> { columnIdx, lowerBound,
+			upperBound });
+}
+
+void Scenario::setObjective(const VarIdx columnIdx,
+		const VarValue coefficient) {
+	this->objective.push_back(ObjectiveChange { columnIdx, coefficient });
+}
+
+void Scenario::setRowBounds(const RowIdx rowIdx, const VarValue lowerBound,
+		const VarValue upperBound) {
+	this->rowBounds.push_back(BoundsChange<RowIdx> { rowIdx, lowerBound,
+			upperBound });
+}
+
+bool Scenario::isValid(const VarIdx numberOfColumns,
+		const RowIdx numberOfRows) const {
+	for (const BoundsChange<VarIdx>& change : this->columnBounds) {
+		if (change.idx >= numberOfColumns) {
+			return false;
+		}
+	}
+	for (const ObjectiveChange& change : this->objective) {
+		if (change.idx >= numberOfColumns) {
+			return false;
+		}
+	}
+	for (const BoundsChange<RowIdx>& change : this->rowBounds) {
+		if (change.idx >= numberOfRows) {
+			return false;
+		}
+	}
+	return true;
+}
+
+//*************************************** GETTERS & SETTERS ****************************************//
+
+size_t Scenario::getNumberOfChanges() const {
+	return this->columnBounds.size() + this->objective.size()
+			+ this->rowBounds.size();
+}
@@ -0,0 +1,41 @@
+/*
+ * Solution.cpp
+ *
+ *  Created on: 17 paź 2026
+ *      Author: tomasz
+ */
+
+#include "../include/Solution.hpp"
+
+//************************************ PRIVATE CONSTANT FIELDS *************************************//
+
+//***************************************** CLASS FIELDS *******************************************//
+
+//*************************************** PRIVATE FUNCTIONS ****************************************//
+
+//************************************* PUBLIC CONSTANT FIELDS *************************************//
+
+//************************************ CONSTRUCTOR & DESTRUCTOR ************************************//
+
+Solution::Solution() :
+		objectiveValue(0) {
+}
+
+Solution::~Solution() {
+}
+
+//*************************************** PUBLIC FUNCTIONS *****************************************//
+
+//*************************************** GETTERS & SETTERS ****************************************//
+
+const VarValue* Solution::getValues(const Part part) const {
+	return this->parts[part].empty() ? nullptr : this->parts[part].data();
+}
+
+size_t Solution::getSize(const Part part) const {
+	return this->parts[part].size();
+}
+
+VarValue Solution::getObjectiveValue() const {
+	return this->objectiveValue;
+}
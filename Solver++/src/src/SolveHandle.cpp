@@ -0,0 +1,67 @@
+/*
+ * SolveHandle.cpp
+ *
+ *  Created on: 17 paź 2026
+ *      Author: tomasz
+ */
+
+#include "../include/SolveHandle.hpp"
+
+#include <chrono>
+
+//************************************ PRIVATE CONSTANT FIELDS *************************************//
+
+//***************************************** CLASS FIELDS *******************************************//
+
+//*************************************** PRIVATE FUNCTIONS ****************************************//
+
+void SolveHandle::finish(const SolveStatus status,
+		std::exception_ptr exception) {
+	std::lock_guard<std::mutex> lock { this->state->mutex };
+	this->state->status = status;
+	this->state->exception = exception;
+	this->state->finished = true;
+	this->state->finishedCondition.notify_all();
+}
+
+//************************************* PUBLIC CONSTANT FIELDS *************************************//
+
+//************************************ CONSTRUCTOR & DESTRUCTOR ************************************//
+
+SolveHandle::SolveHandle() :
+		state(std::make_shared<State>()) {
+	this->state->finished = false;
+	this->state->status = SolveStatus::ABANDONED;
+	this->state->cancelled = false;
+}
+
+SolveHandle::~SolveHandle() {
+}
+
+//*************************************** PUBLIC FUNCTIONS *****************************************//
+
+bool SolveHandle::isDone() const {
+	std::lock_guard<std::mutex> lock { this->state->mutex };
+	return this->state->finished;
+}
+
+bool SolveHandle::waitFor(const double seconds) const {
+	std::unique_lock<std::mutex> lock { this->state->mutex };
+	return this->state->finishedCondition.wait_for(lock,
+			std::chrono::duration<double>(seconds),
+			[this]() {return this->state->finished;});
+}
+
+SolveStatus SolveHandle::get() const {
+	std::unique_lock<std::mutex> lock { this->state->mutex };
+	this->state->finishedCondition.wait(lock,
+			[this]() {return this->state->finished;});
+	if (this->state->exception) {
+		std::rethrow_exception(this->state->exception);
+	}
+	return this->state->status;
+}
+
+void SolveHandle::cancel() {
+	this->state->cancelled = true;
+}
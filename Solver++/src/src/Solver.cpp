@@ -14,66 +14,82 @@
 #include <stdarg.h>     /* va_list, va_start, va_arg, va_end */
 #include <stddef.h>
 #include <stdexcept>	/* out_of_range*/
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <limits>
+#include <thread>
 #include <utility>
+#include <vector>
 
 #include "../include/log/bundle/Bundle.hpp"
 #include "../include/log/utils/LogUtils.hpp"
+#include "../include/ModelReader.hpp"
+#include "../include/ModelSnapshot.hpp"
+#include "../include/ModelWriter.hpp"
 #include "../include/OsiProblemInstance.hpp"
+#include "../include/Parameter.hpp"
 #include "../include/ParameterIdxMapper.hpp"
+#include "../include/Row.hpp"
+#include "../include/RowBuffer.hpp"
 #include "../include/RowIdxMapper.hpp"
 #include "../include/utils/MapperUtils.hpp"
 #include "../include/utils/StringUtils.hpp"
+#include "../include/utils/TensorFileUtils.hpp"
+#include "../include/utils/ThreadUtils.hpp"
 #include "../include/utils/Utils.hpp"
+#include "../include/Variable.hpp"
 #include "../include/VariableIdxMapper.hpp"
 
 const log4cxx::LoggerPtr logger(log4cxx::Logger::getLogger("Solver"));
 
 //************************************ PRIVATE CONSTANT FIELDS *************************************//
 
-const std::regex Solver::VAR_REGEXP = std::regex(
-		"^(\\w+)((\\[[1-9][0-9]*\\])*)$");
-const int Solver::VAR_REGEX_NAME_GROUP_IDX { 1 };
-const int Solver::VAR_REGEX_DIM_GROUP_IDX { 2 };
-
 //***************************************** CLASS FIELDS *******************************************//
 
 //*************************************** PRIVATE FUNCTIONS ****************************************//
 
-void Solver::addNumberOfVariables(const VarIdx& numberOfNewVariables) {
+VarIdx Solver::addNumberOfVariables(const VarIdx& numberOfNewVariables,
+		const VarValue lowerBound, const VarValue upperBound,
+		const ValueType variableType)
+				throw (VariableModelExceptions::InvalidGroupDefinitionException) {
+	const VarIdx numberOfColumns { this->problemInstance->getNumberOfColumns() };
 	TRACE(logger, BundleKey::INIT_VAR_ADD_COUNT, numberOfNewVariables);
-	this->problemInstance->addNumberOfVariables(numberOfNewVariables);
-}
-
-std::list<VarDimIdx> Solver::getVariableDimensionList(
-		const char* variableDimensionDefinition) {
-	TRACE(logger, BundleKey::INIT_VAR_GET_DIM_LIST,
-			Utils::getStringDimensions(variableDimensionDefinition).c_str());
-	std::list<VarDimIdx> dimensions = StringUtils::variableDimensionTokenize<
-			VarDimIdx>(variableDimensionDefinition);
-	return dimensions;
-}
-
-VarIdx Solver::countVariablesInGroup(const std::list<VarDimIdx>& dimensions) {
-	int variablesCounter { 1 };
-	for (VarDimIdx dimensionSize : dimensions) {
-		variablesCounter *= dimensionSize;
+	if (numberOfNewVariables
+			> std::numeric_limits<VarIdx>::max() - numberOfColumns) {
+		FATAL(logger, BundleKey::INIT_VAR_ADD_COUNT_TOO_LARGE,
+				numberOfNewVariables, numberOfColumns,
+				std::numeric_limits<VarIdx>::max());
+		throw VariableModelExceptions::InvalidGroupDefinitionException();
 	}
-	return variablesCounter;
+	return this->problemInstance->addNumberOfVariables(numberOfNewVariables,
+			lowerBound, upperBound, variableType != ValueType::DOUBLE);
 }
 
 void Solver::insertVariable(const std::string& matchedNameOfVariable,
-		const VarIdx numberOfGroupVariables,
-		const std::list<VarDimIdx>& listOfDimensions, const VarValue lowerBound,
+		const VarDimensionTable& dimensions, const VarValue lowerBound,
 		const VarValue upperBound, const ValueType variableType)
-				throw (VariableModelExceptions::DuplicateException) {
+				throw (VariableModelExceptions::DuplicateException,
+				VariableModelExceptions::InvalidGroupDefinitionException) {
+	if (VarDimensionTable::exceedsLimit(dimensions.getExtents(),
+			std::numeric_limits<VarIdx>::max())) {
+		FATAL(logger, BundleKey::INIT_VAR_GROUP_TOO_LARGE,
+				matchedNameOfVariable.c_str(),
+				Utils::getStringDimensions(dimensions.getExtents()).c_str(),
+				std::numeric_limits<VarIdx>::max());
+		throw VariableModelExceptions::InvalidGroupDefinitionException();
+	}
 	if (!this->variables->count(matchedNameOfVariable)) {
 		this->variables->insert(
 				std::pair<std::string, VariableIdxMapper*>(
 						matchedNameOfVariable, new VariableIdxMapper {
-								getNumberOfVariables(), listOfDimensions,
-								numberOfGroupVariables, lowerBound, upperBound,
-								variableType, matchedNameOfVariable }));
-		addNumberOfVariables(numberOfGroupVariables);
+								this->problemInstance, addNumberOfVariables(
+										dimensions.getNumberOfElements(),
+										lowerBound, upperBound, variableType),
+								dimensions,
+								variableType, matchedNameOfVariable,
+								this->namesPolicy }));
 	} else {
 		FATAL(logger, BundleKey::INIT_VAR_DUPLICATE,
 				matchedNameOfVariable.c_str(),
@@ -92,11 +108,322 @@ VariableIdxMapper* Solver::getVariableIdxMapperAt(
 	}
 }
 
+VariableIdxMapper* Solver::getVariableIdxMapperAt(
+		const char* groupOfVariablesName, const size_t length)
+				throw (VariableModelExceptions::NoSuchGroupException) {
+	thread_local std::string groupName { };
+	std::unordered_map<std::string, VariableIdxMapper*>::const_iterator it { };
+	groupName.assign(groupOfVariablesName, length);
+	it = this->variables->find(groupName);
+	if (it == this->variables->end()) {
+		throw VariableModelExceptions::NoSuchGroupException();
+	}
+	return it->second;
+}
+
+VariableIdxMapper* Solver::getVariableGroup(
+		const std::string& groupOfVariablesName,
+		const VarDimIdx numberOfDimensions)
+				throw (VariableModelExceptions::NoSuchGroupException,
+				VariableModelExceptions::InvalidNumberOfDimensionIndexesException) {
+	VariableIdxMapper* variableIdxMapper = Solver::getVariableIdxMapperAt(
+			groupOfVariablesName.c_str(), groupOfVariablesName.length());
+	if (variableIdxMapper->getDimensionsSize() != numberOfDimensions) {
+		FATAL(logger, BundleKey::GET_VAR_GROUP_DIFFERENT_DIM_SIZE,
+				groupOfVariablesName.c_str(), numberOfDimensions,
+				variableIdxMapper->getDimensionsSize());
+		throw VariableModelExceptions::InvalidNumberOfDimensionIndexesException();
+	}
+	return variableIdxMapper;
+}
+
+void Solver::insertParameters(const std::string& matchedNameOfParameter,
+		const ParamDimensionTable& dimensions, const ParamValue lowerBound,
+		const ParamValue upperBound, const ValueType type,
+		const ParamValue value)
+				throw (ParameterModelExceptions::DuplicateException,
+				ParameterModelExceptions::InvalidGroupDefinitionException) {
+	if (ParamDimensionTable::exceedsLimit(dimensions.getExtents(),
+			std::numeric_limits<ParamIdx>::max())) {
+		FATAL(logger, BundleKey::INIT_PARAM_GROUP_TOO_LARGE,
+				matchedNameOfParameter.c_str(),
+				Utils::getStringDimensions(dimensions.getExtents()).c_str(),
+				std::numeric_limits<ParamIdx>::max());
+		throw ParameterModelExceptions::InvalidGroupDefinitionException();
+	}
+	if (!this->parameters->count(matchedNameOfParameter)) {
+		this->parameters->insert(
+				std::pair<std::string, ParamIdxMapper*>(matchedNameOfParameter,
+						new ParamIdxMapper { dimensions, lowerBound, upperBound,
+								type, value, matchedNameOfParameter }));
+	} else {
+		FATAL(logger, BundleKey::INIT_PARAM_DUPLICATE,
+				matchedNameOfParameter.c_str(),
+				this->parameters->at(matchedNameOfParameter)->toString().c_str());
+		throw ParameterModelExceptions::DuplicateException();
+	}
+}
+
+ParamIdxMapper* Solver::getParamIdxMapperAt(const char* groupOfParametersName,
+		const size_t length)
+				throw (ParameterModelExceptions::NoSuchGroupException) {
+	thread_local std::string groupName { };
+	std::unordered_map<std::string, ParamIdxMapper*>::const_iterator it { };
+	groupName.assign(groupOfParametersName, length);
+	it = this->parameters->find(groupName);
+	if (it == this->parameters->end()) {
+		throw ParameterModelExceptions::NoSuchGroupException();
+	}
+	return it->second;
+}
+
+ParamIdxMapper* Solver::getParameterGroup(
+		const std::string& groupOfParametersName,
+		const ParamDimIdx numberOfDimensions)
+				throw (ParameterModelExceptions::NoSuchGroupException,
+				ParameterModelExceptions::InvalidNumberOfDimensionIndexesException) {
+	ParamIdxMapper* paramIdxMapper = Solver::getParamIdxMapperAt(
+			groupOfParametersName.c_str(), groupOfParametersName.length());
+	if (paramIdxMapper->getDimensionsSize() != numberOfDimensions) {
+		FATAL(logger, BundleKey::GET_PARAM_GROUP_DIFFERENT_DIM_SIZE,
+				groupOfParametersName.c_str(), numberOfDimensions,
+				paramIdxMapper->getDimensionsSize());
+		throw ParameterModelExceptions::InvalidNumberOfDimensionIndexesException();
+	}
+	return paramIdxMapper;
+}
+
+void Solver::insertRows(const std::string& matchedNameOfRow,
+		const RowDimensionTable& dimensions, const VarValue lowerBound,
+		const VarValue upperBound)
+				throw (RowModelExceptions::DuplicateException,
+				RowModelExceptions::InvalidGroupDefinitionException) {
+	const RowIdx numberOfRows { this->problemInstance->getNumberOfRows() };
+	if (RowDimensionTable::exceedsLimit(dimensions.getExtents(),
+			std::numeric_limits<RowIdx>::max())) {
+		FATAL(logger, BundleKey::INIT_ROW_GROUP_TOO_LARGE,
+				matchedNameOfRow.c_str(),
+				Utils::getStringDimensions(dimensions.getExtents()).c_str(),
+				std::numeric_limits<RowIdx>::max());
+		throw RowModelExceptions::InvalidGroupDefinitionException();
+	}
+	if (!this->rows->count(matchedNameOfRow)) {
+		if (dimensions.getNumberOfElements()
+				> std::numeric_limits<RowIdx>::max() - numberOfRows) {
+			FATAL(logger, BundleKey::INIT_ROW_ADD_COUNT_TOO_LARGE,
+					dimensions.getNumberOfElements(), numberOfRows,
+					std::numeric_limits<RowIdx>::max());
+			throw RowModelExceptions::InvalidGroupDefinitionException();
+		}
+		TRACE(logger, BundleKey::INIT_ROW_ADD_COUNT,
+				dimensions.getNumberOfElements());
+		this->rows->insert(
+				std::pair<std::string, RowIdxMapper*>(matchedNameOfRow,
+						new RowIdxMapper { this->problemInstance,
+								this->problemInstance->addNumberOfRows(
+										dimensions.getNumberOfElements(),
+										lowerBound, upperBound), dimensions,
+								matchedNameOfRow }));
+	} else {
+		FATAL(logger, BundleKey::INIT_ROW_DUPLICATE, matchedNameOfRow.c_str(),
+				this->rows->at(matchedNameOfRow)->toString().c_str());
+		throw RowModelExceptions::DuplicateException();
+	}
+}
+
+RowIdxMapper* Solver::getRowIdxMapperAt(const char* groupOfRowsName,
+		const size_t length) throw (RowModelExceptions::NoSuchGroupException) {
+	thread_local std::string groupName { };
+	std::unordered_map<std::string, RowIdxMapper*>::const_iterator it { };
+	groupName.assign(groupOfRowsName, length);
+	it = this->rows->find(groupName);
+	if (it == this->rows->end()) {
+		throw RowModelExceptions::NoSuchGroupException();
+	}
+	return it->second;
+}
+
+RowIdxMapper* Solver::getRowGroup(const std::string& groupOfRowsName,
+		const RowDimIdx numberOfDimensions)
+				throw (RowModelExceptions::NoSuchGroupException,
+				RowModelExceptions::InvalidNumberOfDimensionIndexesException) {
+	RowIdxMapper* rowIdxMapper = Solver::getRowIdxMapperAt(
+			groupOfRowsName.c_str(), groupOfRowsName.length());
+	if (rowIdxMapper->getDimensionsSize() != numberOfDimensions) {
+		FATAL(logger, BundleKey::GET_ROW_GROUP_DIFFERENT_DIM_SIZE,
+				groupOfRowsName.c_str(), numberOfDimensions,
+				rowIdxMapper->getDimensionsSize());
+		throw RowModelExceptions::InvalidNumberOfDimensionIndexesException();
+	}
+	return rowIdxMapper;
+}
+
+const VarValue* Solver::getVariableSolution(
+		const std::string& groupOfVariablesName,
+		const VarDimIdx numberOfDimensions, const Solution::Part part,
+		const Solution* solution, const VarDimensionTable*& dimensions)
+				throw (VariableModelExceptions::NoSuchGroupException,
+				VariableModelExceptions::InvalidNumberOfDimensionIndexesException,
+				ModelExceptions::NoSolutionException) {
+	const VariableIdxMapper* variableIdxMapper = getVariableGroup(
+			groupOfVariablesName, numberOfDimensions);
+	const VarValue* values { getSolutionValues(part, solution,
+			variableIdxMapper->getBeginIdx()
+					+ variableIdxMapper->getNumberOfVariables()) };
+	if (values == nullptr) {
+		FATAL(logger, BundleKey::GET_SOLUTION_NOT_AVAILABLE,
+				groupOfVariablesName.c_str());
+		throw ModelExceptions::NoSolutionException();
+	}
+	dimensions = &variableIdxMapper->getDimensions();
+	return values + variableIdxMapper->getBeginIdx();
+}
+
+const VarValue* Solver::getRowSolution(const std::string& groupOfRowsName,
+		const RowDimIdx numberOfDimensions, const Solution* solution,
+		const RowDimensionTable*& dimensions)
+				throw (RowModelExceptions::NoSuchGroupException,
+				RowModelExceptions::InvalidNumberOfDimensionIndexesException,
+				ModelExceptions::NoSolutionException) {
+	const RowIdxMapper* rowIdxMapper = getRowGroup(groupOfRowsName,
+			numberOfDimensions);
+	const VarValue* values { getSolutionValues(Solution::Part::ROW_PRICES,
+			solution,
+			rowIdxMapper->getBeginIdx() + rowIdxMapper->getNumberOfRows()) };
+	if (values == nullptr) {
+		FATAL(logger, BundleKey::GET_SOLUTION_NOT_AVAILABLE,
+				groupOfRowsName.c_str());
+		throw ModelExceptions::NoSolutionException();
+	}
+	dimensions = &rowIdxMapper->getDimensions();
+	return values + rowIdxMapper->getBeginIdx();
+}
+
+const VarValue* Solver::getSolutionValues(const Solution::Part part,
+		const Solution* solution, const size_t size) const {
+	if (solution != nullptr) {
+		return solution->getSize(part) >= size ?
+				solution->getValues(part) : nullptr;
+	}
+	return this->problemInstance->getSolution(part);
+}
+
+void Solver::checkRowBuffer(const RowBuffer& buffer,
+		const size_t elementsBegin, const size_t boundsBegin) const
+				throw (RowModelExceptions::IndexOutOfBoundException,
+				VariableModelExceptions::IndexOutOfBoundException) {
+	const VarIdx numberOfColumns = this->problemInstance->getNumberOfColumns();
+	const RowIdx numberOfRows = this->problemInstance->getNumberOfRows();
+	for (size_t i = elementsBegin; i < buffer.rowIdx.size(); i += 1) {
+		if (buffer.rowIdx[i] >= numberOfRows
+				|| buffer.columnIdx[i] >= numberOfColumns) {
+			FATAL(logger, BundleKey::GENERATE_ROWS_INDEX_OUT_OF_BOUNDS,
+					buffer.rowIdx[i], buffer.columnIdx[i], numberOfRows,
+					numberOfColumns);
+			if (buffer.rowIdx[i] >= numberOfRows) {
+				throw RowModelExceptions::IndexOutOfBoundException();
+			}
+			throw VariableModelExceptions::IndexOutOfBoundException();
+		}
+	}
+	for (size_t i = boundsBegin; i < buffer.boundRowIdx.size(); i += 1) {
+		if (buffer.boundRowIdx[i] >= numberOfRows) {
+			FATAL(logger, BundleKey::GENERATE_ROWS_BOUND_OUT_OF_BOUNDS,
+					buffer.boundRowIdx[i], numberOfRows);
+			throw RowModelExceptions::IndexOutOfBoundException();
+		}
+	}
+}
+
+void Solver::reserveRowFamily(const RowIdxMapper* rowGroup,
+		const size_t numberOfRows, const size_t elementsPerRow) {
+	INFO(logger, BundleKey::GENERATE_ROW_FAMILY, numberOfRows,
+			rowGroup->getGroupName().c_str(), elementsPerRow);
+	if (elementsPerRow != 0) {
+		this->problemInstance->reserveElements(
+				this->problemInstance->getNumberOfElements()
+						+ numberOfRows * elementsPerRow);
+	}
+}
+
+void Solver::captureBasis() {
+	std::vector<char> columnStatus { }, rowStatus { };
+	if (!this->problemInstance->getBasis(columnStatus, rowStatus)) {
+		return;
+	}
+	this->basis->clear();
+	for (std::pair<const std::string, VariableIdxMapper*>& group : *this->variables) {
+		Basis::add(this->basis->columnGroups, group.first,
+				group.second->getDimensions(),
+				columnStatus.data() + group.second->getBeginIdx());
+	}
+	for (std::pair<const std::string, RowIdxMapper*>& group : *this->rows) {
+		Basis::add(this->basis->rowGroups, group.first,
+				group.second->getDimensions(),
+				rowStatus.data() + group.second->getBeginIdx());
+	}
+	DEBUG(logger, BundleKey::CAPTURE_BASIS, this->basis->getNumberOfColumns(),
+			this->basis->getNumberOfRows());
+}
+
+SolveStatus Solver::solve(const SolveOptions& options,
+		const std::atomic<bool>* cancelled) {
+	SolveStatus status { };
+	loadProblem();
+	if (this->basisPending) {
+		applyBasis();
+		this->basisPending = false;
+	}
+	status = this->problemInstance->solve(options, cancelled);
+	captureBasis();
+	return status;
+}
+
+void Solver::waitForSolve() {
+	if (this->solveThread != nullptr) {
+		this->solveThread->join();
+		delete this->solveThread;
+		delete this->solveHandle;
+		this->solveThread = nullptr;
+		this->solveHandle = nullptr;
+	}
+}
+
+void Solver::applyBasis() {
+	std::vector<char> columnStatus(getNumberOfVariables(),
+			Basis::Status::AT_LOWER_BOUND);
+	std::vector<char> rowStatus(getNumberOfRows(), Basis::Status::BASIC);
+	size_t numberOfColumns { 0 }, numberOfRows { 0 };
+	for (std::pair<const std::string, VariableIdxMapper*>& group : *this->variables) {
+		numberOfColumns += Basis::remap(this->basis->columnGroups, group.first,
+				group.second->getDimensions(),
+				columnStatus.data() + group.second->getBeginIdx());
+	}
+	for (std::pair<const std::string, RowIdxMapper*>& group : *this->rows) {
+		numberOfRows += Basis::remap(this->basis->rowGroups, group.first,
+				group.second->getDimensions(),
+				rowStatus.data() + group.second->getBeginIdx());
+	}
+	DEBUG(logger, BundleKey::APPLY_BASIS, numberOfColumns,
+			getNumberOfVariables(), numberOfRows, getNumberOfRows());
+	this->problemInstance->setBasis(columnStatus, rowStatus);
+}
+
+void Solver::remapBasisAfterDeletion() {
+	if (this->basis->getNumberOfColumns() > 0
+			|| this->basis->getNumberOfRows() > 0) {
+		this->basisPending = true;
+	}
+}
+
 //************************************* PUBLIC CONSTANT FIELDS *************************************//
 
 //************************************ CONSTRUCTOR & DESTRUCTOR ************************************//
 
-Solver::Solver(SolverInterface solverInterface) {
+Solver::Solver(SolverInterface solverInterface) :
+		namesPolicy(NamesPolicy::GENERATE_NAMES), basisPending(false), solveThread(
+				nullptr), solveHandle(nullptr) {
+	this->basis = new Basis { };
 	this->problemInstance = new OsiProblemInstance { solverInterface };
 	this->parameters = new std::unordered_map<std::string, ParamIdxMapper*> { };
 	this->variables =
@@ -107,10 +434,18 @@ Solver::Solver(SolverInterface solverInterface) {
 }
 
 Solver::~Solver() {
+	if (this->solveHandle != nullptr) {
+		this->solveHandle->cancel();
+	}
+	waitForSolve();
+	deleteAllParameters();
+	deleteAllVariables();
+	deleteAllRows();
 	delete this->problemInstance;
 	delete this->parameters;
 	delete this->variables;
 	delete this->rows;
+	delete this->basis;
 }
 
 //*************************************** PUBLIC FUNCTIONS *****************************************//
@@ -142,25 +477,20 @@ void Solver::newVariable(const std::string& variableDefinition,
 		const ValueType variableType)
 				throw (VariableModelExceptions::DuplicateException,
 				VariableModelExceptions::InvalidGroupDefinitionException) {
-	std::smatch variableMatch { };
-	std::list<VarDimIdx> newVariableDimensions { };
+	StringUtils::Definition<VarDimIdx> definition { };
 
 	TRACE(logger, BundleKey::INIT_VAR_GROUP, variableDefinition.c_str());
 
-	if (std::regex_search(variableDefinition, variableMatch,
-			Solver::VAR_REGEXP)) {
-		TRACE(logger, BundleKey::INIT_VAR_REGEX_MATCH,
-				variableMatch[Solver::VAR_REGEX_NAME_GROUP_IDX].str().c_str(),
-				Utils::getStringDimensions(
-						variableMatch[Solver::VAR_REGEX_DIM_GROUP_IDX].str()).c_str());
-		newVariableDimensions = getVariableDimensionList(
-				variableMatch[Solver::VAR_REGEX_DIM_GROUP_IDX].str().c_str());
-		insertVariable(variableMatch[Solver::VAR_REGEX_NAME_GROUP_IDX].str(),
-				Solver::countVariablesInGroup(newVariableDimensions),
-				newVariableDimensions, variableLowerBound, variableUpperBound,
-				variableType);
+	if (StringUtils::parseDefinition<VarDimIdx>(variableDefinition.c_str(),
+			variableDefinition.length(), definition)) {
+		TRACE(logger, BundleKey::INIT_VAR_DEFINITION_MATCH,
+				std::string(definition.name, definition.nameLength).c_str(),
+				Utils::getStringDimensions(definition.indexes).c_str());
+		insertVariable(std::string(definition.name, definition.nameLength),
+				VarDimensionTable { definition.indexes }, variableLowerBound,
+				variableUpperBound, variableType);
 	} else {
-		FATAL(logger, BundleKey::INIT_VAR_GROUP_REGEX_SEARCH_FAILED,
+		FATAL(logger, BundleKey::INIT_VAR_GROUP_PARSE_FAILED,
 				variableDefinition.c_str());
 		throw VariableModelExceptions::InvalidGroupDefinitionException();
 	}
@@ -179,67 +509,80 @@ void Solver::deleteAllVariables() {
 		++itBegin;
 	}
 	this->variables->clear();
+	this->problemInstance->deleteColumns(0,
+			this->problemInstance->getNumberOfColumns());
+	remapBasisAfterDeletion();
 }
 
 void Solver::deleteVariable(const char* variableName) throw (std::out_of_range) {
+	VariableIdxMapper* variableIdxMapper = Solver::getVariableIdxMapperAt(
+			variableName);
+	const VarIdx beginIdx { variableIdxMapper->getBeginIdx() };
+	const VarIdx count { variableIdxMapper->getNumberOfVariables() };
+
 	TRACE(logger, BundleKey::DELETE_VARIABLE,
-			Solver::getVariableIdxMapperAt(variableName)->toString().c_str());
+			variableIdxMapper->toString().c_str());
 
-	delete Solver::getVariableIdxMapperAt(variableName);
+	this->problemInstance->deleteColumns(beginIdx, count);
+	for (std::pair<const std::string, VariableIdxMapper*>& group : *this->variables) {
+		if (group.second->getBeginIdx() >= beginIdx + count) {
+			group.second->setBeginIdx(group.second->getBeginIdx() - count);
+		}
+	}
+	delete variableIdxMapper;
 	this->variables->erase(variableName);
+	remapBasisAfterDeletion();
 }
 
 /* Friend of VariableIdxMapper class: getVariable() */
-Variable& Solver::getVariable(const std::string& variableDefinition)
+Variable Solver::getVariable(const std::string& variableDefinition)
 		throw (std::out_of_range,
 		VariableModelExceptions::InvalidNumberOfDimensionIndexesException,
 		VariableModelExceptions::IndexOutOfBoundException,
 		VariableModelExceptions::InvalidDefinitionException) {
-	std::smatch variableMatch { };
-	std::list<VarDimIdx> dimensions { };
+	StringUtils::Definition<VarDimIdx> definition { };
 	VariableIdxMapper*variableIdxMapper { };
 
-	if (std::regex_search(variableDefinition, variableMatch,
-			Solver::VAR_REGEXP)) {
-		variableIdxMapper = Solver::getVariableIdxMapperAt(
-				variableMatch[Solver::VAR_REGEX_NAME_GROUP_IDX].str());
-		dimensions = getVariableDimensionList(
-				variableMatch[Solver::VAR_REGEX_DIM_GROUP_IDX].str().c_str());
-		TRACE(logger, BundleKey::GET_VAR_REGEX_MATCHED,
+	if (StringUtils::parseDefinition<VarDimIdx>(variableDefinition.c_str(),
+			variableDefinition.length(), definition)) {
+		variableIdxMapper = Solver::getVariableIdxMapperAt(definition.name,
+				definition.nameLength);
+		TRACE(logger, BundleKey::GET_VAR_DEFINITION_MATCHED,
 				variableDefinition.c_str());
-		if (variableIdxMapper->getDimensionsSize() == dimensions.size()
-				&& !MapUtils::ifDimensionsOutOfBounds<VarDimIdx>(
-						variableIdxMapper->getDimensions(), dimensions)) {
-			return variableIdxMapper->getVariable(dimensions);
+		if (variableIdxMapper->getDimensionsSize() == definition.indexes.size()
+				&& !MapUtils::ifDimensionsOutOfBounds<VarIdx, VarDimIdx>(
+						variableIdxMapper->getDimensions(),
+						definition.indexes)) {
+			return variableIdxMapper->getVariable(definition.indexes);
 		} else if (variableIdxMapper->getDimensionsSize()
-				!= dimensions.size()) {
+				!= definition.indexes.size()) {
 			FATAL(logger, BundleKey::GET_VAR_DIFFERENT_DIM_SIZE,
-					variableDefinition.c_str(), dimensions.size(),
-					variableMatch[Solver::VAR_REGEX_NAME_GROUP_IDX].str().c_str(),
+					variableDefinition.c_str(),
+					variableIdxMapper->getGroupName().c_str(),
 					variableIdxMapper->getDimensionsSize());
 			throw VariableModelExceptions::InvalidNumberOfDimensionIndexesException();
 		} else {
 			FATAL(logger, BundleKey::GET_VAR_INDEX_OUT_OF_BOUNDS,
 					variableDefinition.c_str(),
-					variableMatch[Solver::VAR_REGEX_NAME_GROUP_IDX].str().c_str(),
+					variableIdxMapper->getGroupName().c_str(),
 					Utils::getStringDimensions(
-							variableIdxMapper->getDimensions()).c_str());
+							variableIdxMapper->getDimensions().getExtents()).c_str());
 			throw VariableModelExceptions::IndexOutOfBoundException();
 		}
 	} else {
-		FATAL(logger, BundleKey::GET_VAR_GROUP_REGEX_SEARCH_FAILED,
+		FATAL(logger, BundleKey::GET_VAR_DEFINITION_PARSE_FAILED,
 				variableDefinition.c_str());
 		throw VariableModelExceptions::InvalidDefinitionException();
 	}
 }
 
 /* Friend of VariableIdxMapper class: getVariable() */
-Variable& Solver::getVariable(const std::string& variableDefinition,
+Variable Solver::getVariable(const std::string& variableDefinition,
 		VarDimIdx firstDimensionIndex,
 		...) throw (std::out_of_range,
 				VariableModelExceptions::InvalidNumberOfDimensionIndexesException,
 				VariableModelExceptions::IndexOutOfBoundException) {
-	std::list<VarDimIdx> dimensions { };
+	VarIndexTuple dimensions { };
 	VariableIdxMapper*variableIdxMapper { };
 	va_list va { };
 
@@ -266,31 +609,672 @@ Variable& Solver::getVariable(const std::string& variableDefinition,
 			}
 			va_end(va);
 
-			if (!MapUtils::ifDimensionsOutOfBounds<VarDimIdx>(
+			if (!MapUtils::ifDimensionsOutOfBounds<VarIdx, VarDimIdx>(
 					variableIdxMapper->getDimensions(), dimensions)) {
 				return variableIdxMapper->getVariable(dimensions);
 			} else {
 				FATAL(logger, BundleKey::GET_VAR_INDEX_OUT_OF_BOUNDS,
 						variableDefinition.c_str(), variableName.c_str(),
 						Utils::getStringDimensions(
-								variableIdxMapper->getDimensions()).c_str());
+								variableIdxMapper->getDimensions().getExtents()).c_str());
 				throw VariableModelExceptions::IndexOutOfBoundException();
 			}
 		} else {
 			FATAL(logger, BundleKey::GET_VAR_DIFFERENT_DIM_SIZE,
-					variableDefinition.c_str(), dimensions.size(),
-					variableName.c_str(),
+					variableDefinition.c_str(), variableName.c_str(),
 					variableIdxMapper->getDimensionsSize());
 			throw VariableModelExceptions::InvalidNumberOfDimensionIndexesException();
 		}
 	} else {
-		FATAL(logger, BundleKey::GET_VAR_GROUP_REGEX_SEARCH_FAILED,
+		FATAL(logger, BundleKey::GET_VAR_DEFINITION_PARSE_FAILED,
 				variableDefinition.c_str());
 		throw VariableModelExceptions::InvalidDefinitionException();
 	}
 }
 
+void Solver::newParameter(const std::string& parameterDefinition)
+		throw (ParameterModelExceptions::DuplicateException,
+		ParameterModelExceptions::InvalidGroupDefinitionException) {
+	return Solver::newParameter(parameterDefinition, 0);
+}
+
+void Solver::newParameter(const std::string& parameterDefinition,
+		const ParamValue value)
+				throw (ParameterModelExceptions::DuplicateException,
+				ParameterModelExceptions::InvalidGroupDefinitionException) {
+	return Solver::newParameter(parameterDefinition, value,
+			Utils::getUnbounded(Bounds::LOWER),
+			Utils::getUnbounded(Bounds::UPPER), ValueType::DOUBLE);
+}
+
+void Solver::newParameter(const std::string& parameterDefinition,
+		const ParamValue value, const ParamValue parameterLowerBound,
+		const ParamValue parameterUpperBound, const ValueType parameterType)
+				throw (ParameterModelExceptions::DuplicateException,
+				ParameterModelExceptions::InvalidGroupDefinitionException,
+				ParameterModelExceptions::ValueOutOfBoundException) {
+	StringUtils::Definition<ParamDimIdx> definition { };
+
+	TRACE(logger, BundleKey::INIT_PARAM_GROUP, parameterDefinition.c_str());
+
+	if (!(parameterLowerBound <= value && value <= parameterUpperBound)) {
+		FATAL(logger, BundleKey::INIT_PARAM_VALUE_OUT_OF_BOUNDS, value,
+				parameterDefinition.c_str(),
+				Utils::getStringBound(parameterLowerBound).c_str(),
+				Utils::getStringBound(parameterUpperBound).c_str());
+		throw ParameterModelExceptions::ValueOutOfBoundException();
+	}
+	if (StringUtils::parseDefinition<ParamDimIdx>(parameterDefinition.c_str(),
+			parameterDefinition.length(), definition)) {
+		insertParameters(std::string(definition.name, definition.nameLength),
+				ParamDimensionTable { definition.indexes }, parameterLowerBound,
+				parameterUpperBound, parameterType, value);
+	} else {
+		FATAL(logger, BundleKey::INIT_PARAM_GROUP_PARSE_FAILED,
+				parameterDefinition.c_str());
+		throw ParameterModelExceptions::InvalidGroupDefinitionException();
+	}
+}
+
+void Solver::loadParameter(const std::string& fileName)
+		throw (ParameterModelExceptions::DuplicateException,
+		ParameterModelExceptions::TensorFileException) {
+	return Solver::loadParameter(fileName, "");
+}
+
+void Solver::loadParameter(const std::string& fileName,
+		const std::string& groupOfParametersName)
+				throw (ParameterModelExceptions::DuplicateException,
+				ParameterModelExceptions::TensorFileException) {
+	TensorFileUtils::Mapping mapping { };
+	TensorFileUtils::Description description { };
+	std::string groupName { };
+	ParamIdxMapper* paramIdxMapper { };
+
+	try {
+		mapping = TensorFileUtils::map(fileName);
+	} catch (const ParameterModelExceptions::TensorFileException& e) {
+		FATAL(logger, BundleKey::LOAD_PARAM_TENSOR_FAILED, fileName.c_str());
+		throw;
+	}
+	if (TensorFileUtils::readDescription(mapping, description)) {
+		groupName =
+				groupOfParametersName.empty() ?
+						description.name : groupOfParametersName;
+	}
+	if (groupName.empty()) {
+		TensorFileUtils::unmap(mapping);
+		FATAL(logger, BundleKey::LOAD_PARAM_TENSOR_FAILED, fileName.c_str());
+		throw ParameterModelExceptions::TensorFileException();
+	}
+	if (this->parameters->count(groupName)) {
+		TensorFileUtils::unmap(mapping);
+		FATAL(logger, BundleKey::INIT_PARAM_DUPLICATE, groupName.c_str(),
+				this->parameters->at(groupName)->toString().c_str());
+		throw ParameterModelExceptions::DuplicateException();
+	}
+
+	INFO(logger, BundleKey::LOAD_PARAM_TENSOR, groupName.c_str(),
+			description.numberOfElements, fileName.c_str(),
+			TensorFileUtils::isNative(description.dataType) ?
+					"mapped in place" : "converted");
+	if (TensorFileUtils::isNative(description.dataType)) {
+		paramIdxMapper = new ParamIdxMapper { ParamDimensionTable {
+				description.extents }, mapping, description.dataOffset,
+				groupName };
+	} else {
+		paramIdxMapper = new ParamIdxMapper { ParamDimensionTable {
+				description.extents }, Utils::getUnbounded(Bounds::LOWER),
+				Utils::getUnbounded(Bounds::UPPER), ValueType::DOUBLE, 0,
+				groupName };
+		TensorFileUtils::convert(mapping, description,
+				paramIdxMapper->getValues());
+		TensorFileUtils::unmap(mapping);
+	}
+	this->parameters->insert(
+			std::pair<std::string, ParamIdxMapper*>(groupName, paramIdxMapper));
+}
+
+void Solver::saveParameter(const std::string& groupOfParametersName,
+		const std::string& fileName)
+				throw (ParameterModelExceptions::NoSuchGroupException,
+				ParameterModelExceptions::TensorFileException) {
+	const ParamIdxMapper* paramIdxMapper = Solver::getParamIdxMapperAt(
+			groupOfParametersName.c_str(), groupOfParametersName.length());
+	INFO(logger, BundleKey::SAVE_PARAM_TENSOR, groupOfParametersName.c_str(),
+			paramIdxMapper->getNumberOfParameters(), fileName.c_str());
+	try {
+		TensorFileUtils::write(fileName, groupOfParametersName,
+				paramIdxMapper->getDimensions(), paramIdxMapper->getValues());
+	} catch (const ParameterModelExceptions::TensorFileException& e) {
+		FATAL(logger, BundleKey::SAVE_PARAM_TENSOR_FAILED,
+				groupOfParametersName.c_str(), fileName.c_str());
+		throw;
+	}
+}
+
+ParamLoadReport Solver::loadParameterText(
+		const std::string& groupOfParametersName, const std::string& fileName,
+		const ParamValue defaultValue, const unsigned int numberOfThreads)
+				throw (ParameterModelExceptions::NoSuchGroupException,
+				ParameterModelExceptions::DataFileException) {
+	ParamTextLoader loader(
+			Solver::getParamIdxMapperAt(groupOfParametersName.c_str(),
+					groupOfParametersName.length()), defaultValue,
+			numberOfThreads);
+	return loader.load(fileName);
+}
+
+void Solver::deleteAllParameters() {
+	for (std::pair<const std::string, ParamIdxMapper*>& group : *this->parameters) {
+		TRACE(logger, BundleKey::DELETE_PARAMETERS,
+				group.second->toString().c_str());
+		delete group.second;
+	}
+	this->parameters->clear();
+}
+
+/* Friend of ParamIdxMapper class: getParameter() */
+Parameter Solver::getParameter(const std::string& parameterDefinition)
+		throw (ParameterModelExceptions::NoSuchGroupException,
+		ParameterModelExceptions::InvalidNumberOfDimensionIndexesException,
+		ParameterModelExceptions::IndexOutOfBoundException,
+		ParameterModelExceptions::InvalidDefinitionException) {
+	StringUtils::Definition<ParamDimIdx> definition { };
+	ParamIdxMapper* paramIdxMapper { };
+
+	if (StringUtils::parseDefinition<ParamDimIdx>(parameterDefinition.c_str(),
+			parameterDefinition.length(), definition)) {
+		paramIdxMapper = Solver::getParamIdxMapperAt(definition.name,
+				definition.nameLength);
+		if (paramIdxMapper->getDimensionsSize() == definition.indexes.size()
+				&& !MapUtils::ifDimensionsOutOfBounds<ParamIdx, ParamDimIdx>(
+						paramIdxMapper->getDimensions(), definition.indexes)) {
+			return paramIdxMapper->getParameter(definition.indexes);
+		} else if (paramIdxMapper->getDimensionsSize()
+				!= definition.indexes.size()) {
+			FATAL(logger, BundleKey::GET_PARAM_DIFFERENT_DIM_SIZE,
+					parameterDefinition.c_str(),
+					paramIdxMapper->getGroupName().c_str(),
+					paramIdxMapper->getDimensionsSize());
+			throw ParameterModelExceptions::InvalidNumberOfDimensionIndexesException();
+		} else {
+			FATAL(logger, BundleKey::GET_PARAM_INDEX_OUT_OF_BOUNDS,
+					parameterDefinition.c_str(),
+					paramIdxMapper->getGroupName().c_str(),
+					Utils::getStringDimensions(
+							paramIdxMapper->getDimensions().getExtents()).c_str());
+			throw ParameterModelExceptions::IndexOutOfBoundException();
+		}
+	} else {
+		FATAL(logger, BundleKey::GET_PARAM_DEFINITION_PARSE_FAILED,
+				parameterDefinition.c_str());
+		throw ParameterModelExceptions::InvalidDefinitionException();
+	}
+}
+
+void Solver::newRows(const std::string& rowDefinition)
+		throw (RowModelExceptions::DuplicateException,
+		RowModelExceptions::InvalidGroupDefinitionException) {
+	return Solver::newRows(rowDefinition, Utils::getUnbounded(Bounds::LOWER),
+			Utils::getUnbounded(Bounds::UPPER));
+}
+
+void Solver::newRows(const std::string& rowDefinition,
+		const VarValue rowLowerBound, const VarValue rowUpperBound)
+				throw (RowModelExceptions::DuplicateException,
+				RowModelExceptions::InvalidGroupDefinitionException) {
+	StringUtils::Definition<RowDimIdx> definition { };
+
+	TRACE(logger, BundleKey::INIT_ROW_GROUP, rowDefinition.c_str());
+
+	if (StringUtils::parseDefinition<RowDimIdx>(rowDefinition.c_str(),
+			rowDefinition.length(), definition)) {
+		insertRows(std::string(definition.name, definition.nameLength),
+				RowDimensionTable { definition.indexes }, rowLowerBound,
+				rowUpperBound);
+	} else {
+		FATAL(logger, BundleKey::INIT_ROW_GROUP_PARSE_FAILED,
+				rowDefinition.c_str());
+		throw RowModelExceptions::InvalidGroupDefinitionException();
+	}
+}
+
+void Solver::deleteAllRows() {
+	for (std::pair<const std::string, RowIdxMapper*>& group : *this->rows) {
+		TRACE(logger, BundleKey::DELETE_ROWS, group.second->toString().c_str());
+		delete group.second;
+	}
+	this->rows->clear();
+	this->problemInstance->deleteRows(0,
+			this->problemInstance->getNumberOfRows());
+	remapBasisAfterDeletion();
+}
+
+/* Friend of RowIdxMapper class: getRow() */
+Row Solver::getRow(const std::string& rowDefinition)
+		throw (RowModelExceptions::NoSuchGroupException,
+		RowModelExceptions::InvalidNumberOfDimensionIndexesException,
+		RowModelExceptions::IndexOutOfBoundException,
+		RowModelExceptions::InvalidDefinitionException) {
+	StringUtils::Definition<RowDimIdx> definition { };
+	RowIdxMapper* rowIdxMapper { };
+
+	if (StringUtils::parseDefinition<RowDimIdx>(rowDefinition.c_str(),
+			rowDefinition.length(), definition)) {
+		rowIdxMapper = Solver::getRowIdxMapperAt(definition.name,
+				definition.nameLength);
+		if (rowIdxMapper->getDimensionsSize() == definition.indexes.size()
+				&& !MapUtils::ifDimensionsOutOfBounds<RowIdx, RowDimIdx>(
+						rowIdxMapper->getDimensions(), definition.indexes)) {
+			return rowIdxMapper->getRow(definition.indexes);
+		} else if (rowIdxMapper->getDimensionsSize()
+				!= definition.indexes.size()) {
+			FATAL(logger, BundleKey::GET_ROW_DIFFERENT_DIM_SIZE,
+					rowDefinition.c_str(),
+					rowIdxMapper->getGroupName().c_str(),
+					rowIdxMapper->getDimensionsSize());
+			throw RowModelExceptions::InvalidNumberOfDimensionIndexesException();
+		} else {
+			FATAL(logger, BundleKey::GET_ROW_INDEX_OUT_OF_BOUNDS,
+					rowDefinition.c_str(),
+					rowIdxMapper->getGroupName().c_str(),
+					Utils::getStringDimensions(
+							rowIdxMapper->getDimensions().getExtents()).c_str());
+			throw RowModelExceptions::IndexOutOfBoundException();
+		}
+	} else {
+		FATAL(logger, BundleKey::GET_ROW_DEFINITION_PARSE_FAILED,
+				rowDefinition.c_str());
+		throw RowModelExceptions::InvalidDefinitionException();
+	}
+}
+
+void Solver::generateRows(const size_t numberOfTasks,
+		const RowGenerator& generator, const unsigned int numberOfThreads,
+		const size_t batchSize) {
+	const unsigned int threads { ThreadUtils::getNumberOfThreads(
+			numberOfThreads) };
+	const size_t batch { batchSize != 0 ? batchSize :
+			std::max((size_t) 1, numberOfTasks / (16 * threads)) };
+	const size_t numberOfBatches { (numberOfTasks + batch - 1) / batch };
+	RowBuffer* buffers = new RowBuffer[threads];
+	std::vector<RowBuffer::Segment> segments(numberOfBatches);
+	std::vector<unsigned int> segmentOwner(numberOfBatches);
+	std::vector<size_t> segmentPosition(numberOfBatches);
+	std::vector<std::exception_ptr> exceptions(threads);
+	std::atomic<size_t> nextBatch { 0 };
+	size_t numberOfElements { 0 }, numberOfBounds { 0 }, position { };
+
+	INFO(logger, BundleKey::GENERATE_ROWS, numberOfTasks, threads, batch);
+
+	ThreadUtils::runWorkers(threads,
+			[&](const unsigned int t) {
+				size_t b {};
+				try {
+					while ((b = nextBatch.fetch_add(1)) < numberOfBatches) {
+						segments[b] = buffers[t].beginSegment();
+						for (size_t task = b * batch; task < std::min(numberOfTasks, (b + 1) * batch); task += 1) {
+							generator(task, buffers[t]);
+						}
+						buffers[t].endSegment(segments[b]);
+						checkRowBuffer(buffers[t], segments[b].elementsBegin, segments[b].boundsBegin);
+						segmentOwner[b] = t;
+					}
+				} catch (...) {
+					exceptions[t] = std::current_exception();
+					nextBatch.store(numberOfBatches);
+				}
+			});
+
+	for (std::exception_ptr& exception : exceptions) {
+		if (exception) {
+			delete[] buffers;
+			std::rethrow_exception(exception);
+		}
+	}
+
+	for (size_t b = 0; b < numberOfBatches; b += 1) {
+		segmentPosition[b] = numberOfElements;
+		numberOfElements += segments[b].numberOfElements;
+		numberOfBounds += segments[b].numberOfBounds;
+	}
+	DEBUG(logger, BundleKey::MERGE_ROW_BUFFERS, numberOfElements,
+			numberOfBounds, threads);
+
+	position = this->problemInstance->extendElements(numberOfElements);
+	ThreadUtils::runWorkers(threads,
+			[&](const unsigned int t) {
+				const RowBuffer& buffer = buffers[t];
+				for (size_t b = 0; b < numberOfBatches; b += 1) {
+					if (segmentOwner[b] == t) {
+						this->problemInstance->assignElements(position + segmentPosition[b],
+								buffer.rowIdx.data() + segments[b].elementsBegin,
+								buffer.columnIdx.data() + segments[b].elementsBegin,
+								buffer.value.data() + segments[b].elementsBegin,
+								segments[b].numberOfElements);
+					}
+				}
+			});
+
+	for (size_t b = 0; b < numberOfBatches; b += 1) {
+		const RowBuffer& buffer = buffers[segmentOwner[b]];
+		for (size_t i = segments[b].boundsBegin;
+				i < segments[b].boundsBegin + segments[b].numberOfBounds; i +=
+						1) {
+			this->problemInstance->setRowLowerBound(buffer.boundRowIdx[i],
+					buffer.lowerBound[i]);
+			this->problemInstance->setRowUpperBound(buffer.boundRowIdx[i],
+					buffer.upperBound[i]);
+		}
+	}
+
+	delete[] buffers;
+}
+
+void Solver::loadProblem() {
+	this->problemInstance->updateProblem();
+}
+
+void Solver::reloadProblem() {
+	this->problemInstance->loadProblem();
+}
+
+SolveStatus Solver::solve(const SolveOptions& options) {
+	waitForSolve();
+	return solve(options, nullptr);
+}
+
+SolveHandle Solver::solveAsync(const SolveOptions& options) {
+	waitForSolve();
+	INFO(logger, BundleKey::SOLVE_ASYNC, getNumberOfVariables(),
+			getNumberOfRows());
+	this->solveHandle = new SolveHandle { };
+	this->solveThread = new std::thread { [this, options]() {
+		SolveStatus status {SolveStatus::ABANDONED};
+		std::exception_ptr exception {};
+		try {
+			status = solve(options, &this->solveHandle->state->cancelled);
+		} catch (...) {
+			exception = std::current_exception();
+		}
+		this->solveHandle->finish(status, exception);
+	} };
+	return *this->solveHandle;
+}
+
+void Solver::saveBasis(const std::string& fileName) const
+		throw (ModelExceptions::BasisFileException) {
+	INFO(logger, BundleKey::SAVE_BASIS, this->basis->getNumberOfColumns(),
+			this->basis->getNumberOfRows(), fileName.c_str());
+	try {
+		this->basis->save(fileName);
+	} catch (const ModelExceptions::BasisFileException& e) {
+		FATAL(logger, BundleKey::SAVE_BASIS_FAILED, fileName.c_str());
+		throw;
+	}
+}
+
+void Solver::loadBasis(const std::string& fileName)
+		throw (ModelExceptions::BasisFileException) {
+	try {
+		this->basis->load(fileName);
+	} catch (const ModelExceptions::BasisFileException& e) {
+		FATAL(logger, BundleKey::LOAD_BASIS_FAILED, fileName.c_str());
+		throw;
+	}
+	INFO(logger, BundleKey::LOAD_BASIS, this->basis->getNumberOfColumns(),
+			this->basis->getNumberOfRows(), fileName.c_str());
+	this->basisPending = true;
+}
+
+void Solver::writeModel(const std::string& fileName,
+		const ModelFormat format, const bool compressed)
+				throw (ModelExceptions::ModelFileException) {
+	ModelWriter writer { this->problemInstance, format };
+	waitForSolve();
+	for (std::pair<const std::string, VariableIdxMapper*>& group : *this->variables) {
+		writer.addColumnGroup(group.first, group.second->getDimensions(),
+				group.second->getBeginIdx(), group.second->getType());
+	}
+	for (std::pair<const std::string, RowIdxMapper*>& group : *this->rows) {
+		writer.addRowGroup(group.first, group.second->getDimensions(),
+				group.second->getBeginIdx());
+	}
+	try {
+		writer.write(fileName, compressed);
+	} catch (const ModelExceptions::ModelFileException& e) {
+		FATAL(logger, BundleKey::WRITE_MODEL_FAILED, fileName.c_str());
+		this->problemInstance->releaseCoefficientsCache();
+		throw;
+	}
+	// compressed copy of coefficients used by writer is as large as the matrix itself
+	this->problemInstance->releaseCoefficientsCache();
+}
+
+void Solver::readModel(const std::string& fileName,
+		const ModelFormat format, const unsigned int numberOfThreads)
+				throw (ModelExceptions::ModelFileException,
+				VariableModelExceptions::DuplicateException,
+				RowModelExceptions::DuplicateException) {
+	ModelReader reader { format, ThreadUtils::getNumberOfThreads(
+			numberOfThreads), Utils::getUnbounded(Bounds::UPPER) };
+	VarIdx firstColumnIdx { };
+	RowIdx firstRowIdx { };
+	size_t numberOfNewColumns { 0 }, numberOfNewRows { 0 };
+	waitForSolve();
+	try {
+		reader.read(fileName);
+	} catch (const ModelExceptions::ModelFileException& e) {
+		FATAL(logger, BundleKey::READ_MODEL_FAILED, fileName.c_str());
+		throw;
+	}
+
+	// groups are checked before any of them is added, so model is not changed by rejected file
+	for (const ModelReader::Group& group : reader.columns.groups) {
+		numberOfNewColumns += group.dimensions.getNumberOfElements();
+	}
+	for (const ModelReader::Group& group : reader.rows.groups) {
+		numberOfNewRows += group.dimensions.getNumberOfElements();
+	}
+	if (numberOfNewColumns > std::numeric_limits<VarIdx>::max()
+			- this->problemInstance->getNumberOfColumns()
+			|| numberOfNewRows > std::numeric_limits<RowIdx>::max()
+					- this->problemInstance->getNumberOfRows()) {
+		FATAL(logger, BundleKey::READ_MODEL_TOO_LARGE, fileName.c_str(),
+				numberOfNewColumns, numberOfNewRows,
+				this->problemInstance->getNumberOfColumns(),
+				this->problemInstance->getNumberOfRows());
+		throw ModelExceptions::ModelFileException();
+	}
+	for (const ModelReader::Group& group : reader.columns.groups) {
+		if (this->variables->count(group.name)) {
+			FATAL(logger, BundleKey::READ_MODEL_DUPLICATE_VARIABLES,
+					group.name.c_str(), fileName.c_str());
+			throw VariableModelExceptions::DuplicateException();
+		}
+	}
+	for (const ModelReader::Group& group : reader.rows.groups) {
+		if (this->rows->count(group.name)) {
+			FATAL(logger, BundleKey::READ_MODEL_DUPLICATE_ROWS,
+					group.name.c_str(), fileName.c_str());
+			throw RowModelExceptions::DuplicateException();
+		}
+	}
+
+	firstColumnIdx = this->problemInstance->getNumberOfColumns();
+	firstRowIdx = this->problemInstance->getNumberOfRows();
+	for (const ModelReader::Group& group : reader.columns.groups) {
+		insertVariable(group.name, group.dimensions, 0,
+				Utils::getUnbounded(Bounds::UPPER), group.type);
+	}
+	for (const ModelReader::Group& group : reader.rows.groups) {
+		insertRows(group.name, group.dimensions,
+				Utils::getUnbounded(Bounds::LOWER),
+				Utils::getUnbounded(Bounds::UPPER));
+	}
+	reader.load(this->problemInstance, firstColumnIdx, firstRowIdx);
+}
+
+void Solver::saveSnapshot(const std::string& fileName)
+		throw (ModelExceptions::SnapshotFileException) {
+	ModelSnapshot snapshot { 1 };
+	waitForSolve();
+	for (std::pair<const std::string, VariableIdxMapper*>& group : *this->variables) {
+		snapshot.addVariableGroup(group.first, group.second->getDimensions(),
+				group.second->getBeginIdx(), group.second->getType());
+	}
+	for (std::pair<const std::string, RowIdxMapper*>& group : *this->rows) {
+		snapshot.addRowGroup(group.first, group.second->getDimensions(),
+				group.second->getBeginIdx());
+	}
+	for (std::pair<const std::string, ParamIdxMapper*>& group : *this->parameters) {
+		snapshot.addParamGroup(group.first, group.second->getDimensions(),
+				group.second->getLowerBound(), group.second->getUpperBound(),
+				group.second->getType(), group.second->getValues());
+	}
+	INFO(logger, BundleKey::SAVE_SNAPSHOT, snapshot.getNumberOfGroups(),
+			this->problemInstance->getNumberOfColumns(),
+			this->problemInstance->getNumberOfRows(),
+			this->problemInstance->getNumberOfElements(), fileName.c_str());
+	try {
+		snapshot.write(fileName, this->problemInstance);
+	} catch (const ModelExceptions::SnapshotFileException& e) {
+		FATAL(logger, BundleKey::SAVE_SNAPSHOT_FAILED, fileName.c_str());
+		throw;
+	}
+}
+
+void Solver::loadSnapshot(const std::string& fileName,
+		const unsigned int numberOfThreads)
+				throw (ModelExceptions::SnapshotFileException) {
+	ModelSnapshot snapshot { ThreadUtils::getNumberOfThreads(numberOfThreads) };
+	const std::chrono::steady_clock::time_point start {
+			std::chrono::steady_clock::now() };
+	ParamIdxMapper* paramIdxMapper { };
+	waitForSolve();
+	if (!this->variables->empty() || !this->rows->empty()
+			|| !this->parameters->empty()
+			|| this->problemInstance->getNumberOfColumns() != 0
+			|| this->problemInstance->getNumberOfRows() != 0) {
+		FATAL(logger, BundleKey::LOAD_SNAPSHOT_NOT_EMPTY, fileName.c_str());
+		throw ModelExceptions::SnapshotFileException();
+	}
+	try {
+		snapshot.read(fileName);
+	} catch (const ModelExceptions::SnapshotFileException& e) {
+		FATAL(logger, BundleKey::LOAD_SNAPSHOT_FAILED, fileName.c_str());
+		throw;
+	}
+
+	snapshot.load(this->problemInstance);
+	for (const ModelSnapshot::Group& group : snapshot.groups) {
+		switch (group.kind) {
+		case ModelSnapshot::VARIABLES:
+			this->variables->insert(
+					{ group.name, new VariableIdxMapper { this->problemInstance,
+							(VarIdx) group.beginIdx, VarDimensionTable {
+									group.extents }, group.type, group.name,
+							this->namesPolicy } });
+			break;
+		case ModelSnapshot::ROWS:
+			this->rows->insert(
+					{ group.name, new RowIdxMapper { this->problemInstance,
+							(RowIdx) group.beginIdx, RowDimensionTable {
+									group.extents }, group.name } });
+			break;
+		case ModelSnapshot::PARAMETERS:
+			paramIdxMapper = new ParamIdxMapper { ParamDimensionTable {
+					group.extents }, group.lowerBound, group.upperBound,
+					group.type, 0, group.name };
+			std::copy_n(group.values,
+					paramIdxMapper->getDimensions().getNumberOfElements(),
+					paramIdxMapper->getValues());
+			this->parameters->insert( { group.name, paramIdxMapper });
+			break;
+		}
+	}
+	INFO(logger, BundleKey::LOAD_SNAPSHOT, snapshot.getNumberOfGroups(),
+			this->problemInstance->getNumberOfColumns(),
+			this->problemInstance->getNumberOfRows(),
+			this->problemInstance->getNumberOfElements(), fileName.c_str(),
+			std::chrono::duration<double>(
+					std::chrono::steady_clock::now() - start).count());
+}
+
+std::vector<ScenarioResult> Solver::solveScenarios(
+		const std::vector<Scenario>& scenarios,
+		const unsigned int numberOfThreads) {
+	std::vector<ScenarioResult> results { };
+	waitForSolve();
+	for (size_t k = 0; k < scenarios.size(); k += 1) {
+		if (!scenarios[k].isValid(getNumberOfVariables(), getNumberOfRows())) {
+			FATAL(logger, BundleKey::SOLVE_SCENARIO_INVALID, k,
+					getNumberOfVariables(), getNumberOfRows());
+			throw ModelExceptions::InvalidScenarioException();
+		}
+	}
+	if (this->problemInstance->isPresolveEnabled()) {
+		// scenarios refer to columns and rows of the whole model
+		this->problemInstance->setPresolveEnabled(false);
+		loadProblem();
+		this->problemInstance->setPresolveEnabled(true);
+	} else {
+		loadProblem();
+	}
+	this->problemInstance->solveScenarios(scenarios, results,
+			numberOfThreads);
+	return results;
+}
+
 //*************************************** GETTERS & SETTERS ****************************************//
+
+void Solver::setNamesPolicy(const NamesPolicy namesPolicy) {
+	this->namesPolicy = namesPolicy;
+	for (std::pair<const std::string, VariableIdxMapper*>& group : *this->variables) {
+		group.second->setNamesPolicy(namesPolicy);
+	}
+}
+
+NamesPolicy Solver::getNamesPolicy() const {
+	return this->namesPolicy;
+}
+
+void Solver::setPresolveEnabled(const bool presolveEnabled) {
+	this->problemInstance->setPresolveEnabled(presolveEnabled);
+}
+
+bool Solver::isPresolveEnabled() const {
+	return this->problemInstance->isPresolveEnabled();
+}
+
+SolverInterface Solver::getSolverInterface() const {
+	return this->problemInstance->getSolverInterface();
+}
+
+const Basis& Solver::getBasis() const {
+	return *this->basis;
+}
+
+void Solver::setBasis(const Basis& basis) {
+	*this->basis = basis;
+	this->basisPending = true;
+}
+
+VarValue Solver::getObjectiveValue() const {
+	return this->problemInstance->getObjectiveValue();
+}
+
+Solution Solver::getSolution() const {
+	Solution solution { };
+	this->problemInstance->copySolution(solution);
+	return solution;
+}
+
 VarIdx Solver::getNumberOfVariables() const {
 	return this->problemInstance->getNumberOfColumns();
 }
+
+RowIdx Solver::getNumberOfRows() const {
+	return this->problemInstance->getNumberOfRows();
+}
@@ -14,7 +14,9 @@
 #include "../include/exp/VariableModelExeptions.hpp"
 #include "../include/log/bundle/Bundle.hpp"
 #include "../include/log/utils/LogUtils.hpp"
+#include "../include/OsiProblemInstance.hpp"
 #include "../include/utils/Utils.hpp"
+#include "../include/VariableIdxMapper.hpp"
 
 const log4cxx::LoggerPtr logger(log4cxx::Logger::getLogger("Variable"));
 
@@ -24,35 +26,27 @@ const log4cxx::LoggerPtr logger(log4cxx::Logger::getLogger("Variable"));
 
 //*************************************** PRIVATE FUNCTIONS ****************************************//
 
-bool Variable::isValueOutOfBounds(const VarValue value) {
-	return !(this->lowerBonud <= value && value <= this->upperBound);
+bool Variable::isValueOutOfBounds(const VarValue value) const {
+	return !(this->getLowerBonud() <= value && value <= this->getUpperBound());
 }
 
 //************************************* PUBLIC CONSTANT FIELDS *************************************//
 
 //************************************ CONSTRUCTOR & DESTRUCTOR ************************************//
 
-Variable::Variable(VarValue lowerBonud, VarValue upperBound) :
-		lowerBonud(lowerBonud), upperBound(upperBound), objectiveCoefficient(0), value(
-				0), isFixed { false } {
-	DEBUG(logger, BundleKey::INIT_VAR_VARIABLE_CONSTRUCTOR,
-			Utils::getStringBound(lowerBonud).c_str(),
-			Utils::getStringBound(upperBound).c_str());
-	this->rowCoefficients = new std::unordered_map<RowIdx, VarValue> { };
-}
-
-Variable::~Variable() {
-	delete this->rowCoefficients;
+Variable::Variable(OsiProblemInstance* problemInstance,
+		const VariableIdxMapper* variableGroup, const VarIdx columnIdx) :
+		problemInstance(problemInstance), variableGroup(variableGroup), columnIdx(
+				columnIdx) {
 }
 
 //*************************************** PUBLIC FUNCTIONS *****************************************//
 
 void Variable::fixValue(const VarValue& fixedValue) {
 	if (!this->isValueOutOfBounds(fixedValue)) {
-		TRACE(logger, BundleKey::SET_VAR_FIX_VALUE, variableName.c_str(),
-				fixedValue);
-		this->isFixed = true;
-		this->value = fixedValue;
+		TRACE(logger, BundleKey::SET_VAR_FIX_VALUE,
+				this->getVariableName().c_str(), fixedValue);
+		this->problemInstance->fixColumnValue(this->columnIdx, fixedValue);
 	} else {
 		FATAL(logger, BundleKey::SET_VAR_FIX_VALUE_OUT_OF_BOUNDS, fixedValue,
 				this->getVariableName().c_str(),
@@ -62,38 +56,78 @@ void Variable::fixValue(const VarValue& fixedValue) {
 	}
 }
 
-void Variable::setNewBounds(const VarBounds& varBounds) {
-
+void Variable::setNewBounds(const VarBounds& varBounds)
+		throw (VariableModelExceptions::InvalidBoundsException) {
+	BoundsReport report { 1, 0, { } };
+	if (this->problemInstance->checkColumnBounds(this->columnIdx, 1,
+			&varBounds.first, &varBounds.second, 0, report) == 0) {
+		TRACE(logger, BundleKey::SET_VAR_BOUNDS,
+				this->getVariableName().c_str(),
+				Utils::getStringBound(varBounds.first).c_str(),
+				Utils::getStringBound(varBounds.second).c_str());
+		this->problemInstance->setColumnBounds(this->columnIdx, 1,
+				&varBounds.first, &varBounds.second, 0);
+	} else {
+		FATAL(logger, BundleKey::SET_VAR_BOUNDS_INVALID,
+				Utils::getStringBound(varBounds.first).c_str(),
+				Utils::getStringBound(varBounds.second).c_str(),
+				this->getVariableName().c_str());
+		throw VariableModelExceptions::InvalidBoundsException();
+	}
 }
 
 std::string Variable::toString() const {
 	std::ostringstream os { };
-	os << "\tName of variables:\t\t" << variableName
+	const ColumnView column = this->problemInstance->getColumnCoefficients(
+			this->columnIdx);
+	os << "\tName of variables:\t\t" << this->getVariableName()
 			<< "\n\tVariable's lower bound\t\t:\t"
-			<< Utils::getStringBound(lowerBonud)
+			<< Utils::getStringBound(this->getLowerBonud())
 			<< "\n\tVariable's upper bound\t\t:\t"
-			<< Utils::getStringBound(upperBound)
-			<< "\n\tVariable's objective coefficient:\t" << objectiveCoefficient
-			<< "\n\tRow coefficients (" << rowCoefficients->size() << "):\n"
-			<< Utils::getStringVariableRowCoefficients(*rowCoefficients)
+			<< Utils::getStringBound(this->getUpperBound())
+			<< "\n\tVariable's objective coefficient:\t"
+			<< this->getObjectiveCoefficient() << "\n\tRow coefficients ("
+			<< column.size << "):\n"
+			<< (column.size == 0 ?
+					"" :
+					Utils::getStringVariableRowCoefficients(column.index,
+							column.value, column.size))
 			<< std::endl;
 	return os.str();
 }
 
 //*************************************** GETTERS & SETTERS ****************************************//
 
-void Variable::setVariableName(const std::string& variableName) {
-	this->variableName = variableName;
-}
-
 VarValue Variable::getLowerBonud() const {
-	return lowerBonud;
+	return this->problemInstance->getColumnLowerBound(this->columnIdx);
 }
 
 VarValue Variable::getUpperBound() const {
-	return upperBound;
+	return this->problemInstance->getColumnUpperBound(this->columnIdx);
+}
+
+VarValue Variable::getObjectiveCoefficient() const {
+	return this->problemInstance->getColumnObjective(this->columnIdx);
+}
+
+void Variable::setObjectiveCoefficient(const VarValue objectiveCoefficient) {
+	this->problemInstance->setColumnObjective(this->columnIdx,
+			objectiveCoefficient);
+}
+
+bool Variable::isFixed() const {
+	return this->problemInstance->isColumnFixed(this->columnIdx);
+}
+
+VarValue Variable::getValue() const {
+	return this->problemInstance->getColumnValue(this->columnIdx);
+}
+
+VarIdx Variable::getColumnIdx() const {
+	return this->columnIdx;
 }
 
-const std::string& Variable::getVariableName() const {
-	return this->variableName;
+std::string Variable::getVariableName() const {
+	return this->variableGroup->getVariableName(
+			this->columnIdx - this->variableGroup->getBeginIdx());
 }
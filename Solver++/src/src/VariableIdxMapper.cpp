@@ -10,9 +10,12 @@
 #include <log4cxx/helpers/messagebuffer.h>
 #include <log4cxx/logger.h>
 #include <sstream>
+#include <utility>
 
 #include "../include/log/bundle/Bundle.hpp"
 #include "../include/log/utils/LogUtils.hpp"
+#include "../include/OsiProblemInstance.hpp"
+#include "../include/ParameterIdxMapper.hpp"
 #include "../include/utils/MapperUtils.hpp"
 #include "../include/utils/Utils.hpp"
 #include "../include/Variable.hpp"
@@ -26,41 +29,158 @@ const log4cxx::LoggerPtr logger(
 
 //*************************************** PRIVATE FUNCTIONS ****************************************//
 
-Variable& VariableIdxMapper::getVariable(
-		const std::list<VarDimIdx>& dimensions) {
-	return *variables[MapUtils::linearizeDimensionList<VarIdx, VarDimIdx>(
-			this->dimensions, dimensions)];
+Variable VariableIdxMapper::getVariable(
+		const VarIndexTuple& dimensions) const {
+	return Variable { this->problemInstance, this,
+			this->beginIdx
+					+ MapUtils::linearizeDimensionList<VarIdx, VarDimIdx>(
+							this->dimensions, dimensions) };
+}
+
+void VariableIdxMapper::getRuns(const IndexRange* ranges,
+		std::vector<std::pair<VarIdx, VarIdx>>& runs) const {
+	const VarDimIdx numberOfDimensions {
+			this->dimensions.getNumberOfDimensions() };
+	VarDimIdx indexes[MAX_NUMBER_OF_DIMENSIONS] { };
+	VarIdx firstIdx { }, count { 1 };
+	VarDimIdx dimension { };
+
+	runs.clear();
+	for (VarDimIdx i = 0; i < numberOfDimensions; i += 1) {
+		if (ranges[i].size() == 0) {
+			return;
+		}
+		indexes[i] = ranges[i].first;
+	}
+	if (numberOfDimensions > 0) {
+		count = ranges[numberOfDimensions - 1].size();
+	}
+	while (true) {
+		firstIdx = this->beginIdx;
+		for (VarDimIdx i = 0; i < numberOfDimensions; i += 1) {
+			firstIdx += (indexes[i] - 1) * this->dimensions.getStride(i);
+		}
+		if (!runs.empty()
+				&& runs.back().first + runs.back().second == firstIdx) {
+			runs.back().second += count;
+		} else {
+			runs.push_back( { firstIdx, count });
+		}
+		// indexes of the other dimensions are advanced like digits of a number
+		dimension = numberOfDimensions > 0 ? numberOfDimensions - 1 : 0;
+		while (dimension > 0
+				&& indexes[dimension - 1] == ranges[dimension - 1].last) {
+			indexes[dimension - 1] = ranges[dimension - 1].first;
+			dimension -= 1;
+		}
+		if (dimension == 0) {
+			return;
+		}
+		indexes[dimension - 1] += 1;
+	}
+}
+
+void VariableIdxMapper::checkDimensions(
+		const ParamIdxMapper* parameterGroup) const
+				throw (VariableModelExceptions::DifferentDimensionsException) {
+	if (!(parameterGroup->getDimensions().getExtents()
+			== this->dimensions.getExtents())) {
+		FATAL(logger, BundleKey::VAR_GROUP_DIFFERENT_PARAM_DIMS,
+				parameterGroup->getGroupName().c_str(),
+				Utils::getStringDimensions(
+						parameterGroup->getDimensions().getExtents()).c_str(),
+				this->groupName.c_str(),
+				Utils::getStringDimensions(this->dimensions.getExtents()).c_str());
+		throw VariableModelExceptions::DifferentDimensionsException();
+	}
+}
+
+BoundsReport VariableIdxMapper::changeBounds(const IndexRange* ranges,
+		const VarValue* lowerBounds, const VarValue* upperBounds,
+		const size_t stride) const {
+	std::vector<std::pair<VarIdx, VarIdx>> runs { };
+	BoundsReport report { 0, 0, { } };
+	size_t offset { };
+
+	getRuns(ranges, runs);
+	for (const std::pair<VarIdx, VarIdx>& run : runs) {
+		offset = (run.first - this->beginIdx) * stride;
+		this->problemInstance->checkColumnBounds(run.first, run.second,
+				lowerBounds + offset, upperBounds + offset, stride, report);
+		report.numberOfVariables += run.second;
+	}
+	if (!report.isApplied()) {
+		WARN(logger, BundleKey::SET_VAR_GROUP_BOUNDS_REJECTED,
+				report.numberOfVariables, this->groupName.c_str(),
+				report.numberOfFailures,
+				getVariableName(
+						report.failures.front().columnIdx - this->beginIdx).c_str());
+		return report;
+	}
+	for (const std::pair<VarIdx, VarIdx>& run : runs) {
+		offset = (run.first - this->beginIdx) * stride;
+		this->problemInstance->setColumnBounds(run.first, run.second,
+				lowerBounds + offset, upperBounds + offset, stride);
+	}
+	DEBUG(logger, BundleKey::SET_VAR_GROUP_BOUNDS, report.numberOfVariables,
+			this->groupName.c_str());
+	return report;
+}
+
+BoundsReport VariableIdxMapper::changeValues(const IndexRange* ranges,
+		const VarValue* values, const size_t stride) const {
+	std::vector<std::pair<VarIdx, VarIdx>> runs { };
+	BoundsReport report { 0, 0, { } };
+	size_t offset { };
+
+	getRuns(ranges, runs);
+	for (const std::pair<VarIdx, VarIdx>& run : runs) {
+		offset = (run.first - this->beginIdx) * stride;
+		this->problemInstance->checkColumnValues(run.first, run.second,
+				values + offset, stride, report);
+		report.numberOfVariables += run.second;
+	}
+	if (!report.isApplied()) {
+		WARN(logger, BundleKey::FIX_VAR_GROUP_VALUES_REJECTED,
+				report.numberOfVariables, this->groupName.c_str(),
+				report.numberOfFailures,
+				getVariableName(
+						report.failures.front().columnIdx - this->beginIdx).c_str());
+		return report;
+	}
+	for (const std::pair<VarIdx, VarIdx>& run : runs) {
+		offset = (run.first - this->beginIdx) * stride;
+		this->problemInstance->fixColumnValues(run.first, run.second,
+				values + offset, stride);
+	}
+	DEBUG(logger, BundleKey::FIX_VAR_GROUP_VALUES, report.numberOfVariables,
+			this->groupName.c_str());
+	return report;
 }
 
 //************************************* PUBLIC CONSTANT FIELDS *************************************//
 
 //************************************ CONSTRUCTOR & DESTRUCTOR ************************************//
 
-/* Friend of Variable class: setVariableName() */
-VariableIdxMapper::VariableIdxMapper(const VarIdx firstIdx,
-		const std::list<VarDimIdx>& dimensions, const VarIdx numberOfVariables,
-		const VarValue variableLowerBound, const VarValue variableUpperBound,
-		const ValueType type, const std::string& groupName) :
-		beginIdx(firstIdx), dimensions(dimensions), numberOfVariables(
-				numberOfVariables), type(type), groupName(groupName) {
+VariableIdxMapper::VariableIdxMapper(OsiProblemInstance* problemInstance,
+		const VarIdx firstIdx, const VarDimensionTable& dimensions,
+		const ValueType type, const std::string& groupName,
+		const NamesPolicy namesPolicy) :
+		problemInstance(problemInstance), beginIdx(firstIdx), dimensions(
+				dimensions), numberOfVariables(dimensions.getNumberOfElements()), type(
+				type), namesPolicy(
+				namesPolicy), variableNames(nullptr), variableNamesMutex { }, groupName(
+				groupName) {
 	DEBUG(logger, BundleKey::INIT_VAR_MAPPER_CONSTRUCTOR, numberOfVariables,
-			Utils::getStringDimensions(this->dimensions).c_str(), firstIdx,
-			Utils::getStringValueType(type).c_str(),
-			Utils::getStringBound(variableLowerBound).c_str(),
-			Utils::getStringBound(variableUpperBound).c_str());
-	variables = new Variable*[numberOfVariables] { };
-	for (VarIdx i = 0; i < numberOfVariables; i += 1) {
-		variables[i] = new Variable { variableLowerBound, variableUpperBound };
-		variables[i]->setVariableName(
-				MapUtils::getVariableName(i, groupName, dimensions));
+			Utils::getStringDimensions(this->dimensions.getExtents()).c_str(),
+			firstIdx, Utils::getStringValueType(type).c_str());
+	if (namesPolicy == NamesPolicy::CACHE_NAMES) {
+		this->variableNames = new std::unordered_map<VarIdx, std::string> { };
 	}
 }
 
 VariableIdxMapper::~VariableIdxMapper() {
-	for (VarIdx i = 0; i < numberOfVariables; i += 1) {
-		delete variables[i];
-	}
-	delete[] variables;
+	delete this->variableNames;
 }
 
 //*************************************** PUBLIC FUNCTIONS *****************************************//
@@ -69,21 +189,109 @@ std::string VariableIdxMapper::toString() {
 	std::ostringstream os { };
 	os << "\tName of variables:\t" << groupName
 			<< "\n\tVariables' dimensions:\t"
-			<< Utils::getStringDimensions(this->dimensions) << std::endl;
+			<< Utils::getStringDimensions(this->dimensions.getExtents())
+			<< std::endl;
 	return os.str();
 }
 
 VarDimIdx VariableIdxMapper::getDimensionsSize() {
-	return (VarDimIdx) dimensions.size();
+	return dimensions.getNumberOfDimensions();
+}
+
+BoundsReport VariableIdxMapper::setBounds(const IndexRange* ranges,
+		const VarValue lowerBound, const VarValue upperBound) const {
+	return changeBounds(ranges, &lowerBound, &upperBound, 0);
+}
+
+BoundsReport VariableIdxMapper::setBounds(const IndexRange* ranges,
+		const ParamIdxMapper* lowerBounds,
+		const ParamIdxMapper* upperBounds) const
+				throw (VariableModelExceptions::DifferentDimensionsException) {
+	checkDimensions(lowerBounds);
+	checkDimensions(upperBounds);
+	return changeBounds(ranges, lowerBounds->getValues(),
+			upperBounds->getValues(), 1);
+}
+
+BoundsReport VariableIdxMapper::fixValues(const IndexRange* ranges,
+		const VarValue value) const {
+	return changeValues(ranges, &value, 0);
+}
+
+BoundsReport VariableIdxMapper::fixValues(const IndexRange* ranges,
+		const ParamIdxMapper* values) const
+				throw (VariableModelExceptions::DifferentDimensionsException) {
+	checkDimensions(values);
+	return changeValues(ranges, values->getValues(), 1);
+}
+
+void VariableIdxMapper::relax(const IndexRange* ranges) const {
+	std::vector<std::pair<VarIdx, VarIdx>> runs { };
+	size_t numberOfVariables { 0 };
+
+	getRuns(ranges, runs);
+	for (const std::pair<VarIdx, VarIdx>& run : runs) {
+		this->problemInstance->unfixColumns(run.first, run.second);
+		numberOfVariables += run.second;
+	}
+	DEBUG(logger, BundleKey::RELAX_VAR_GROUP, numberOfVariables,
+			this->groupName.c_str());
 }
 
 //*************************************** GETTERS & SETTERS ****************************************//
 
+OsiProblemInstance* VariableIdxMapper::getProblemInstance() const {
+	return problemInstance;
+}
+
 VarIdx VariableIdxMapper::getBeginIdx() const {
 	return beginIdx;
 }
 
-const std::list<VarDimIdx>& VariableIdxMapper::getDimensions() const {
+void VariableIdxMapper::setBeginIdx(const VarIdx beginIdx) {
+	this->beginIdx = beginIdx;
+}
+
+VarIdx VariableIdxMapper::getNumberOfVariables() const {
+	return numberOfVariables;
+}
+
+ValueType VariableIdxMapper::getType() const {
+	return type;
+}
+
+std::string VariableIdxMapper::getVariableName(const VarIdx idx) const {
+	std::unordered_map<VarIdx, std::string>::const_iterator it { };
+	if (this->variableNames == nullptr) {
+		return MapUtils::getVariableName(idx, this->groupName,
+				this->dimensions);
+	}
+	std::lock_guard<std::mutex> lock { this->variableNamesMutex };
+	it = this->variableNames->find(idx);
+	if (it == this->variableNames->end()) {
+		it = this->variableNames->insert(
+				std::pair<VarIdx, std::string>(idx,
+						MapUtils::getVariableName(idx, this->groupName,
+								this->dimensions))).first;
+	}
+	return it->second;
+}
+
+void VariableIdxMapper::setNamesPolicy(const NamesPolicy namesPolicy) {
+	this->namesPolicy = namesPolicy;
+	if (namesPolicy == NamesPolicy::GENERATE_NAMES) {
+		delete this->variableNames;
+		this->variableNames = nullptr;
+	} else if (this->variableNames == nullptr) {
+		this->variableNames = new std::unordered_map<VarIdx, std::string> { };
+	}
+}
+
+const std::string& VariableIdxMapper::getGroupName() const {
+	return groupName;
+}
+
+const VarDimensionTable& VariableIdxMapper::getDimensions() const {
 	return dimensions;
 }
 
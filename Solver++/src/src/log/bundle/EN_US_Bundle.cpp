@@ -28,40 +28,132 @@ const char* dictionary[] = {
 		//**************** Trace ****************//
 		// INIT_VAR_GROUP,
 		"Creating new group of variable: %s.",
-		// INIT_VAR_REGEX_MATCH
+		// INIT_VAR_DEFINITION_MATCH
 		"Definition matched.\n\tNew group's name\t:\t'%s'\n\tDimensions\t\t:\t%s",
-		// INIT_VAR_GET_DIM_LIST
-		"Retrieving dimensions of group of variables from definition (%s).",
 		// INIT_VAR_ADD_COUNT
 		"%VarIdx% variables has been added to problem instance.",
-		// GET_VAR_REGEX_MATCHED
-		"Trying to get variable '%s' (regex definition matched).",
+		// GET_VAR_DEFINITION_MATCHED
+		"Trying to get variable '%s' (definition parsed).",
 		// GET_VAR_SPLIT_DEFINITION_STATUS
 		"Trying to get variable from partial definition '%s' (was splitted into variable name '%s' and expected number of dimensions: %DimIdx%).",
 		// DELETE_VARIABLE
 		"Deleting variable:\t\n%s",
+		// INIT_ROW_GROUP
+		"Creating new group of rows: %s.",
+		// INIT_ROW_ADD_COUNT
+		"%RowIdx% rows has been added to problem instance.",
+		// DELETE_ROWS
+		"Deleting group of rows:\t\n%s",
+		// INIT_PARAM_GROUP
+		"Creating new group of parameters: %s.",
+		// DELETE_PARAMETERS
+		"Deleting group of parameters:\t\n%s",
 
 		//**************** Debug ****************//
+		// MERGE_ROW_BUFFERS
+		"Merging %zu coefficients and %zu bounds of rows from %u thread-local buffers.",
+		// CAPTURE_BASIS
+		"Basis of %zu columns and %zu rows has been captured.",
+		// APPLY_BASIS
+		"Passing basis to the solver: %zu of %VarIdx% columns and %zu of %RowIdx% rows got status from stored basis.",
 
 		//**************** Info *****************//
+		// GENERATE_ROWS
+		"Generating rows by %zu tasks on %u threads (%zu tasks per batch).",
+		// GENERATE_ROW_FAMILY
+		"Generating family of %zu rows of group %s (%zu coefficients per row reserved).",
+		// LOAD_PARAM_TENSOR
+		"Loading group of parameters '%s' (%zu values) from tensor file '%s' (%s).",
+		// SAVE_PARAM_TENSOR
+		"Saving group of parameters '%s' (%u values) into tensor file '%s'.",
+		// SAVE_BASIS
+		"Saving basis of %zu columns and %zu rows into file '%s'.",
+		// LOAD_BASIS
+		"Loaded basis of %zu columns and %zu rows from file '%s'.",
+		// SAVE_SNAPSHOT
+		"Saving snapshot of model (%zu groups, %VarIdx% columns, %RowIdx% rows, %zu coefficients) into file '%s'.",
+		// LOAD_SNAPSHOT
+		"Loaded snapshot of model (%zu groups, %VarIdx% columns, %RowIdx% rows, %zu coefficients) from file '%s' in %.3f s.",
+		// SOLVE_ASYNC
+		"Solving problem with %VarIdx% columns and %RowIdx% rows in background thread.",
 
 		//**************** Warn *****************//
 
 		//**************** Error ****************//
 
 		//**************** Fatal ****************//
-		// INIT_VAR_GROUP_REGEX_SEARCH_FAILED
+		// INIT_VAR_GROUP_PARSE_FAILED
 		"Given definition of a group of variables '%s' is invalid and cannot be interpreted.",
 		// INIT_VAR_DUPLICATE
 		"Group of variables with given name ('%s') already exists. Details of this variables are listed below:\n%s",
+		// INIT_VAR_GROUP_TOO_LARGE
+		"Group of variables '%s' with dimensions %s has more than %VarIdx% variables.",
+		// INIT_VAR_ADD_COUNT_TOO_LARGE
+		"%VarIdx% variables cannot be added to model with %VarIdx% columns - index of column would exceed %VarIdx%.",
 		// GET_VAR_DIFFERENT_DIM_SIZE
-		"Given variable '%s' has different number of dimensions than already defined group ('%s' is %DimIdx%-dimensional group of variables).",
+		"Given variable '%s' has different number of dimensions than already defined group ('%s' is %VarDimIdx%-dimensional group of variables).",
 		// GET_VAR_INDEX_OUT_OF_BOUNDS
 		"One or more indexes in given definition of variable '%s' has value that is out of bounds of already defined group's definition ('%s' is a group of variables with dimensions: %s).",
-		// GET_VAR_GROUP_REGEX_SEARCH_FAILED
+		// GET_VAR_DEFINITION_PARSE_FAILED
 		"Given definition of a variable '%s' is invalid and cannot be interpreted.",
+		// GET_VAR_GROUP_DIFFERENT_DIM_SIZE
+		"Group of variables '%s' cannot be accessed by %VarDimIdx%-dimensional handle (it is %VarDimIdx%-dimensional group of variables).",
 		// SET_VAR_FIX_VALUE_OUT_OF_BOUNDS
 		"Cannot assign value '%VarValue%' to variable '%s' with bounds:\n\tlower\t:\t%VarValue%,\n\tupper\t:\t%VarValue%.",
+		// INIT_ROW_GROUP_PARSE_FAILED
+		"Given definition of a group of rows '%s' is invalid and cannot be interpreted.",
+		// INIT_ROW_DUPLICATE
+		"Group of rows with given name ('%s') already exists. Details of this rows are listed below:\n%s",
+		// INIT_ROW_GROUP_TOO_LARGE
+		"Group of rows '%s' with dimensions %s has more than %RowIdx% rows.",
+		// INIT_ROW_ADD_COUNT_TOO_LARGE
+		"%RowIdx% rows cannot be added to model with %RowIdx% rows - index of row would exceed %RowIdx%.",
+		// GET_ROW_DIFFERENT_DIM_SIZE
+		"Given row '%s' has different number of dimensions than already defined group ('%s' is %VarDimIdx%-dimensional group of rows).",
+		// GET_ROW_INDEX_OUT_OF_BOUNDS
+		"One or more indexes in given definition of row '%s' has value that is out of bounds of already defined group's definition ('%s' is a group of rows with dimensions: %s).",
+		// GET_ROW_DEFINITION_PARSE_FAILED
+		"Given definition of a row '%s' is invalid and cannot be interpreted.",
+		// GET_ROW_GROUP_DIFFERENT_DIM_SIZE
+		"Group of rows '%s' cannot be accessed by %VarDimIdx%-dimensional handle (it is %VarDimIdx%-dimensional group of rows).",
+		// INIT_PARAM_GROUP_PARSE_FAILED
+		"Given definition of a group of parameters '%s' is invalid and cannot be interpreted.",
+		// INIT_PARAM_DUPLICATE
+		"Group of parameters with given name ('%s') already exists. Details of this parameters are listed below:\n%s",
+		// INIT_PARAM_GROUP_TOO_LARGE
+		"Group of parameters '%s' with dimensions %s has more than %u parameters.",
+		// INIT_PARAM_VALUE_OUT_OF_BOUNDS
+		"Cannot assign value '%VarValue%' to group of parameters '%s' with bounds:\n\tlower\t:\t%s,\n\tupper\t:\t%s.",
+		// GET_PARAM_DIFFERENT_DIM_SIZE
+		"Given parameter '%s' has different number of dimensions than already defined group ('%s' is %DimIdx%-dimensional group of parameters).",
+		// GET_PARAM_INDEX_OUT_OF_BOUNDS
+		"One or more indexes in given definition of parameter '%s' has value that is out of bounds of already defined group's definition ('%s' is a group of parameters with dimensions: %s).",
+		// GET_PARAM_DEFINITION_PARSE_FAILED
+		"Given definition of a parameter '%s' is invalid and cannot be interpreted.",
+		// GET_PARAM_GROUP_DIFFERENT_DIM_SIZE
+		"Group of parameters '%s' cannot be accessed by %DimIdx%-dimensional handle (it is %DimIdx%-dimensional group of parameters).",
+		// LOAD_PARAM_TENSOR_FAILED
+		"File '%s' cannot be read or it is not a valid tensor file of parameters.",
+		// SAVE_PARAM_TENSOR_FAILED
+		"Group of parameters '%s' cannot be saved into tensor file '%s'.",
+		// SOLVE_SCENARIO_INVALID
+		"Scenario %zu changes column or row that does not exist in the model (%VarIdx% columns, %RowIdx% rows).",
+		// SAVE_BASIS_FAILED
+		"Basis cannot be saved into file '%s'.",
+		// LOAD_BASIS_FAILED
+		"File '%s' cannot be read or it is not a valid basis file.",
+		// GET_SOLUTION_NOT_AVAILABLE
+		"Solution of group '%s' is not available (model has not been solved, it has been changed since the last solve or snapshot belongs to another model).",
+		// SAVE_SNAPSHOT_FAILED
+		"Snapshot of model cannot be saved into file '%s'.",
+		// LOAD_SNAPSHOT_FAILED
+		"File '%s' cannot be read or it is not a valid snapshot file.",
+		// LOAD_SNAPSHOT_NOT_EMPTY
+		"Snapshot '%s' cannot be loaded into model that already has groups, columns or rows.",
+		// GENERATE_ROWS_INDEX_OUT_OF_BOUNDS
+		"Row generator added coefficient of row %RowIdx% and column %VarIdx% while problem instance has only %RowIdx% rows and %VarIdx% columns.",
+		// GENERATE_ROWS_BOUND_OUT_OF_BOUNDS
+		"Row generator set bounds of row %RowIdx% while problem instance has only %RowIdx% rows.",
 
 		//*********************************** VariableIdxMapper ***********************************//
 		//**************** Trace ****************//
@@ -72,11 +164,21 @@ const char* dictionary[] = {
 
 		//**************** Debug ****************//
 		// INIT_VAR_MAPPER_CONSTRUCTOR
-		"Initialize mapping to %VarIdx% variables with given parameters:\n\tDimensions\t:\t%s\n\tFirst index\t:\t%VarIdx%\n\tType\t\t:\t%s\n\tLower bound\t:\t%s\n\tUpper bound\t:\t%s",
+		"Initialize mapping to %VarIdx% variables with given parameters:\n\tDimensions\t:\t%s\n\tFirst index\t:\t%VarIdx%\n\tType\t\t:\t%s",
+		// SET_VAR_GROUP_BOUNDS
+		"Bounds of %zu variables of group '%s' have been changed.",
+		// FIX_VAR_GROUP_VALUES
+		"Values of %zu variables of group '%s' have been fixed.",
+		// RELAX_VAR_GROUP
+		"Fixed values of %zu variables of group '%s' have been released.",
 
 		//**************** Info *****************//
 
 		//**************** Warn *****************//
+		// SET_VAR_GROUP_BOUNDS_REJECTED
+		"Bounds of %zu variables of group '%s' have not been changed - bounds of %zu of them are invalid (the first one: '%s').",
+		// FIX_VAR_GROUP_VALUES_REJECTED
+		"Values of %zu variables of group '%s' have not been fixed - %zu of them are out of bounds (the first one: '%s').",
 
 		//**************** Error ****************//
 		// NEGATIVE_INDEX
@@ -85,15 +187,237 @@ const char* dictionary[] = {
 		"One of the indexes in given definition of dimensions ('%s') is out of bounds for '%s'.",
 
 		//**************** Fatal ****************//
+		// VAR_GROUP_DIFFERENT_PARAM_DIMS
+		"Group of parameters '%s' with dimensions %s cannot give values to group of variables '%s' with dimensions %s.",
 
 		//*********************************** Variable ***********************************//
 		//**************** Trace ****************//
 		// SET_VAR_FIX_VALUE
 		"Value of variable '%s' has been fixed to '%VarValue%' and will not be changed during LP/MIP problem solving.",
+		// SET_VAR_BOUNDS
+		"Bounds of variable '%s' have been changed to:\n\tlower\t:\t%s,\n\tupper\t:\t%s.",
 
 		//**************** Debug ****************//
-		// INIT_VAR_VARIABLE_CONSTRUCTOR
-		"Initialize variable:\n\tLower bound\t:\t%s\n\tUpper bound\t:\t%s"
+
+		//**************** Info *****************//
+
+		//**************** Warn *****************//
+
+		//**************** Error ****************//
+
+		//**************** Fatal ****************//
+		// SET_VAR_BOUNDS_INVALID
+		"Cannot assign bounds:\n\tlower\t:\t%s,\n\tupper\t:\t%s\nto variable '%s' - lower bound is greater than upper bound or fixed value of variable is out of them.",
+
+		//*********************************** Row ***********************************//
+		//**************** Trace ****************//
+
+		//**************** Debug ****************//
+
+		//**************** Info *****************//
+
+		//**************** Warn *****************//
+
+		//**************** Error ****************//
+
+		//**************** Fatal ****************//
+		// ADD_ROW_ELEMENT_OUT_OF_BOUNDS
+		"Cannot add coefficient of column %VarIdx% to row '%s' - problem instance has only %VarIdx% columns.",
+
+		//*********************************** RowIdxMapper ***********************************//
+		//**************** Trace ****************//
+
+		//**************** Debug ****************//
+		// INIT_ROW_MAPPER_CONSTRUCTOR
+		"Initialize mapping to %RowIdx% rows with given parameters:\n\tDimensions\t:\t%s\n\tFirst index\t:\t%RowIdx%",
+
+		//**************** Info *****************//
+
+		//**************** Warn *****************//
+
+		//**************** Error ****************//
+
+		//**************** Fatal ****************//
+
+		//*********************************** ParamIdxMapper ***********************************//
+		//**************** Trace ****************//
+
+		//**************** Debug ****************//
+		// INIT_PARAM_MAPPER_CONSTRUCTOR
+		"Initialize %u parameters with given parameters:\n\tDimensions\t:\t%s\n\tMemory\t\t:\t%zu bytes",
+		// INIT_PARAM_MAPPER_MAPPED
+		"Initialize %u parameters stored in mapped tensor file:\n\tDimensions\t:\t%s\n\tFile size\t:\t%zu bytes",
+
+		//**************** Info *****************//
+
+		//**************** Warn *****************//
+
+		//**************** Error ****************//
+
+		//**************** Fatal ****************//
+
+		//*********************************** Parameter ***********************************//
+		//**************** Trace ****************//
+
+		//**************** Debug ****************//
+
+		//**************** Info *****************//
+
+		//**************** Warn *****************//
+
+		//**************** Error ****************//
+
+		//**************** Fatal ****************//
+		// SET_PARAM_VALUE_OUT_OF_BOUNDS
+		"Cannot assign value '%VarValue%' to parameter '%s' with bounds:\n\tlower\t:\t%s,\n\tupper\t:\t%s.",
+
+		//*********************************** ParamTextLoader ***********************************//
+		//**************** Trace ****************//
+
+		//**************** Debug ****************//
+
+		//**************** Info *****************//
+		// LOAD_PARAM_TEXT
+		"Loading values of group of parameters '%s' from text file '%s' (%u threads).",
+		// LOAD_PARAM_TEXT_DONE
+		"Loaded %zu lines: %zu values assigned, %zu parameters left with default value.",
+
+		//**************** Warn *****************//
+		// LOAD_PARAM_TEXT_DUPLICATES
+		"%zu lines assign value to already assigned parameter (first of them: '%s') - they are ignored.",
+		// LOAD_PARAM_TEXT_INVALID
+		"%zu lines of text file '%s' are not valid entries of parameters - they are ignored.",
+
+		//**************** Error ****************//
+
+		//**************** Fatal ****************//
+		// LOAD_PARAM_TEXT_FAILED
+		"File '%s' cannot be read as text file of parameters.",
+
+		//*********************************** ModelWriter ***********************************//
+		//**************** Trace ****************//
+
+		//**************** Debug ****************//
+
+		//**************** Info *****************//
+		// WRITE_MODEL
+		"Writing model (%VarIdx% columns, %RowIdx% rows, %zu coefficients) into %s file '%s'.",
+		// WRITE_MODEL_DONE
+		"Model written (%zu bytes before compression) in %.3f s.",
+
+		//**************** Warn *****************//
+
+		//**************** Error ****************//
+
+		//**************** Fatal ****************//
+		// WRITE_MODEL_FAILED
+		"Model cannot be written into file '%s'.",
+
+		//*********************************** ModelReader ***********************************//
+		//**************** Trace ****************//
+
+		//**************** Debug ****************//
+
+		//**************** Info *****************//
+		// READ_MODEL
+		"Reading model from %s file '%s' (%zu bytes, %u threads).",
+		// READ_MODEL_DONE
+		"Model read: %zu groups of variables (%VarIdx% columns), %zu groups of rows (%RowIdx% rows), %zu coefficients in %.3f s.",
+
+		//**************** Warn *****************//
+		// READ_MODEL_SPARSE_GROUP
+		"Names of group '%s' are folded into %zu elements, but only %zu of them are found in model file - missing elements are created.",
+		// READ_MODEL_MIXED_TYPES
+		"Group of variables '%s' has columns of different types in model file - type of its first column is used.",
+		// READ_MODEL_MAXIMIZE
+		"Objective function of model file is maximized - %zu coefficients are negated, as model is always minimized.",
+
+		//**************** Error ****************//
+
+		//**************** Fatal ****************//
+		// READ_MODEL_FAILED
+		"Model cannot be read from file '%s'.",
+		// READ_MODEL_INVALID_LINE
+		"Line %zu of model file '%s' cannot be interpreted: '%s'.",
+		// READ_MODEL_INVALID_GROUP
+		"Names of group '%s' in model file cannot be folded into group (different numbers of indexes or too many elements).",
+		// READ_MODEL_DUPLICATE_VARIABLES
+		"Group of variables '%s' of model file '%s' already exists - nothing has been added to model.",
+		// READ_MODEL_DUPLICATE_ROWS
+		"Group of rows '%s' of model file '%s' already exists - nothing has been added to model.",
+		// READ_MODEL_TOO_LARGE
+		"Model file '%s' has %zu columns and %zu rows, which cannot be added to model with %VarIdx% columns and %RowIdx% rows.",
+
+		//*********************************** OsiProblemInstance ***********************************//
+		//**************** Trace ****************//
+		// RESERVE_COLUMNS
+		"Reallocating column arrays (capacity: %VarIdx% -> %VarIdx%).",
+		// RESERVE_ROWS
+		"Reallocating row arrays (capacity: %RowIdx% -> %RowIdx%).",
+
+		//**************** Debug ****************//
+		// INIT_SOLVER_INTERFACE
+		"Using solver engine %s.",
+		// ADD_COLUMNS
+		"Adding %VarIdx% new columns starting from column %VarIdx%.",
+		// ADD_ROWS
+		"Adding %RowIdx% new rows starting from row %RowIdx%.",
+		// REMOVE_COLUMNS
+		"Deleting %VarIdx% columns starting from column %VarIdx% (%VarIdx% of them known to solver).",
+		// REMOVE_ROWS
+		"Deleting %RowIdx% rows starting from row %RowIdx% (%RowIdx% of them known to solver).",
+
+		//**************** Info *****************//
+		// LOAD_PROBLEM
+		"Loading problem into solver: %VarIdx% columns, %RowIdx% rows, %zu coefficients.",
+		// UPDATE_PROBLEM
+		"Pushing changes into solver: %zu columns and %zu rows deleted, %zu columns and %zu rows changed, %VarIdx% columns and %RowIdx% rows added.",
+		// UPDATE_PROBLEM_RELOAD
+		"%zu coefficients of already loaded rows and columns have been changed - problem will be loaded into solver once again.",
+		// SOLVE_PROBLEM
+		"Solving problem of %VarIdx% columns and %RowIdx% rows (%s start).",
+		// SOLVE_PROBLEM_DONE
+		"Problem solved with status %u after %d iterations (objective value: %VarValue%).",
+		// SOLVE_SCENARIOS
+		"Solving %zu scenarios of loaded problem by %u workers.",
+		// SOLVE_SCENARIOS_DONE
+		"%zu of %zu scenarios solved to optimality.",
+
+		//**************** Warn *****************//
+		// SOLVE_MIP_TIME_LIMIT_IGNORED
+		"Time limit of %f seconds is ignored - problem has %d integer columns and %s engine cannot limit time of branch and bound.",
+		// SOLVE_MIP_CANCEL_IGNORED
+		"Solve has been cancelled while branch and bound of problem with %d integer columns was running - it could not be stopped before it finished.",
+
+		//**************** Error ****************//
+
+		//**************** Fatal ****************//
+
+		//*********************************** Presolve ***********************************//
+		//**************** Trace ****************//
+
+		//**************** Debug ****************//
+
+		//**************** Info *****************//
+		// PRESOLVE_DONE
+		"Presolve removed %VarIdx% of %VarIdx% columns and %RowIdx% of %RowIdx% rows in %u passes (%zu fixed columns, %zu singleton rows, %zu empty rows, %zu redundant rows, %zu duplicate rows, %zu tightened bounds).",
+
+		//**************** Warn *****************//
+		// PRESOLVE_INFEASIBLE
+		"Presolve has found that problem is infeasible after %u passes - it will be passed to the solver without reductions.",
+
+		//**************** Error ****************//
+
+		//**************** Fatal ****************//
+
+		//*********************************** CoefficientMatrix ***********************************//
+		//**************** Trace ****************//
+		// ALLOCATE_CHUNK
+		"Allocating chunk no. %zu of coefficients (%zu coefficients per chunk).",
+
+		//**************** Debug ****************//
+		// REMOVE_ELEMENTS
+		"Removed %zu coefficients of %s [%zu, %zu)."
 
 		//**************** Info *****************//
 
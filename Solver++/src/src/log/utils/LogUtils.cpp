@@ -71,7 +71,8 @@ size_t insertRightFormat(std::string& bundle, const size_t& beginIdx,
 
 const char* formatBundle(const char* bundle, ...) {
 	va_list va { };
-	static char formatted[LOG_BUFFER_SIZE] { };
+	// every thread formats its own messages (workers of Solver::generateRows(), solveAsync() thread)
+	thread_local char formatted[LOG_BUFFER_SIZE] { };
 	va_start(va, bundle);
 	vsnprintf(formatted, LOG_BUFFER_SIZE, bundle, va);
 	va_end(va);
@@ -0,0 +1,233 @@
+/*
+ * TensorFileUtils.cpp
+ *
+ *  Created on: 17 paź 2026
+ *      Author: tomasz
+ */
+
+#include "../../include/utils/TensorFileUtils.hpp"
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+namespace TensorFileUtils {
+
+namespace {
+
+bool isLittleEndian() {
+	const uint16_t one { 1 };
+	return *reinterpret_cast<const unsigned char*>(&one) == 1;
+}
+
+/** Reads little-endian unsigned integer of type T from given address.
+ *
+ */
+template<typename T>
+T readUnsigned(const unsigned char* bytes) {
+	T value { 0 };
+	for (size_t i = sizeof(T); i > 0; i -= 1) {
+		value = (value << 8) | bytes[i - 1];
+	}
+	return value;
+}
+
+/** Appends given unsigned integer to buffer as little-endian bytes.
+ *
+ */
+template<typename T>
+void writeUnsigned(std::vector<unsigned char>& buffer, T value) {
+	for (size_t i = 0; i < sizeof(T); i += 1) {
+		buffer.push_back(static_cast<unsigned char>(value & 0xFF));
+		value >>= 8;
+	}
+}
+
+/** Reads little-endian value of type T (of the same size as U) from given address.
+ *
+ */
+template<typename T, typename U>
+T readValue(const unsigned char* bytes) {
+	static_assert(sizeof(T) == sizeof(U), "Types have to be of the same size.");
+	const U bits { readUnsigned<U>(bytes) };
+	T value { };
+	memcpy(&value, &bits, sizeof(T));
+	return value;
+}
+
+size_t getSizeOf(const DataType dataType) {
+	switch (dataType) {
+	case DataType::FLOAT64:
+	case DataType::INT64:
+		return 8;
+	case DataType::FLOAT32:
+	case DataType::INT32:
+		return 4;
+	default:
+		return 0;
+	}
+}
+
+}
+
+const char MAGIC[8] { 'S', 'P', 'P', 'T', 'N', 'S', 'R', '\0' };
+
+Mapping map(const std::string& fileName)
+		throw (ParameterModelExceptions::TensorFileException) {
+	struct stat status { };
+	void* address { };
+	const int fd { open(fileName.c_str(), O_RDONLY) };
+	if (fd < 0) {
+		throw ParameterModelExceptions::TensorFileException();
+	}
+	if (fstat(fd, &status) != 0 || status.st_size == 0) {
+		close(fd);
+		throw ParameterModelExceptions::TensorFileException();
+	}
+	address = mmap(nullptr, status.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE,
+			fd, 0);
+	close(fd);
+	if (address == MAP_FAILED) {
+		throw ParameterModelExceptions::TensorFileException();
+	}
+	return Mapping { address, static_cast<size_t>(status.st_size) };
+}
+
+void unmap(Mapping& mapping) {
+	if (mapping.address != nullptr) {
+		munmap(mapping.address, mapping.size);
+		mapping.address = nullptr;
+		mapping.size = 0;
+	}
+}
+
+bool readDescription(const Mapping& mapping, Description& description) {
+	const unsigned char* bytes {
+			static_cast<const unsigned char*>(mapping.address) };
+	uint32_t numberOfDimensions { }, nameLength { };
+	size_t position { sizeof(Header) };
+
+	if (mapping.size < sizeof(Header)
+			|| memcmp(bytes, MAGIC, sizeof(MAGIC)) != 0
+			|| readUnsigned<uint32_t>(bytes + 8) != VERSION) {
+		return false;
+	}
+	description.dataType = static_cast<DataType>(readUnsigned<uint32_t>(
+			bytes + 12));
+	numberOfDimensions = readUnsigned<uint32_t>(bytes + 16);
+	nameLength = readUnsigned<uint32_t>(bytes + 20);
+	description.dataOffset = readUnsigned<uint64_t>(bytes + 24);
+	if (getSizeOf(description.dataType) == 0
+			|| numberOfDimensions > MAX_NUMBER_OF_DIMENSIONS
+			|| description.dataOffset % DATA_ALIGNMENT != 0
+			|| position + 4 * numberOfDimensions + nameLength
+					> description.dataOffset
+			|| description.dataOffset > mapping.size) {
+		return false;
+	}
+
+	description.extents.clear();
+	description.numberOfElements = 1;
+	for (uint32_t i = 0; i < numberOfDimensions; i += 1, position += 4) {
+		description.extents.push_back(readUnsigned<uint32_t>(bytes + position));
+		description.numberOfElements *= description.extents[i];
+		if (description.numberOfElements > static_cast<ParamIdx>(-1)) {
+			return false;
+		}
+	}
+	description.name.assign(reinterpret_cast<const char*>(bytes + position),
+			nameLength);
+
+	return (mapping.size - description.dataOffset)
+			/ getSizeOf(description.dataType) >= description.numberOfElements;
+}
+
+bool isNative(const DataType dataType) {
+	return dataType == DataType::FLOAT64 && sizeof(ParamValue) == 8
+			&& isLittleEndian();
+}
+
+void convert(const Mapping& mapping, const Description& description,
+		ParamValue* values) {
+	const unsigned char* data {
+			static_cast<const unsigned char*>(mapping.address)
+					+ description.dataOffset };
+	const size_t size { getSizeOf(description.dataType) };
+	for (size_t i = 0; i < description.numberOfElements; i += 1) {
+		switch (description.dataType) {
+		case DataType::FLOAT64:
+			values[i] = readValue<double, uint64_t>(data + i * size);
+			break;
+		case DataType::FLOAT32:
+			values[i] = readValue<float, uint32_t>(data + i * size);
+			break;
+		case DataType::INT64:
+			values[i] = static_cast<ParamValue>(readValue<int64_t, uint64_t>(
+					data + i * size));
+			break;
+		case DataType::INT32:
+			values[i] = readValue<int32_t, uint32_t>(data + i * size);
+			break;
+		}
+	}
+}
+
+void write(const std::string& fileName, const std::string& name,
+		const ParamDimensionTable& dimensions, const ParamValue* values)
+				throw (ParameterModelExceptions::TensorFileException) {
+	std::vector<unsigned char> header { };
+	const size_t numberOfElements { dimensions.getNumberOfElements() };
+	const size_t headerSize { sizeof(Header)
+			+ 4 * dimensions.getNumberOfDimensions() + name.length() };
+	const uint64_t dataOffset { (headerSize + DATA_ALIGNMENT - 1)
+			/ DATA_ALIGNMENT * DATA_ALIGNMENT };
+	bool written { };
+	FILE* file { };
+
+	if (name.length() > std::numeric_limits<uint32_t>::max()) {
+		throw ParameterModelExceptions::TensorFileException();
+	}
+	header.insert(header.end(), MAGIC, MAGIC + sizeof(MAGIC));
+	writeUnsigned<uint32_t>(header, VERSION);
+	writeUnsigned<uint32_t>(header, DataType::FLOAT64);
+	writeUnsigned<uint32_t>(header, dimensions.getNumberOfDimensions());
+	writeUnsigned<uint32_t>(header, static_cast<uint32_t>(name.length()));
+	writeUnsigned<uint64_t>(header, dataOffset);
+	for (ParamDimIdx i = 0; i < dimensions.getNumberOfDimensions(); i += 1) {
+		writeUnsigned<uint32_t>(header, dimensions.getExtent(i));
+	}
+	header.insert(header.end(), name.begin(), name.end());
+	header.resize(dataOffset, 0);
+
+	file = fopen(fileName.c_str(), "wb");
+	if (file == nullptr) {
+		throw ParameterModelExceptions::TensorFileException();
+	}
+	written = fwrite(header.data(), 1, header.size(), file) == header.size();
+	if (isLittleEndian()) {
+		written = written
+				&& fwrite(values, sizeof(ParamValue), numberOfElements, file)
+						== numberOfElements;
+	} else {
+		for (size_t i = 0; written && i < numberOfElements; i += 1) {
+			uint64_t bits { };
+			header.clear();
+			memcpy(&bits, values + i, sizeof(bits));
+			writeUnsigned<uint64_t>(header, bits);
+			written = fwrite(header.data(), 1, header.size(), file)
+					== header.size();
+		}
+	}
+	written = fclose(file) == 0 && written;
+	if (!written) {
+		throw ParameterModelExceptions::TensorFileException();
+	}
+}
+
+}
@@ -7,12 +7,11 @@
 
 #include "../../include/utils/Utils.hpp"
 
-#include <list>
 #include <sstream>
 #include <string>
-#include <unordered_map>
 #include <utility>
 
+#include "../../include/DimensionTable.hpp"
 #include "../../include/Typedefs.hpp"
 
 namespace Utils {
@@ -27,17 +26,27 @@ void storeInfinityValues(const VarValue infinity) {
 
 }
 
-const std::string getStringVariableRowCoefficients(
-		const std::unordered_map<RowIdx, VarValue>& rowCoefficients) {
+const std::string getStringVariableRowCoefficients(const RowIdx* rowIdx,
+		const VarValue* rowCoefficients, const size_t count) {
 	std::ostringstream os { };
-	std::unordered_map<RowIdx, VarValue>::const_iterator itEnd =
-			rowCoefficients.end();
 
 	os << "\t\tRowIdx\t\tCoefficient's value\n";
 
-	for (std::unordered_map<RowIdx, VarValue>::const_iterator itBegin =
-			rowCoefficients.begin(); itBegin != itEnd; ++itBegin) {
-		os << "\t\t" << itBegin->first << " \t\t" << itBegin->second << "\n";
+	for (size_t i = 0; i < count; i += 1) {
+		os << "\t\t" << rowIdx[i] << " \t\t" << rowCoefficients[i] << "\n";
+	}
+	return os.str();
+}
+
+const std::string getStringRowColumnCoefficients(const VarIdx* columnIdx,
+		const VarValue* columnCoefficients, const size_t count) {
+	std::ostringstream os { };
+
+	os << "\t\tVarIdx\t\tCoefficient's value\n";
+
+	for (size_t i = 0; i < count; i += 1) {
+		os << "\t\t" << columnIdx[i] << " \t\t" << columnCoefficients[i]
+				<< "\n";
 	}
 	return os.str();
 }
@@ -46,12 +55,10 @@ const std::string getStringDimensions(const std::string& dimensions) {
 	return dimensions.empty() ? "no dimensions" : dimensions;
 }
 
-const std::string getStringDimensions(const std::list<VarDimIdx>& dimensions) {
+const std::string getStringDimensions(const IndexTuple<VarDimIdx>& dimensions) {
 	std::ostringstream s { };
-	std::list<VarDimIdx>::const_iterator itBegin = dimensions.begin();
-	std::list<VarDimIdx>::const_iterator itEnd = dimensions.end();
-	for (; itBegin != itEnd; ++itBegin) {
-		s << "[" << (*itBegin) << "]";
+	for (VarDimIdx dimension : dimensions) {
+		s << "[" << dimension << "]";
 	}
 	return dimensions.empty() ? "no dimensions" : s.str();
 }